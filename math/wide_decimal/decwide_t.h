@@ -19,9 +19,12 @@
 
   //#define WIDE_DECIMAL_DISABLE_IOSTREAM
   //#define WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION
+  //#define WIDE_DECIMAL_THREAD_LOCAL_STATIC_POOLS
   //#define WIDE_DECIMAL_DISABLE_CONSTRUCT_FROM_STRING
   //#define WIDE_DECIMAL_DISABLE_CACHED_CONSTANTS
   //#define WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION
+  //#define WIDE_DECIMAL_DIV_RECIPROCAL_CACHE_SIZE=8 // (best if done on the command line)
+  //#define WIDE_DECIMAL_MUL_COUNTERS
   //#define WIDE_DECIMAL_NAMESPACE=something_unique // (best if done on the command line)
 
   #include <math/wide_decimal/decwide_t_detail_ops.h>
@@ -53,6 +56,16 @@
   #error WIDE_DECIMAL_NAMESPACE_END is not defined. Ensure that <decwide_t_detail_namespace.h> is properly included.
   #endif
 
+  #if (defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION) && defined(WIDE_DECIMAL_THREAD_LOCAL_STATIC_POOLS))
+  // Without dynamic memory allocation, the multiplication pools and
+  // the FFT/NTT twiddle tables are static members. These are shared
+  // by all threads, unless WIDE_DECIMAL_THREAD_LOCAL_STATIC_POOLS
+  // is defined, which makes them thread-local.
+  #define WIDE_DECIMAL_STATIC_POOL_STORAGE thread_local // NOLINT(cppcoreguidelines-macro-usage)
+  #else
+  #define WIDE_DECIMAL_STATIC_POOL_STORAGE              // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
   #if (defined(__GNUC__) && (defined(__RL78__) || defined(__riscv)))
   namespace std { using ::ilogb; }
   #endif
@@ -178,6 +191,18 @@
   auto calc_pi(void(*pfn_callback_to_report_digits10)(const std::uint32_t) = nullptr) -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint32_t>::value), decwide_t<ParamDigitsBaseTen, std::uint16_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
   #endif
 
+  template<const ::std::int32_t ParamDigitsBaseTen,
+           typename LimbType          = std::uint32_t,
+           typename AllocatorType     = std::allocator<void>,
+           typename InternalFloatType = double,
+           typename ExponentType      = std::int64_t,
+           typename FftFloatType      = double>
+  #if !defined(WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION)
+  auto calc_pi(const std::function<void(const std::uint32_t)>& pfn_callback_to_report_digits10 = nullptr) -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint64_t>::value), decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+  #else
+  auto calc_pi(void(*pfn_callback_to_report_digits10)(const std::uint32_t) = nullptr) -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint64_t>::value), decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+  #endif
+
   template<const ::std::int32_t ParamDigitsBaseTen,
            typename LimbType          = std::uint32_t,
            typename AllocatorType     = std::allocator<void>,
@@ -210,6 +235,14 @@
            typename FftFloatType      = double>
   auto calc_ln_two() -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint32_t>::value), decwide_t<ParamDigitsBaseTen, std::uint32_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
 
+  template<const ::std::int32_t ParamDigitsBaseTen,
+           typename LimbType          = std::uint32_t,
+           typename AllocatorType     = std::allocator<void>,
+           typename InternalFloatType = double,
+           typename ExponentType      = std::int64_t,
+           typename FftFloatType      = double>
+  auto calc_ln_two() -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint64_t>::value), decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+
   template<const ::std::int32_t ParamDigitsBaseTen,
            typename LimbType          = std::uint32_t,
            typename AllocatorType     = std::allocator<void>,
@@ -234,6 +267,14 @@
            typename FftFloatType      = double>
   auto calc_ln_ten_low_precision() -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint32_t>::value), decwide_t<ParamDigitsBaseTen, std::uint32_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
 
+  template<const ::std::int32_t ParamDigitsBaseTen,
+           typename LimbType          = std::uint32_t,
+           typename AllocatorType     = std::allocator<void>,
+           typename InternalFloatType = double,
+           typename ExponentType      = std::int64_t,
+           typename FftFloatType      = double>
+  auto calc_ln_ten_low_precision() -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint64_t>::value), decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto constexpr unsigned_long_long_max() -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto constexpr signed_long_long_min  () -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto constexpr signed_long_long_max  () -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
@@ -255,8 +296,13 @@
                                                                                                                                                                                       int* expon)                                                                                                      ->          decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto fmod     (const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v1,
                                                                                                                                                                                       const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v2) ->          decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto fma      (const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& a,
+                                                                                                                                                                                        const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& b,
+                                                                                                                                                                                        const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& c) ->          decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+  template<typename ForwardIteratorA, typename ForwardIteratorB> auto dot(ForwardIteratorA a_first, ForwardIteratorA a_last, ForwardIteratorB b_first) -> typename std::iterator_traits<ForwardIteratorA>::value_type;
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto ilogb    (const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& x)  -> typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::exponent_type;
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto sqrt     (const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& x)  ->          decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto rsqrt    (const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& x)  ->          decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto cbrt     (const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& x)  ->          decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto rootn    (const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& x, // NOLINT(misc-no-recursion)
                                                                                                                                                                                       std::int32_t p)                                                                                                  ->          decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
@@ -517,9 +563,10 @@
     // Check the limb type.
     static_assert((   std::is_same<std::uint8_t,  limb_type>::value
                    || std::is_same<std::uint16_t, limb_type>::value
-                   || std::is_same<std::uint32_t, limb_type>::value),
+                   || std::is_same<std::uint32_t, limb_type>::value
+                   || std::is_same<std::uint64_t, limb_type>::value),
                    "Error: limb_type (template parameter LimbType) "
-                   "must be one of uint8_t, uint16_t or uint32_t.");
+                   "must be one of uint8_t, uint16_t, uint32_t or uint64_t.");
 
     // Check the exponent type.
     static_assert((   std::is_same<std::int8_t,  exponent_type>::value
@@ -536,11 +583,15 @@
     static constexpr std::int32_t  decwide_t_radix          = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::radix;
     static constexpr std::int32_t  decwide_t_elem_digits10  = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::elem_digits10;
     static constexpr std::int32_t  decwide_t_elem_number    = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::elem_number;
-    static constexpr std::int32_t  decwide_t_elem_mask      = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::elem_mask;
-    static constexpr std::int32_t  decwide_t_elem_mask_half = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::elem_mask_half;
-    static constexpr std::int32_t  decwide_t_elem_mask_min1 = static_cast<std::int32_t>(decwide_t_elem_mask - static_cast<std::int32_t>(INT8_C(1)));
-    static constexpr std::int32_t  decwide_t_elems_for_kara = static_cast<std::int32_t>(INT32_C( 112) + INT32_C(1));
-    static constexpr std::int32_t  decwide_t_elems_for_fft  = static_cast<std::int32_t>(INT32_C(1792) + INT32_C(1));
+    using elem_mask_type = typename detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::elem_mask_type;
+
+    static constexpr elem_mask_type decwide_t_elem_mask      = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::elem_mask;
+    static constexpr elem_mask_type decwide_t_elem_mask_half = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::elem_mask_half;
+    static constexpr elem_mask_type decwide_t_elem_mask_min1 = static_cast<elem_mask_type>(decwide_t_elem_mask - static_cast<elem_mask_type>(INT8_C(1)));
+    static constexpr std::int32_t  decwide_t_elems_for_kara  = detail::decwide_t_mul_thresholds<LimbType, FftFloatType>::elems_for_kara;
+    static constexpr std::int32_t  decwide_t_elems_for_toom3 = detail::decwide_t_mul_thresholds<LimbType, FftFloatType>::elems_for_toom3;
+    static constexpr std::int32_t  decwide_t_elems_for_fft   = detail::decwide_t_mul_thresholds<LimbType, FftFloatType>::elems_for_fft;
+    static constexpr std::int32_t  decwide_t_elems_for_ntt   = detail::decwide_t_mul_thresholds<LimbType, FftFloatType>::elems_for_ntt;
 
     static constexpr exponent_type decwide_t_max_exp10      =  static_cast<exponent_type>(UINTMAX_C(1) << static_cast<unsigned>(std::numeric_limits<exponent_type>::digits - (std::is_same<exponent_type, std::int64_t>::value ? 4 : (std::is_same<exponent_type, std::int32_t>::value ? 3 : (std::is_same<exponent_type, std::int16_t>::value ? 2 : 1)))));
     static constexpr exponent_type decwide_t_min_exp10      = -static_cast<exponent_type>(decwide_t_max_exp10);
@@ -548,6 +599,32 @@
     static constexpr exponent_type decwide_t_min_exp        = decwide_t_min_exp10;
 
   private:
+    // Long division is used up to this number of limbs (see eval_div_long).
+    // It is faster than the reciprocal-based division below the Karatsuba
+    // threshold, except for 64-bit limbs, for which it is only faster
+    // up to about 256 decimal digits (measured on x86_64).
+    static constexpr std::int32_t  decwide_t_elems_for_div_long =
+      (std::min)
+      (
+        (std::min)(decwide_t_elem_number, static_cast<std::int32_t>(decwide_t_elems_for_kara - 1)),
+        std::is_same<LimbType, std::uint64_t>::value
+          ? static_cast<std::int32_t>(INT8_C(16))
+          : static_cast<std::int32_t>(static_cast<std::int32_t>(detail::eval_divide_max_points() * detail::eval_divide_point_digits10()) / decwide_t_elem_digits10)
+      );
+
+    // The number of inline limbs of a small-buffer representation
+    // (see detail::fixed_small_buffer_array), otherwise zero.
+    static constexpr std::int32_t  decwide_t_elems_inline =
+      (std::min)(decwide_t_elem_number, static_cast<std::int32_t>(detail::small_buffer_allocator_traits<AllocatorType>::small_count()));
+
+    // Operands having at most this number of significant limbs (in other
+    // words without their trailing zero limbs) are short. A multiplication
+    // with a short operand uses the linear kernel detail::mul_loop_n_by_m
+    // (see eval_mul_short). Values within the inline limbs are short,
+    // so the other multiplication kernels read only allocated limbs.
+    static constexpr std::int32_t  decwide_t_elems_for_short =
+      (std::max)((std::min)(decwide_t_elem_number, static_cast<std::int32_t>(INT8_C(16))), decwide_t_elems_inline);
+
     #if (defined(_MSC_VER) && (_MSC_VER < 1920))
     #else
     static constexpr auto is_void_allocator() noexcept -> bool { return std::is_same<AllocatorType, void>::value; }
@@ -570,7 +647,10 @@
     // Define the internal representation type of the data field
     // of a decwide_t. This can be either a statically or dynamically
     // allocated fixed-size array-like container depending on the
-    // nature of the allocator type being used.
+    // nature of the allocator type being used. The allocator type
+    // util::small_buffer_allocator selects a container with inline
+    // storage for its first limbs, which allocates only for values
+    // needing more limbs than these.
 
     using representation_type =
       #if (defined(_MSC_VER) && (_MSC_VER < 1920))
@@ -579,14 +659,29 @@
       typename std::conditional<is_void_allocator(),
       #endif
                                 detail::fixed_static_array <limb_type, static_cast<std::size_t>(decwide_t_elem_number)>,
-                                detail::fixed_dynamic_array<limb_type, static_cast<std::size_t>(decwide_t_elem_number), allocator_type>>::type;
+                                typename std::conditional<(detail::small_buffer_allocator_traits<allocator_type>::small_count() != static_cast<std::size_t>(UINT8_C(0))),
+                                                          detail::fixed_small_buffer_array<limb_type, static_cast<std::size_t>(decwide_t_elem_number), detail::small_buffer_allocator_traits<allocator_type>::small_count(), allocator_type>,
+                                                          detail::fixed_dynamic_array     <limb_type, static_cast<std::size_t>(decwide_t_elem_number), allocator_type>>::type>::type;
 
+    // The double limb of 64-bit limbs is an unsigned 128-bit integer
+    // (unsigned __int128 or a portable fallback, see detail::uint128_type).
     using double_limb_type =
-      typename std::conditional<std::is_same<limb_type, std::uint32_t>::value,
-                                std::uint64_t,
-                                typename std::conditional<std::is_same<limb_type, std::uint16_t>::value,
-                                                          std::uint32_t,
-                                                          std::uint16_t>::type>::type;
+      typename detail::uint_type_helper<static_cast<std::size_t>(std::numeric_limits<limb_type>::digits * 2)>::exact_unsigned_type;
+
+    // Check the multiplication thresholds. The column-wise schoolbook
+    // multiplication (used for 16-bit, 32-bit and 64-bit limbs) accumulates
+    // up to (decwide_t_elems_for_kara - 1) limb products in one double_limb_type.
+    // For 64-bit limbs, the 128-bit double limb holds more than 10^6 such
+    // products, which is far beyond any sensible Karatsuba threshold.
+    static_assert(   (decwide_t_elems_for_kara > static_cast<std::int32_t>(INT8_C(1)))
+                  && (decwide_t_elems_for_kara  <= decwide_t_elems_for_toom3)
+                  && (decwide_t_elems_for_toom3 <= decwide_t_elems_for_fft),
+                  "Error: The multiplication thresholds must be ordered as kara <= toom3 <= fft");
+
+    static_assert(   std::is_same<limb_type, std::uint8_t>::value
+                  || std::is_same<limb_type, std::uint64_t>::value
+                  || (static_cast<std::uintmax_t>(decwide_t_elems_for_kara - 1) <= static_cast<std::uintmax_t>(static_cast<std::uintmax_t>((std::numeric_limits<double_limb_type>::max)()) / static_cast<std::uintmax_t>(static_cast<std::uintmax_t>(static_cast<std::uintmax_t>(decwide_t_elem_mask - 1) * static_cast<std::uintmax_t>(decwide_t_elem_mask - 1)) + static_cast<std::uintmax_t>(decwide_t_elem_mask)))),
+                  "Error: The schoolbook multiplication would overflow below the Karatsuba threshold");
 
     using signed_limb_type = typename std::make_signed<limb_type>::type;
 
@@ -647,7 +742,8 @@
         my_exp      (static_cast<exponent_type>(INT8_C(0))),
         my_neg      (false),
         my_fpclass  (fpclass_type::decwide_t_finite),
-        my_prec_elem(decwide_t_elem_number) { }
+        my_prec_elem(decwide_t_elem_number),
+        my_used_elem(static_cast<std::int32_t>(INT8_C(0))) { }
 
     // Constructors from built-in unsigned integral types.
     template<typename UnsignedIntegralType,
@@ -659,7 +755,8 @@
         my_exp      (static_cast<exponent_type>(INT8_C(0))),
         my_neg      (false),
         my_fpclass  (fpclass_type::decwide_t_finite),
-        my_prec_elem(decwide_t_elem_number)
+        my_prec_elem(decwide_t_elem_number),
+        my_used_elem(static_cast<std::int32_t>(INT8_C(0)))
     {
       const auto u_is_less_than_mask =
         (static_cast<limb_type>(u) < static_cast<limb_type>(decwide_t_elem_mask));
@@ -669,6 +766,8 @@
       if(u_is_less_than_mask)
       {
         my_data[static_cast<local_size_type>(UINT8_C(0))] = static_cast<limb_type>(u);
+
+        my_used_elem = ((u != static_cast<UnsignedIntegralType>(UINT8_C(0))) ? static_cast<std::int32_t>(INT8_C(1)) : static_cast<std::int32_t>(INT8_C(0)));
       }
       else
       {
@@ -676,6 +775,9 @@
         my_data[static_cast<local_size_type>(UINT8_C(1))] = static_cast<limb_type>(u % static_cast<limb_type>(decwide_t_elem_mask));
 
         my_exp = static_cast<exponent_type>(decwide_t_elem_digits10);
+
+        my_used_elem =
+          ((my_data[static_cast<local_size_type>(UINT8_C(1))] != static_cast<limb_type>(UINT8_C(0))) ? static_cast<std::int32_t>(INT8_C(2)) : static_cast<std::int32_t>(INT8_C(1)));
       }
     }
 
@@ -688,7 +790,8 @@
                                               my_exp      (static_cast<exponent_type>(INT8_C(0))),
                                               my_neg      (false),
                                               my_fpclass  (fpclass_type::decwide_t_finite),
-                                              my_prec_elem(decwide_t_elem_number)
+                                              my_prec_elem(decwide_t_elem_number),
+                                              my_used_elem(static_cast<std::int32_t>(INT8_C(0)))
     {
       from_unsigned_long_long(u);
     }
@@ -701,7 +804,8 @@
                                             my_exp      (static_cast<exponent_type>(INT8_C(0))),
                                             my_neg      (n < static_cast<signed long long>(INT8_C(0))), // NOLINT(google-runtime-int)
                                             my_fpclass  (fpclass_type::decwide_t_finite),
-                                            my_prec_elem(decwide_t_elem_number)
+                                            my_prec_elem(decwide_t_elem_number),
+                                            my_used_elem(static_cast<std::int32_t>(INT8_C(0)))
     {
       const auto u =
         static_cast<unsigned long long> // NOLINT(google-runtime-int)
@@ -720,7 +824,8 @@
                                            my_exp      (static_cast<exponent_type>(INT8_C(0))),
                                            my_neg      (false),
                                            my_fpclass  (fpclass_type::decwide_t_finite),
-                                           my_prec_elem(decwide_t_elem_number)
+                                           my_prec_elem(decwide_t_elem_number),
+                                           my_used_elem(static_cast<std::int32_t>(INT8_C(0)))
     {
       from_builtin_float_type(f);
     }
@@ -731,7 +836,8 @@
                                         my_exp      (static_cast<exponent_type>(INT8_C(0))),
                                         my_neg      (false),
                                         my_fpclass  (fpclass_type::decwide_t_finite),
-                                        my_prec_elem(decwide_t_elem_number)
+                                        my_prec_elem(decwide_t_elem_number),
+                                        my_used_elem(static_cast<std::int32_t>(INT8_C(0)))
     {
       static_cast<void>(rd_string(s));
     }
@@ -743,14 +849,16 @@
                                                   my_exp      (other.my_exp),
                                                   my_neg      (other.my_neg),
                                                   my_fpclass  (other.my_fpclass),
-                                                  my_prec_elem(other.my_prec_elem) { }
+                                                  my_prec_elem(other.my_prec_elem),
+                                                  my_used_elem(other.my_used_elem) { }
 
     // Move constructor.
     constexpr decwide_t(decwide_t&& other) noexcept : my_data     (static_cast<representation_type&&>(other.my_data)),
                                                       my_exp      (other.my_exp),
                                                       my_neg      (other.my_neg),
                                                       my_fpclass  (other.my_fpclass),
-                                                      my_prec_elem(other.my_prec_elem) { }
+                                                      my_prec_elem(other.my_prec_elem),
+                                                      my_used_elem(other.my_used_elem) { }
 
     // Constructor from floating-point class type, even though
     // (at the moment) decwide_t instances can only be finite.
@@ -759,7 +867,8 @@
         my_exp      (static_cast<exponent_type>(INT8_C(0))),
         my_neg      (false),
         my_fpclass  (fpclass_type::decwide_t_finite),
-        my_prec_elem(decwide_t_elem_number) { }
+        my_prec_elem(decwide_t_elem_number),
+        my_used_elem(static_cast<std::int32_t>(INT8_C(0))) { }
 
   private:
     // Constructor from mantissa and exponent.
@@ -769,7 +878,8 @@
         my_exp      (static_cast<exponent_type>(INT8_C(0))),
         my_neg      (false),
         my_fpclass  (fpclass_type::decwide_t_finite),
-        my_prec_elem(decwide_t_elem_number)
+        my_prec_elem(decwide_t_elem_number),
+        my_used_elem(static_cast<std::int32_t>(INT8_C(0)))
     {
       // Create a decwide_t from mantissa and exponent.
       // This constructor is, in fact, intended to maintain
@@ -872,6 +982,8 @@
         std::fill(my_data.begin() + static_cast<std::ptrdiff_t>(limb_index),
                   my_data.end(),
                   static_cast<limb_type>(UINT8_C(0)));
+
+        eval_set_used_elems(static_cast<std::int32_t>(limb_index));
       }
     }
 
@@ -888,6 +1000,7 @@
         my_neg       = other.my_neg;
         my_fpclass   = other.my_fpclass;
         my_prec_elem = other.my_prec_elem;
+        my_used_elem = other.my_used_elem;
       }
 
       return *this;
@@ -901,22 +1014,26 @@
       my_neg       = other.my_neg;
       my_fpclass   = other.my_fpclass;
       my_prec_elem = other.my_prec_elem;
+      my_used_elem = other.my_used_elem;
 
       return *this;
     }
 
-    WIDE_DECIMAL_NODISCARD auto  representation()       noexcept ->       representation_type& { return my_data; }
+    WIDE_DECIMAL_NODISCARD auto  representation()       noexcept ->       representation_type&
+    {
+      // The limbs might be changed through the returned reference,
+      // so any of these is considered to be used from now on.
+      my_used_elem = decwide_t_elem_number;
+
+      return my_data;
+    }
+
     WIDE_DECIMAL_NODISCARD auto  representation() const noexcept -> const representation_type& { return my_data; }
     WIDE_DECIMAL_NODISCARD auto crepresentation() const noexcept -> const representation_type& { return my_data; }
 
     // Binary arithmetic operators.
     auto operator+=(const decwide_t& v) -> decwide_t& // NOLINT(readability-function-cognitive-complexity)
     {
-      // TBD: Eliminate the temporary storage array my_n_data_for_add_sub.
-
-      // TBD: Limit the length of add/sub to only those ranges needed,
-      // whereby propagate borrow/carry may be necessary as well.
-
       if(iszero())
       {
         return operator=(v);
@@ -966,115 +1083,111 @@
                                    : -static_cast<std::int32_t>(ofs_exp.get_value_unsigned() / static_cast<unsigned_exponent_type>(decwide_t_elem_digits10)))
         );
 
-      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
-      representation_type my_n_data_for_add_sub;
-      #endif
+      // The add/sub operation is done in place. The operand having the smaller
+      // exponent is added to (or subtracted from) the other one with an offset
+      // of ofs limbs, only over the range in which the two operands overlap.
+      // The carry (or the borrow) is then propagated through the leading limbs
+      // only as far as needed. If *this has the smaller exponent, its data
+      // are first shifted down by ofs limbs within the precision.
+
+      // The limbs of the result at and beyond this index are zero
+      // (within the precision, and beyond it these are unchanged).
+      auto used_elems_max =
+        (std::max)
+        (
+          my_used_elem,
+          (std::min)
+          (
+            static_cast<std::int32_t>
+            (
+              (ofs >= static_cast<std::int32_t>(INT8_C(0)))
+                ? static_cast<std::int32_t>(ofs + v.my_used_elem)
+                : (std::max)(static_cast<std::int32_t>(my_used_elem - ofs), v.my_used_elem)
+            ),
+            prec_elems_for_add_sub
+          )
+        );
+
+      // Only the limbs up to the bound of the used limbs within the precision
+      // are touched. So short values remain within the inline limbs of
+      // a small-buffer representation.
+      const auto used_elems_ext = (std::min)(used_elems_max, prec_elems_for_add_sub);
+
+      using local_iterator_type = typename representation_type::iterator;
+
+      const auto shift_down_within_precision =
+        [](local_iterator_type p, const std::int32_t n_shift, const std::int32_t n_ext) // NOLINT(modernize-use-trailing-return-type,performance-unnecessary-value-param)
+        {
+          std::copy_backward(p,
+                             p + static_cast<std::ptrdiff_t>(n_ext - n_shift),
+                             p + static_cast<std::ptrdiff_t>(n_ext));
+        };
 
       if(my_neg == v.my_neg)
       {
-        auto carry = limb_type { };
+        // Add v to *this.
+        auto carry = std::int_fast8_t { };
 
-        // Add v to *this, where the data array of either *this or v
-        // might have to be treated with a positive, negative or zero offset.
-        // The result is stored in *this. The data are added one element
-        // at a time, each element with carry.
         if(ofs >= static_cast<std::int32_t>(INT8_C(0)))
         {
-          std::copy(v.my_data.cbegin(),
-                    v.my_data.cend() - static_cast<std::ptrdiff_t>(ofs),
-                    my_n_data_for_add_sub.begin() + static_cast<std::ptrdiff_t>(ofs));
-
-          std::fill(my_n_data_for_add_sub.begin(),
-                    my_n_data_for_add_sub.begin() + static_cast<std::ptrdiff_t>(ofs),
-                    static_cast<limb_type>(UINT8_C(0)));
-
-          using const_limb_pointer_type = typename std::add_const<limb_type*>::type;
-
-          // Addition.
-          carry = detail::eval_add_n(my_data.data(),
-                                     static_cast<const_limb_pointer_type>(my_data.data()),
-                                     static_cast<const_limb_pointer_type>(my_n_data_for_add_sub.data()),
-                                     prec_elems_for_add_sub);
+          carry = eval_accumulate_elems(v, ofs, static_cast<std::int32_t>(prec_elems_for_add_sub - ofs), false);
         }
         else
         {
-          std::copy(my_data.cbegin(),
-                    my_data.cend() + static_cast<std::ptrdiff_t>(ofs), // LCOV_EXCL_LINE
-                    my_n_data_for_add_sub.begin() - static_cast<std::ptrdiff_t>(ofs));
-
-          // LCOV_EXCL_START
-          std::fill(my_n_data_for_add_sub.begin(),
-                    my_n_data_for_add_sub.begin() - static_cast<std::ptrdiff_t>(ofs),
-                    static_cast<limb_type>(UINT8_C(0)));
-          // LCOV_EXCL_STOP
+          // In this case, |u| < |v|. The leading limbs
+          // of the result are those of v plus the carry.
+          auto p_data = detail::elems_begin(my_data, used_elems_ext);
 
-          using const_limb_pointer_type = typename std::add_const<limb_type*>::type;
+          shift_down_within_precision(p_data, -ofs, used_elems_ext);
 
-          // Addition.
-          // LCOV_EXCL_START
-          carry = detail::eval_add_n(my_n_data_for_add_sub.data(),
-                                     const_cast<const_limb_pointer_type>(my_n_data_for_add_sub.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
-                                     const_cast<const_limb_pointer_type>(v.my_data.data()),             // NOLINT(cppcoreguidelines-pro-type-const-cast)
-                                     prec_elems_for_add_sub);
-          // LCOV_EXCL_STOP
-
-          #if (defined(__GNUC__) && !defined(__clang__))
-          #if(__GNUC__ >= 12)
-          #pragma GCC diagnostic push
-          #pragma GCC diagnostic ignored "-Warray-bounds"
-          #pragma GCC diagnostic push
-          #pragma GCC diagnostic ignored "-Wrestrict"
-          #endif
-          #if(__GNUC__ >= 8)
-          #pragma GCC diagnostic push
-          #pragma GCC diagnostic ignored "-Wstringop-overflow="
-          #endif
-          #endif
+          std::copy(v.my_data.cbegin(),
+                    v.my_data.cbegin() + static_cast<std::ptrdiff_t>(-ofs),
+                    p_data);
 
-          std::copy(static_cast<const_limb_pointer_type>(my_n_data_for_add_sub.data()),
-                    static_cast<const_limb_pointer_type>(my_n_data_for_add_sub.data()) + static_cast<std::ptrdiff_t>(prec_elems_for_add_sub),
-                    my_data.data());
+          // The trailing zero limbs of v leave the limbs of *this unchanged.
+          const auto v_elems_to_add =
+            (std::max)
+            (
+              static_cast<std::int32_t>(v.eval_significant_elems(prec_elems_for_add_sub) + ofs),
+              static_cast<std::int32_t>(INT8_C(0))
+            );
 
-          #if (defined(__GNUC__) && !defined(__clang__))
-          #if(__GNUC__ >= 12)
-          #pragma GCC diagnostic pop
-          #pragma GCC diagnostic pop
-          #endif
-          #if(__GNUC__ >= 8)
-          #pragma GCC diagnostic pop
-          #endif
-          #endif
+          carry = detail::eval_accumulate_n(p_data,
+                                            -ofs,
+                                            v.my_data.cbegin() + static_cast<std::ptrdiff_t>(-ofs),
+                                            v_elems_to_add,
+                                            false);
 
           my_exp = v.my_exp;
         }
 
-        if(carry != static_cast<limb_type>(UINT8_C(0)))
+        if(carry != static_cast<std::int_fast8_t>(INT8_C(0)))
         {
           // There needs to be a carry into the element -1 of the array data.
           // But since this can't be done, shift the data to make place for the
           // carry result and adjust the exponent accordingly.
+          const auto carry_elems_ext =
+            (std::min)(static_cast<std::int32_t>(used_elems_ext + static_cast<std::int32_t>(INT8_C(1))), prec_elems_for_add_sub);
 
-          const auto offset_to_end =
-            static_cast<std::ptrdiff_t>
-            (
-                static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(my_data.size()) - static_cast<std::ptrdiff_t>(prec_elems_for_add_sub))
-              + static_cast<std::ptrdiff_t>(INT8_C(1))
-            );
-
-          std::copy_backward(my_data.cbegin(),
-                             my_data.cend() - offset_to_end,
-                             my_data.end());
+          auto p_data = detail::elems_begin(my_data, carry_elems_ext);
 
-          using local_size_type = typename representation_type::size_type;
+          shift_down_within_precision(p_data, static_cast<std::int32_t>(INT8_C(1)), carry_elems_ext);
 
-          my_data[static_cast<local_size_type>(UINT8_C(0))] = carry;
+          *p_data = static_cast<limb_type>(UINT8_C(1));
 
           my_exp =
             static_cast<exponent_type>
             (
               my_exp + static_cast<exponent_type>(decwide_t_elem_digits10)
             );
+
+          if(used_elems_max < prec_elems_for_add_sub)
+          {
+            ++used_elems_max;
+          }
         }
+
+        eval_set_used_elems(used_elems_max);
       }
       else
       {
@@ -1082,131 +1195,105 @@
         // might have to be treated with a positive, negative or zero offset.
         if(       (ofs >  static_cast<std::int32_t>(INT8_C(0)))
            || (   (ofs == static_cast<std::int32_t>(INT8_C(0)))
-               && (detail::compare_ranges(  my_data.data(),
-                                          v.my_data.data(),
-                                          static_cast<std::uint_fast32_t>(prec_elems_for_add_sub)) > static_cast<std::int_fast8_t>(INT8_C(0)))))
+               && (eval_compare_elems(v, prec_elems_for_add_sub) > static_cast<std::int_fast8_t>(INT8_C(0)))))
         {
-          // In this case, |u| > |v| and ofs is positive.
-          // Copy the data of v, shifted down to a lower value
-          // into the data array m_n. Set the operand pointer p_v
-          // to point to the copied, shifted data m_n.
-          std::copy(v.my_data.cbegin(),
-                    v.my_data.cend() - static_cast<std::ptrdiff_t>(ofs),
-                    my_n_data_for_add_sub.begin() + static_cast<std::ptrdiff_t>(ofs));
-
-          std::fill(my_n_data_for_add_sub.begin(),
-                    my_n_data_for_add_sub.begin() + static_cast<std::ptrdiff_t>(ofs),
-                    static_cast<limb_type>(UINT8_C(0)));
-
-          using const_limb_pointer_type = typename std::add_const<limb_type*>::type;
-
-          // Subtraction.
-          const auto has_borrow =
-            detail::eval_subtract_n(my_data.data(),
-                                    static_cast<const_limb_pointer_type>(my_data.data()),
-                                    static_cast<const_limb_pointer_type>(my_n_data_for_add_sub.data()),
-                                    prec_elems_for_add_sub);
+          // In this case, |u| > |v| and ofs is positive or zero.
+          // There is no borrow out of the leading limb.
+          const auto has_borrow = eval_accumulate_elems(v, ofs, static_cast<std::int32_t>(prec_elems_for_add_sub - ofs), true);
 
           static_cast<void>(has_borrow);
         }
         else
         {
+          // In this case, |u| <= |v| and ofs is negative or zero.
+          // Compute v - u over the overlapping range in place.
+          // The leading limbs of the result are those of v
+          // minus the borrow.
+          auto p_data = detail::elems_begin(my_data, used_elems_ext);
+
           if(ofs != static_cast<std::int32_t>(INT8_C(0)))
           {
-            // In this case, |u| < |v| and ofs is negative.
-            // Shift the data of u down to a lower value.
-            std::copy_backward(my_data.cbegin(),
-                               my_data.cend() - static_cast<std::ptrdiff_t>(-ofs),
-                               my_data.end());
-
-            std::fill(my_data.begin(),
-                      my_data.begin() + static_cast<std::ptrdiff_t>(-ofs),
-                      static_cast<limb_type>(UINT8_C(0)));
+            shift_down_within_precision(p_data, -ofs, used_elems_ext);
           }
 
-          // Copy the data of v into the data array my_n_data_for_add_sub.
-          // Set the u-pointer p_u to point to m_n and the
-          // operand pointer p_v to point to the shifted
-          // data m_data.
-          std::copy(v.my_data.cbegin(),
-                    v.my_data.cbegin() + static_cast<std::ptrdiff_t>(prec_elems_for_add_sub),
-                    my_n_data_for_add_sub.begin());
-
-          using const_limb_pointer_type = typename std::add_const<limb_type*>::type;
-
-          // Subtraction.
           const auto has_borrow =
-            detail::eval_subtract_n(my_n_data_for_add_sub.data(),
-                                    static_cast<const_limb_pointer_type>(my_n_data_for_add_sub.data()),
-                                    static_cast<const_limb_pointer_type>(my_data.data()),
-                                    prec_elems_for_add_sub);
+            detail::eval_subtract_n(  p_data           + static_cast<std::ptrdiff_t>(-ofs),
+                                    v.my_data.cbegin() + static_cast<std::ptrdiff_t>(-ofs),
+                                      my_data.cbegin() + static_cast<std::ptrdiff_t>(-ofs),
+                                    static_cast<std::int32_t>(used_elems_ext + ofs));
 
-          static_cast<void>(has_borrow);
+          std::copy(v.my_data.cbegin(),
+                    v.my_data.cbegin() + static_cast<std::ptrdiff_t>(-ofs),
+                    p_data);
 
-          std::copy(my_n_data_for_add_sub.cbegin(),
-                    my_n_data_for_add_sub.cbegin() + static_cast<std::ptrdiff_t>(prec_elems_for_add_sub),
-                    my_data.begin());
+          detail::eval_multiply_kara_propagate_borrow(p_data,
+                                                      static_cast<std::uint_fast32_t>(-ofs),
+                                                      has_borrow);
 
           my_exp  = v.my_exp;
           my_neg  = v.my_neg;
         }
 
-        // Is it necessary to justify the data?
+        eval_set_used_elems(used_elems_max);
+
+        // Is it necessary to justify the data? The limbs within
+        // the precision at and beyond used_elems_in_prec are zero.
+        const auto used_elems_in_prec = (std::min)(my_used_elem, prec_elems_for_add_sub);
+
+        auto p_data = detail::elems_begin(my_data, used_elems_in_prec);
+
         const auto first_nonzero_elem = // NOLINT(llvm-qualified-auto,readability-qualified-auto)
-          std::find_if(my_data.cbegin(),
-                       my_data.cbegin() + static_cast<std::ptrdiff_t>(prec_elems_for_add_sub),
+          std::find_if(p_data,
+                       p_data + static_cast<std::ptrdiff_t>(used_elems_in_prec),
                        [](const limb_type& d) // NOLINT(modernize-use-trailing-return-type)
                        {
                          return (d != static_cast<limb_type>(UINT8_C(0)));
                        });
 
-        if(first_nonzero_elem != my_data.cbegin())
+        if(first_nonzero_elem == (p_data + static_cast<std::ptrdiff_t>(used_elems_in_prec)))
         {
-          if(first_nonzero_elem == (my_data.cbegin() + static_cast<std::ptrdiff_t>(prec_elems_for_add_sub)))
+          // This result of the subtraction is exactly zero (within precision).
+          // Reset the sign and the exponent.
+          my_neg = false;
+          my_exp = static_cast<exponent_type>(INT8_C(0));
+
+          // Check for underflow.
+          if(my_used_elem == static_cast<std::int32_t>(INT8_C(0)))
           {
-            // This result of the subtraction is exactly zero (within precision).
-            // Reset the sign and the exponent.
-            my_neg = false;
-            my_exp = static_cast<exponent_type>(INT8_C(0));
+            static_cast<void>
+            (
+              operator=(zero<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>())
+            );
           }
-          else
-          {
-            // Justify the data
-            const auto sj = std::distance(my_data.cbegin(), first_nonzero_elem);
+        }
+        else if(first_nonzero_elem != p_data)
+        {
+          // Justify the data within the precision.
+          const auto sj = std::distance(p_data, first_nonzero_elem);
 
-            std::copy(my_data.cbegin() + sj,
-                      my_data.cend(),
-                      my_data.begin());
+          std::copy(p_data + sj,
+                    p_data + static_cast<std::ptrdiff_t>(used_elems_in_prec),
+                    p_data);
 
-            std::fill(my_data.end() - sj,
-                      my_data.end(),
-                      static_cast<limb_type>(UINT8_C(0)));
+          std::fill(p_data + static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(used_elems_in_prec) - sj),
+                    p_data + static_cast<std::ptrdiff_t>(used_elems_in_prec),
+                    static_cast<limb_type>(UINT8_C(0)));
 
-            my_exp =
-              static_cast<exponent_type>
-              (
-                  my_exp
-                - static_cast<exponent_type>
-                  (
-                      static_cast<exponent_type>(sj)
-                    * static_cast<exponent_type>(decwide_t_elem_digits10)
-                  )
-              );
+          if(my_used_elem <= prec_elems_for_add_sub)
+          {
+            my_used_elem = static_cast<std::int32_t>(my_used_elem - static_cast<std::int32_t>(sj));
           }
-        }
 
-        // Check for underflow.
-        if(std::all_of(my_data.cbegin(),
-                       my_data.cend(),
-                       [](const limb_type& d) // NOLINT(modernize-use-trailing-return-type)
-                       {
-                         return (d == static_cast<limb_type>(UINT8_C(0)));
-                       }))
-        {
-          static_cast<void>
-          (
-            operator=(zero<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>())
-          );
+          my_exp =
+            static_cast<exponent_type>
+            (
+                my_exp
+              - static_cast<exponent_type>
+                (
+                    static_cast<exponent_type>(sj)
+                  * static_cast<exponent_type>(decwide_t_elem_digits10)
+                )
+            );
         }
       }
 
@@ -1220,6 +1307,210 @@
     }
 
     auto operator*=(const decwide_t& v) -> decwide_t&
+    {
+      return eval_mul_signed(v, nullptr);
+    }
+
+    // A prepared multiplier holds a copy of a multiplicand along with
+    // its cached forward FFT (or its padded copy for Karatsuba and
+    // Toom-Cook 3-way multiplication). It is intended for multiplying
+    // many operands by one and the same value, such as pi or ln2.
+    class prepared_multiplier;
+
+    auto operator*=(const prepared_multiplier& p) -> decwide_t&
+    {
+      return eval_mul_signed(p.value(), &p);
+    }
+
+    friend auto operator*(const decwide_t& u, const prepared_multiplier& p) -> decwide_t
+    {
+      return decwide_t(u) *= p;
+    }
+
+    // Free the FFT plan (for FftFloatType), the NTT twiddle tables and
+    // the scratch arenas of the multiplication kernels cached by the
+    // calling thread. These are otherwise kept for the lifetime of
+    // the thread, up to detail::mul_transform_cache_max_points().
+    static auto release_multiplication_caches() -> void
+    {
+      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+      detail::fft::fft_plan_cache_release<fft_float_type>();
+
+      detail::scratch_arena_release<limb_type>();
+      detail::scratch_arena_release<std::uint32_t>();
+
+      detail::ntt::ntt_plan_cache_release<detail::ntt::ntt_prime_0>();
+      detail::ntt::ntt_plan_cache_release<detail::ntt::ntt_prime_1>();
+      detail::ntt::ntt_plan_cache_release<detail::ntt::ntt_prime_2>();
+      #endif
+    }
+
+    // Get the numbers of hits and misses of the reciprocal cache used
+    // in division by the calling thread. The cache is enabled with the
+    // macro WIDE_DECIMAL_DIV_RECIPROCAL_CACHE_SIZE (its number of
+    // entries). Otherwise both counts are zero.
+    static auto reciprocal_cache_hits() -> std::uint64_t
+    {
+      #if defined(WIDE_DECIMAL_DIV_RECIPROCAL_CACHE_SIZE)
+      return div_reciprocal_cache_instance().hits;
+      #else
+      return static_cast<std::uint64_t>(UINT8_C(0));
+      #endif
+    }
+
+    static auto reciprocal_cache_misses() -> std::uint64_t
+    {
+      #if defined(WIDE_DECIMAL_DIV_RECIPROCAL_CACHE_SIZE)
+      return div_reciprocal_cache_instance().misses;
+      #else
+      return static_cast<std::uint64_t>(UINT8_C(0));
+      #endif
+    }
+
+    // Free the entries of the reciprocal cache of the calling thread
+    // and reset its counters.
+    static auto release_reciprocal_cache() -> void
+    {
+      #if defined(WIDE_DECIMAL_DIV_RECIPROCAL_CACHE_SIZE)
+      div_reciprocal_cache_instance().clear();
+      #endif
+    }
+
+    // Get the number of multiplications by the calling thread which
+    // used the multiplication kernels (rather than the linear kernel
+    // for a short operand), and the number of these which used the
+    // squaring paths of the kernels. The counters are enabled with
+    // the macro WIDE_DECIMAL_MUL_COUNTERS. Otherwise both counts are zero.
+    static auto multiplication_kernel_count() -> std::uint64_t
+    {
+      #if defined(WIDE_DECIMAL_MUL_COUNTERS)
+      return mul_counters_instance().kernels;
+      #else
+      return static_cast<std::uint64_t>(UINT8_C(0));
+      #endif
+    }
+
+    static auto multiplication_square_count() -> std::uint64_t
+    {
+      #if defined(WIDE_DECIMAL_MUL_COUNTERS)
+      return mul_counters_instance().squares;
+      #else
+      return static_cast<std::uint64_t>(UINT8_C(0));
+      #endif
+    }
+
+    // Reset the multiplication counters of the calling thread.
+    static auto reset_multiplication_counters() -> void
+    {
+      #if defined(WIDE_DECIMAL_MUL_COUNTERS)
+      mul_counters_instance() = mul_counters { };
+      #endif
+    }
+
+  private:
+    #if defined(WIDE_DECIMAL_MUL_COUNTERS)
+    struct mul_counters
+    {
+      std::uint64_t kernels { };
+      std::uint64_t squares { };
+    };
+
+    static auto mul_counters_instance() -> mul_counters&
+    {
+      static thread_local mul_counters my_counters { };
+
+      return my_counters;
+    }
+    #endif
+
+    #if defined(WIDE_DECIMAL_DIV_RECIPROCAL_CACHE_SIZE)
+    static auto div_reciprocal_cache_instance() -> detail::div_reciprocal_cache<decwide_t>&
+    {
+      // The cache is kept per type and per thread, so that
+      // concurrent divisions do not share (or lock) its entries.
+      static thread_local detail::div_reciprocal_cache<decwide_t> my_cache { };
+
+      return my_cache;
+    }
+
+    WIDE_DECIMAL_NODISCARD auto div_reciprocal_cache_hash() const -> std::uint64_t
+    {
+      // Hash the exponent, the sign and the limbs (FNV-1a).
+      constexpr auto fnv_prime = static_cast<std::uint64_t>(UINT64_C(0x100000001B3));
+
+      auto hash = static_cast<std::uint64_t>(UINT64_C(0xCBF29CE484222325));
+
+      hash = static_cast<std::uint64_t>(static_cast<std::uint64_t>(hash ^ static_cast<std::uint64_t>(my_exp)) * fnv_prime);
+      hash = static_cast<std::uint64_t>(static_cast<std::uint64_t>(hash ^ static_cast<std::uint64_t>(my_neg ? 1U : 0U)) * fnv_prime);
+
+      for(const auto& limb : my_data)
+      {
+        hash = static_cast<std::uint64_t>(static_cast<std::uint64_t>(hash ^ static_cast<std::uint64_t>(limb)) * fnv_prime);
+      }
+
+      return hash;
+    }
+
+    WIDE_DECIMAL_NODISCARD auto eval_div_reciprocal_cache_is_applicable(const decwide_t& v) const -> bool
+    {
+      // The reciprocal cache is used for finite, nonzero divisors other
+      // than +-1, if both operands have full precision. Divisions with
+      // reduced precision (such as within Newton iterations) bypass it.
+      return
+      (
+           (v.my_fpclass == fpclass_type::decwide_t_finite)
+        && (!v.iszero())
+        && (!isone_sign_neutral(v))
+        && (my_prec_elem   == decwide_t_elem_number)
+        && (v.my_prec_elem == decwide_t_elem_number)
+      );
+    }
+
+    auto eval_div_reciprocal_cache(const decwide_t& v) -> decwide_t&
+    {
+      // Multiply *this by the cached reciprocal of v, if v is one
+      // of the recently used divisors of this thread. Otherwise,
+      // compute the reciprocal and store it in place of the oldest entry.
+      auto& my_cache = div_reciprocal_cache_instance();
+
+      const auto hash = v.div_reciprocal_cache_hash();
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < my_cache.used; ++i)
+      {
+        const decwide_t& vi = my_cache.values[i];
+
+        const auto is_hit =
+          (   (my_cache.hashes[i] == hash)
+           && (vi.my_exp == v.my_exp)
+           && (vi.my_neg == v.my_neg)
+           && (vi.eval_compare_elems(v, decwide_t_elem_number) == static_cast<std::int_fast8_t>(INT8_C(0))));
+
+        if(is_hit)
+        {
+          ++my_cache.hits;
+
+          return operator*=(my_cache.inverses[i]);
+        }
+      }
+
+      ++my_cache.misses;
+
+      const auto index = my_cache.next;
+
+      my_cache.values  [index] = v;
+      my_cache.inverses[index] = v;
+      my_cache.hashes  [index] = hash;
+
+      static_cast<void>(my_cache.inverses[index].calculate_inv());
+
+      my_cache.next = static_cast<std::size_t>(static_cast<std::size_t>(index + 1U) % my_cache.cache_size);
+      my_cache.used = (std::max)(my_cache.used, static_cast<std::size_t>(index + 1U));
+
+      return operator*=(my_cache.inverses[index]);
+    }
+    #endif
+
+    auto eval_mul_signed(const decwide_t& v, const prepared_multiplier* p_prepared) -> decwide_t&
     {
       // Handle multiplication by zero.
       if(iszero() || v.iszero())
@@ -1288,7 +1579,32 @@
           #endif
           #endif
 
-          eval_mul_dispatch_multiplication_method(v, prec_elems_for_multiply);
+          if(eval_mul_short(v, prec_elems_for_multiply))
+          {
+            // The product of a short operand has been computed
+            // with the linear kernel.
+          }
+          else
+          {
+            #if defined(WIDE_DECIMAL_MUL_COUNTERS)
+            ++mul_counters_instance().kernels;
+
+            if(this == &v)
+            {
+              ++mul_counters_instance().squares;
+            }
+            #endif
+
+            if((p_prepared == nullptr) || (!eval_mul_prepared(*p_prepared, prec_elems_for_multiply)))
+            {
+              // The multiplication kernels use their squaring paths
+              // if the operands are the same object (this == &v).
+              eval_mul_dispatch_multiplication_method(v, prec_elems_for_multiply);
+            }
+
+            // The kernels store the product in the limbs within the precision.
+            eval_set_used_elems((std::max)(my_used_elem, prec_elems_for_multiply));
+          }
 
           #if (defined(__GNUC__) && !defined(__clang__))
           #if(__GNUC__ >= 12)
@@ -1307,22 +1623,350 @@
       return *this;
     }
 
-    auto operator/=(const decwide_t& v) -> decwide_t&
+    WIDE_DECIMAL_NODISCARD auto eval_div_long_is_applicable(const decwide_t& v) const -> bool
     {
-      const auto u_and_v_are_identical =
-        (   (my_fpclass == v.my_fpclass)
-         && (my_exp     == v.my_exp)
-         && (detail::compare_ranges(  my_data.data(),
-                                    v.my_data.data(),
-                                    static_cast<std::uint_fast32_t>(decwide_t_elem_number)) == static_cast<std::int_fast8_t>(INT8_C(0))));
+      // Long division is used for small precisions, where it is faster
+      // than the division with the reciprocal. It is not used
+      // for zero operands or for the trivial divisors +-1.
+      // These are handled by the multiplication with the reciprocal.
 
-      if(u_and_v_are_identical)
-      {
-        const auto negate_one = (my_neg != v.my_neg);
+      const auto prec_elems = (std::min)(my_prec_elem, v.my_prec_elem);
 
-        static_cast<void>
-        (
-          operator=(one<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>())
+      return
+      (
+           (!iszero())
+        && (!v.iszero())
+        && (!isone_sign_neutral(v))
+        && (prec_elems <= decwide_t_elems_for_div_long)
+      );
+    }
+
+    auto eval_div_long(const decwide_t& v) -> decwide_t&
+    {
+      // Divide *this by v with long division (see
+      // detail::eval_divide_n_by_n). Two quotient limbs beyond the
+      // precision are computed: one for a potential leading zero and
+      // one for rounding the result to nearest. No reciprocal of v
+      // and no decwide_t temporaries are needed.
+
+      const auto prec_elems = (std::min)(my_prec_elem, v.my_prec_elem);
+
+      const auto b_result_is_neg = (my_neg != v.my_neg);
+
+      // Set the exponent of the result.
+      using local_unsigned_wrap_type = detail::unsigned_wrap<unsigned_exponent_type, exponent_type>;
+
+      const auto u_exp = local_unsigned_wrap_type {   my_exp };
+      const auto v_exp = local_unsigned_wrap_type { v.my_exp };
+
+      const auto result_exp = u_exp - v_exp;
+
+      if((!result_exp.get_is_neg()) && (result_exp.get_value_unsigned() >= decwide_t_max_exp10))
+      {
+        // Check for (and handle overflow).
+        static_cast<void>(operator=(my_value_max()));
+      }
+      else if((result_exp.get_is_neg()) && (result_exp.get_value_unsigned() >= decwide_t_max_exp10))
+      {
+        // Check for (and handle underflow).
+        static_cast<void>(operator=(my_value_min()));
+      }
+      else
+      {
+        my_exp =
+          static_cast<exponent_type>
+          (
+            (!result_exp.get_is_neg())
+              ?                static_cast<exponent_type>(result_exp.get_value_unsigned())
+              : detail::negate(static_cast<exponent_type>(result_exp.get_value_unsigned()))
+          );
+
+        // The pool holds the points of the running remainder and of the
+        // normalized divisor. It is small, so it is kept on the stack,
+        // as is the quotient.
+        constexpr auto q_count_max = static_cast<std::int32_t>(decwide_t_elems_for_div_long + static_cast<std::int32_t>(INT8_C(2)));
+
+        std::array<std::int64_t, static_cast<std::size_t>(detail::eval_divide_workspace<limb_type>(decwide_t_elems_for_div_long, q_count_max))> my_div_long_pool; // NOLINT(cppcoreguidelines-pro-type-member-init,hicpp-member-init)
+
+        std::array<limb_type, static_cast<std::size_t>(q_count_max)> q; // NOLINT(cppcoreguidelines-pro-type-member-init,hicpp-member-init)
+
+        detail::eval_divide_n_by_n(q.begin(),
+                                   my_div_long_pool.data(),
+                                     my_data.cbegin(),
+                                   v.my_data.cbegin(),
+                                   prec_elems,
+                                   static_cast<std::int32_t>(prec_elems + static_cast<std::int32_t>(INT8_C(2))));
+
+        // The leading quotient limb is zero if the mantissa of *this
+        // is less than the mantissa of v.
+        const auto q_ofs =
+          static_cast<std::ptrdiff_t>
+          (
+            (q[static_cast<std::size_t>(UINT8_C(0))] == static_cast<limb_type>(UINT8_C(0)))
+              ? static_cast<std::ptrdiff_t>(INT8_C(1))
+              : static_cast<std::ptrdiff_t>(INT8_C(0))
+          );
+
+        if(q_ofs != static_cast<std::ptrdiff_t>(INT8_C(0)))
+        {
+          my_exp = static_cast<exponent_type>(my_exp - static_cast<exponent_type>(decwide_t_elem_digits10));
+        }
+
+        // Round to nearest with the quotient limb following the result.
+        constexpr auto elem_mask_div_two =
+          static_cast<limb_type>(static_cast<limb_type>(decwide_t_elem_mask) / static_cast<limb_type>(UINT8_C(2)));
+
+        const auto round_up = (q[static_cast<std::size_t>(q_ofs + prec_elems)] >= elem_mask_div_two);
+
+        // Only the significant limbs of the quotient are copied, unless it
+        // is rounded up. So an exact quotient of short values stays within
+        // the inline limbs of a small-buffer representation.
+        auto q_elems = prec_elems;
+
+        if(!round_up)
+        {
+          while((q_elems > static_cast<std::int32_t>(INT8_C(0))) && (q[static_cast<std::size_t>(static_cast<std::ptrdiff_t>(q_elems - 1) + q_ofs)] == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+          {
+            --q_elems;
+          }
+        }
+
+        auto p_data = detail::elems_begin(my_data, q_elems);
+
+        std::copy(q.cbegin() + q_ofs,
+                  q.cbegin() + static_cast<std::ptrdiff_t>(q_ofs + q_elems),
+                  p_data);
+
+        eval_clear_elems(q_elems, prec_elems);
+
+        if(round_up)
+        {
+          detail::eval_multiply_kara_propagate_carry(p_data,
+                                                     static_cast<std::uint_fast32_t>(prec_elems),
+                                                     static_cast<limb_type>(UINT8_C(1)));
+
+          if(*p_data == static_cast<limb_type>(UINT8_C(0)))
+          {
+            // The rounding has carried through all of the limbs,
+            // which are all zero now.
+            *p_data = static_cast<limb_type>(UINT8_C(1));
+
+            my_exp = static_cast<exponent_type>(my_exp + static_cast<exponent_type>(decwide_t_elem_digits10));
+          }
+        }
+
+        eval_set_used_elems((std::max)(my_used_elem, q_elems));
+      }
+
+      my_neg = b_result_is_neg;
+
+      return *this;
+    }
+
+    WIDE_DECIMAL_NODISCARD auto eval_div_by_limb_is_applicable(const decwide_t& v) const -> bool
+    {
+      // The division by a divisor having a single significant limb is
+      // linear (see eval_div_by_limb). It is used above the precisions
+      // of the long division, where the reciprocal of v is needed
+      // otherwise. It is not used for zero operands or for the
+      // trivial divisors +-1.
+      const auto prec_elems = (std::min)(my_prec_elem, v.my_prec_elem);
+
+      return
+      (
+           (!iszero())
+        && (!v.iszero())
+        && (!isone_sign_neutral(v))
+        && (v.eval_significant_elems(prec_elems) == static_cast<std::int32_t>(INT8_C(1)))
+      );
+    }
+
+    auto eval_div_by_limb(const decwide_t& v) -> decwide_t&
+    {
+      // Divide *this by v, whose mantissa is its leading limb, with
+      // div_unsigned_long_long. This divides only the used limbs
+      // if the quotient is exact, in which case short values stay
+      // within the inline limbs of a small-buffer representation.
+
+      const auto b_result_is_neg = (my_neg != v.my_neg);
+
+      // Set the exponent of the result.
+      using local_unsigned_wrap_type = detail::unsigned_wrap<unsigned_exponent_type, exponent_type>;
+
+      const auto u_exp = local_unsigned_wrap_type {   my_exp };
+      const auto v_exp = local_unsigned_wrap_type { v.my_exp };
+
+      const auto result_exp = u_exp - v_exp;
+
+      if((!result_exp.get_is_neg()) && (result_exp.get_value_unsigned() >= decwide_t_max_exp10))
+      {
+        // Check for (and handle overflow).
+        static_cast<void>(operator=(my_value_max()));
+      }
+      else if((result_exp.get_is_neg()) && (result_exp.get_value_unsigned() >= decwide_t_max_exp10))
+      {
+        // Check for (and handle underflow).
+        static_cast<void>(operator=(my_value_min()));
+      }
+      else
+      {
+        my_exp =
+          static_cast<exponent_type>
+          (
+            (!result_exp.get_is_neg())
+              ?                static_cast<exponent_type>(result_exp.get_value_unsigned())
+              : detail::negate(static_cast<exponent_type>(result_exp.get_value_unsigned()))
+          );
+
+        my_neg = false;
+
+        static_cast<void>(div_unsigned_long_long(static_cast<unsigned long long>(v.my_data[static_cast<typename representation_type::size_type>(UINT8_C(0))]))); // NOLINT(google-runtime-int)
+      }
+
+      my_neg = (b_result_is_neg && (!iszero()));
+
+      return *this;
+    }
+
+    WIDE_DECIMAL_NODISCARD auto eval_div_karp_markstein_is_applicable(const decwide_t& v) const -> bool
+    {
+      // Karp-Markstein division pays off from about 200 decimal digits
+      // of precision. It is also not used for the trivial divisors +-1
+      // or for the exponents near the limits of the range, where the
+      // reciprocal of v or the quotient might overflow or underflow.
+      // These are handled by the multiplication with the reciprocal.
+
+      const auto prec_elems = (std::min)(my_prec_elem, v.my_prec_elem);
+
+      if(   iszero()
+         || v.iszero()
+         || isone_sign_neutral(v)
+         || (static_cast<std::int32_t>(prec_elems * decwide_t_elem_digits10) < static_cast<std::int32_t>(INT16_C(200))))
+      {
+        return false;
+      }
+
+      const auto exp_limit =
+        static_cast<std::intmax_t>
+        (
+            static_cast<std::intmax_t>(decwide_t_max_exp10)
+          - static_cast<std::intmax_t>(static_cast<std::intmax_t>(decwide_t_elem_digits10) * static_cast<std::intmax_t>(INT8_C(4)))
+        );
+
+      const auto u_exp = static_cast<std::intmax_t>(  my_exp);
+      const auto v_exp = static_cast<std::intmax_t>(v.my_exp);
+
+      return
+      (
+           (v_exp < exp_limit) && (v_exp > -exp_limit)
+        && ((u_exp - v_exp) < exp_limit) && ((u_exp - v_exp) > -exp_limit)
+      );
+    }
+
+    auto eval_div_karp_markstein(const decwide_t& v) -> decwide_t&
+    {
+      // Divide *this by v with Karp-Markstein division. The reciprocal
+      // y = 1/v is computed to only about half of the precision n of
+      // the division. The quotient is then obtained directly from the
+      // correction step q = q0 + y * (u - v * q0), with q0 = u * y.
+      // Only the product v * q0 needs the full precision, and all
+      // of the other multiplications need half of the precision.
+      // This saves the last (full-precision) Newton step of the
+      // reciprocal and the full-precision multiplication by it.
+
+      // See also A. H. Karp and P. Markstein, "High-Precision Division
+      // and Square Root", ACM TOMS 23(4), 1997, pp. 561-589.
+
+      const auto prec_elems = (std::min)(my_prec_elem, v.my_prec_elem);
+
+      // The correction doubles the number of correct limbs of q0,
+      // and two guard limbs are kept for the final truncation.
+      const auto half_elems =
+        static_cast<std::int32_t>
+        (
+            static_cast<std::int32_t>(prec_elems / static_cast<std::int32_t>(INT8_C(2)))
+          + static_cast<std::int32_t>(INT8_C(2))
+        );
+
+      const auto b_result_is_neg = (my_neg != v.my_neg);
+
+      decwide_t v_abs(v);
+
+      v_abs.my_neg       = false;
+      v_abs.my_prec_elem = prec_elems;
+
+      // Compute the reciprocal of v to half precision.
+      decwide_t y(v_abs);
+
+      y.my_prec_elem = half_elems;
+
+      static_cast<void>(y.calculate_inv());
+
+      // The half-precision terms are used at full precision in the
+      // subtraction and in the addition below. So their limbs beyond
+      // half precision are cleared, making them exact at full precision.
+      const auto widen_to_full_precision =
+        [&half_elems, &prec_elems](decwide_t& x) // NOLINT(modernize-use-trailing-return-type)
+        {
+          x.eval_clear_elems(half_elems, prec_elems);
+
+          x.my_prec_elem = prec_elems;
+        };
+
+      // Compute q0 = u * y to half precision.
+      decwide_t q0(*this);
+
+      q0.my_neg       = false;
+      q0.my_prec_elem = half_elems;
+
+      static_cast<void>(q0 *= y);
+
+      widen_to_full_precision(q0);
+
+      // Compute the remainder r = u - v * q0 to full precision.
+      // Its leading (half_elems - 1) or so limbs cancel.
+      decwide_t r(*this);
+
+      r.my_neg       = false;
+      r.my_prec_elem = prec_elems;
+
+      static_cast<void>(r -= (v_abs *= q0));
+
+      // Correct the quotient with y * r, computed to half precision.
+      r.my_prec_elem = half_elems;
+
+      static_cast<void>(r *= y);
+
+      widen_to_full_precision(r);
+
+      static_cast<void>(q0 += r);
+
+      const auto original_prec_elem = my_prec_elem;
+
+      static_cast<void>(operator=(q0));
+
+      my_prec_elem = original_prec_elem;
+
+      my_neg = (b_result_is_neg && (!iszero()));
+
+      return *this;
+    }
+
+  public:
+    auto operator/=(const decwide_t& v) -> decwide_t&
+    {
+      const auto u_and_v_are_identical =
+        (   (my_fpclass == v.my_fpclass)
+         && (my_exp     == v.my_exp)
+         && (eval_compare_elems(v, decwide_t_elem_number) == static_cast<std::int_fast8_t>(INT8_C(0))));
+
+      if(u_and_v_are_identical)
+      {
+        const auto negate_one = (my_neg != v.my_neg);
+
+        static_cast<void>
+        (
+          operator=(one<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>())
         );
 
         if(negate_one)
@@ -1330,6 +1974,26 @@
           negate();
         }
       }
+      else if(eval_div_long_is_applicable(v))
+      {
+        static_cast<void>(eval_div_long(v));
+      }
+      else if(eval_div_by_limb_is_applicable(v))
+      {
+        static_cast<void>(eval_div_by_limb(v));
+      }
+      else if(eval_div_karp_markstein_is_applicable(v))
+      {
+        static_cast<void>(eval_div_karp_markstein(v));
+      }
+      #if defined(WIDE_DECIMAL_DIV_RECIPROCAL_CACHE_SIZE)
+      else if(eval_div_reciprocal_cache_is_applicable(v))
+      {
+        // The cache is only consulted where the reciprocal of v
+        // is needed, so its results are those of the branch below.
+        static_cast<void>(eval_div_reciprocal_cache(v));
+      }
+      #endif
       else
       {
         static_cast<void>(operator*=(decwide_t(v).calculate_inv()));
@@ -1398,9 +2062,14 @@
         return *this;
       }
 
-      // Set up the multiplication loop.
+      // Set up the multiplication loop. The limbs within the
+      // precision beyond the used limbs are zero and remain zero.
+      const auto used_elems_in_prec = (std::min)(my_used_elem, my_prec_elem);
+
       const auto nn    = static_cast<limb_type>(n);
-      const auto carry = detail::mul_loop_n(my_data.data(), nn, my_prec_elem);
+      const auto carry = detail::mul_loop_n(detail::elems_begin(my_data, used_elems_in_prec), nn, used_elems_in_prec);
+
+      auto used_elems_max = my_used_elem;
 
       // Handle the carry and adjust the exponent.
       if(carry != static_cast<limb_type>(UINT8_C(0)))
@@ -1408,13 +2077,21 @@
         my_exp = static_cast<exponent_type>(my_exp + static_cast<exponent_type>(decwide_t_elem_digits10));
 
         // Shift the result of the multiplication one element to the right.
-        std::copy_backward(my_data.cbegin(),
-                           my_data.cbegin() + static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(my_prec_elem) - static_cast<std::ptrdiff_t>(INT8_C(1))),
-                           my_data.begin()  + static_cast<std::ptrdiff_t>(my_prec_elem));
+        const auto shift_elems = (std::min)(used_elems_in_prec, static_cast<std::int32_t>(my_prec_elem - static_cast<std::int32_t>(INT8_C(1))));
 
-        my_data.front() = static_cast<limb_type>(carry);
+        auto p_data = detail::elems_begin(my_data, static_cast<std::int32_t>(shift_elems + static_cast<std::int32_t>(INT8_C(1))));
+
+        std::copy_backward(p_data,
+                           p_data + static_cast<std::ptrdiff_t>(shift_elems),
+                           p_data + static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(shift_elems) + static_cast<std::ptrdiff_t>(INT8_C(1))));
+
+        *p_data = static_cast<limb_type>(carry);
+
+        used_elems_max = (std::max)(used_elems_max, static_cast<std::int32_t>(shift_elems + static_cast<std::int32_t>(INT8_C(1))));
       }
 
+      eval_set_used_elems(used_elems_max);
+
       // Set the sign.
       my_neg = b_neg;
 
@@ -1443,61 +2120,118 @@
         return *this;
       }
 
+      // The division runs over the used limbs within the precision first.
+      // If it is exact there, the limbs beyond these remain zero. So an
+      // exact quotient of a short value stays within the inline limbs of
+      // a small-buffer representation. Otherwise the division continues
+      // into the limbs up to the precision.
+      const auto used_elems_in_prec = (std::min)(my_used_elem, my_prec_elem);
+
+      auto quot_elems = used_elems_in_prec;
+
       if(n >= static_cast<unsigned long long>(decwide_t_elem_mask)) // NOLINT(google-runtime-int)
       {
-        my_neg = b_neg;
+        if(static_cast<std::uint64_t>(n) >= detail::div_loop_n_wide_max())
+        {
+          my_neg = b_neg;
 
-        return operator/=(decwide_t(n));
-      }
+          return operator/=(decwide_t(n));
+        }
 
-      const auto nn = static_cast<limb_type>(n);
+        // Divide by the wide integer n spanning two or more limbs.
+        auto prev = detail::div_loop_n_wide(detail::elems_begin(my_data, used_elems_in_prec), static_cast<std::uint64_t>(n), used_elems_in_prec, static_cast<std::uint64_t>(UINT8_C(0)));
 
-      if(nn > static_cast<limb_type>(UINT8_C(1)))
-      {
-        // Do the division loop.
-        const auto prev = detail::div_loop_n(my_data.data(), nn, my_prec_elem);
+        if(prev != static_cast<std::uint64_t>(UINT8_C(0)))
+        {
+          quot_elems = my_prec_elem;
 
-        using local_size_type = typename representation_type::size_type;
+          prev = detail::div_loop_n_wide(detail::elems_begin(my_data, quot_elems) + static_cast<std::ptrdiff_t>(used_elems_in_prec), static_cast<std::uint64_t>(n), static_cast<std::int32_t>(quot_elems - used_elems_in_prec), prev);
+        }
 
-        // Determine if one leading zero is in the result data.
-        if(my_data[static_cast<local_size_type>(UINT8_C(0))] == static_cast<limb_type>(UINT8_C(0)))
+        auto p_data = detail::elems_begin(my_data, quot_elems);
+
+        while(*p_data == static_cast<limb_type>(UINT8_C(0)))
         {
-          // Adjust the exponent
-          my_exp = static_cast<exponent_type>(my_exp - static_cast<exponent_type>(decwide_t_elem_digits10));
+          // Remove the leading zero limbs of the result and continue
+          // the division into the limbs that become free at the end.
+          const auto it_non_zero =
+            std::find_if(p_data,
+                         p_data + static_cast<std::ptrdiff_t>(quot_elems),
+                         [](const limb_type& d) // NOLINT(modernize-use-trailing-return-type)
+                         {
+                           return (d != static_cast<limb_type>(UINT8_C(0)));
+                         });
 
-          // Shift result of the division one element to the left.
-          const auto prec_minus_one =
-            static_cast<std::ptrdiff_t>
-            (
-                static_cast<std::ptrdiff_t>(my_prec_elem)
-              - static_cast<std::ptrdiff_t>(INT8_C(1))
-            );
+          const auto zeros = static_cast<std::int32_t>(std::distance(p_data, it_non_zero));
 
-          std::copy(my_data.cbegin() + static_cast<std::ptrdiff_t>(INT8_C(1)),
-                    my_data.cbegin() + prec_minus_one,
-                    my_data.begin());
+          my_exp = static_cast<exponent_type>(my_exp - static_cast<exponent_type>(static_cast<exponent_type>(zeros) * static_cast<exponent_type>(decwide_t_elem_digits10)));
 
-          const auto index_prev =
-            static_cast<local_size_type>
-            (
-              static_cast<std::ptrdiff_t>(my_prec_elem) - static_cast<std::ptrdiff_t>(INT8_C(1))
-            );
+          std::copy(it_non_zero,
+                    p_data + static_cast<std::ptrdiff_t>(quot_elems),
+                    p_data);
 
-          const auto val_prev =
-            static_cast<limb_type>
-            (
-                static_cast<std::uint64_t>
-                (
-                    static_cast<std::uint64_t>(prev)
-                  * static_cast<std::uint32_t>(decwide_t_elem_mask)
-                )
-              / nn
-            );
+          const auto it_free = p_data + static_cast<std::ptrdiff_t>(quot_elems - zeros);
+
+          std::fill(it_free, it_free + static_cast<std::ptrdiff_t>(zeros), static_cast<limb_type>(UINT8_C(0)));
+
+          prev = detail::div_loop_n_wide(it_free, static_cast<std::uint64_t>(n), zeros, prev);
+        }
+      }
+      else
+      {
+        const auto nn = static_cast<limb_type>(n);
+
+        if(nn > static_cast<limb_type>(UINT8_C(1)))
+        {
+          // Do the division loop.
+          auto prev = detail::div_loop_n(detail::elems_begin(my_data, used_elems_in_prec), nn, used_elems_in_prec, static_cast<limb_type>(UINT8_C(0)));
+
+          if(prev != static_cast<limb_type>(UINT8_C(0)))
+          {
+            quot_elems = my_prec_elem;
+
+            prev = detail::div_loop_n(detail::elems_begin(my_data, quot_elems) + static_cast<std::ptrdiff_t>(used_elems_in_prec), nn, static_cast<std::int32_t>(quot_elems - used_elems_in_prec), prev);
+          }
+
+          auto p_data = detail::elems_begin(my_data, quot_elems);
+
+          // Determine if one leading zero is in the result data.
+          if(*p_data == static_cast<limb_type>(UINT8_C(0)))
+          {
+            // Adjust the exponent
+            my_exp = static_cast<exponent_type>(my_exp - static_cast<exponent_type>(decwide_t_elem_digits10));
+
+            // Shift result of the division one element to the left.
+            const auto quot_minus_one =
+              static_cast<std::ptrdiff_t>
+              (
+                  static_cast<std::ptrdiff_t>(quot_elems)
+                - static_cast<std::ptrdiff_t>(INT8_C(1))
+              );
+
+            std::copy(p_data + static_cast<std::ptrdiff_t>(INT8_C(1)),
+                      p_data + static_cast<std::ptrdiff_t>(quot_elems),
+                      p_data);
+
+            const auto val_prev =
+              static_cast<limb_type>
+              (
+                  static_cast<double_limb_type>
+                  (
+                      static_cast<double_limb_type>(prev)
+                    * static_cast<limb_type>(decwide_t_elem_mask)
+                  )
+                / nn
+              );
 
-          my_data[index_prev] = val_prev;
+            p_data[quot_minus_one] = val_prev;
+          }
         }
       }
 
+      // The quotient occupies the limbs up to quot_elems.
+      eval_set_used_elems((std::max)(my_used_elem, quot_elems));
+
       // Check for underflow.
       if(my_exp < decwide_t_min_exp10)
       {
@@ -1619,10 +2353,7 @@
               // TBD: Compare the limbs. If the final limb is reached,
               // check the comparison result on the relevant digit-level.
               // This might be needed within the compare_ranges subroutine.
-              const auto val_cmp_data =
-                detail::compare_ranges(  my_data.data(),
-                                       v.my_data.data(),
-                                       static_cast<std::uint_fast32_t>(decwide_t_elem_number));
+              const auto val_cmp_data = eval_compare_elems(v, decwide_t_elem_number);
 
               n_result =
                 static_cast<std::int_fast8_t>
@@ -1746,6 +2477,7 @@
       std::swap(my_neg,       other.my_neg);
       std::swap(my_fpclass,   other.my_fpclass);
       std::swap(my_prec_elem, other.my_prec_elem);
+      std::swap(my_used_elem, other.my_used_elem);
     }
 
     // Elementary primitives.
@@ -1831,20 +2563,15 @@
       return *this;
     }
 
-    auto calculate_sqrt() -> decwide_t&
+    auto calculate_rsqrt() -> decwide_t&
     {
-      // Compute the square root of *this.
+      // Compute the inverse of the square root of *this.
 
-      if(isneg())
+      if(isneg() || iszero())
       {
         return operator=(zero<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>());
       }
 
-      if(iszero())
-      {
-        return *this;
-      }
-
       if(isone())
       {
         return *this;
@@ -1853,13 +2580,13 @@
       // Use the original value of *this for iteration below.
       decwide_t x(*this);
 
-      // Generate the initial estimate using division.
+      // Generate the initial estimate using 1 / sqrt.
       // Extract the mantissa and exponent for a "manual"
       // computation of the estimate.
       auto dd = internal_float_type { };
       auto ne = exponent_type       { };
 
-      extract_parts(dd, ne);
+      x.extract_parts(dd, ne);
 
       // Force the exponent to be an even multiple of two.
       const auto exponent_is_odd =
@@ -1876,38 +2603,30 @@
 
       using std::sqrt;
 
-      // Setup the iteration.
-      // Estimate the square root using simple manipulations.
-      const internal_float_type sqd = sqrt(dd);
-
       const auto original_prec_elem = my_prec_elem;
 
-      static_cast<void>(operator=(decwide_t(sqd, static_cast<exponent_type>(ne / 2))));
+      {
+        const auto one_over_sqd =
+          static_cast<internal_float_type>
+          (
+            static_cast<internal_float_type>(1.0F) / sqrt(dd)
+          );
 
-      // Estimate 1.0 / (2.0 * x0) using simple manipulations.
-      const auto inv_half_sqd =
-        static_cast<internal_float_type>
-        (
-          static_cast<internal_float_type>(0.5F) / sqd
-        );
+        const auto minus_half_ne =
+          static_cast<exponent_type>
+          (
+            static_cast<exponent_type>(-ne) / static_cast<std::int8_t>(INT8_C(2))
+          );
 
-      const auto minus_half_ne =
-        static_cast<exponent_type>
-        (
-          static_cast<exponent_type>(-ne) / static_cast<std::int8_t>(INT8_C(2))
-        );
-
-      decwide_t vi(inv_half_sqd, minus_half_ne);
+        static_cast<void>(operator=(decwide_t(one_over_sqd, minus_half_ne)));
+      }
 
-      // Compute the square root of *this. Coupled Newton iteration
-      // as described in "Pi Unleashed" is used. During the
-      // iterative steps, the precision of the calculation is
-      // limited to the minimum required in order to minimize
-      // the run-time.
-      //
-      // Book references:
-      // http://www.jjj.de/pibook/pibook.html
-      // http://www.springer.com/gp/book/9783642567353
+      // Compute the inverse square root of *this with the Newton iteration
+      // y += y * (1 - x * y^2) / 2, which needs no division. The leading
+      // digits of (1 - x * y^2) cancel, so the correction y * (1 - x * y^2)
+      // only needs the precision of the current (not the next) iteration.
+      // The precision of the terms never exceeds that of *this, which
+      // allows calculating approximate inverse square roots cheaply.
 
       for(auto digits  = static_cast<std::int32_t>(std::numeric_limits<internal_float_type>::digits10 - 1);
                digits  < static_cast<std::int32_t>(original_prec_elem * decwide_t_elem_digits10); // NOLINT(altera-id-dependent-backward-branch)
@@ -1924,22 +2643,46 @@
         const auto new_prec_as_digits10 =
           static_cast<std::int32_t>
           (
-              static_cast<std::int32_t>(digits * static_cast<std::int8_t>(INT8_C(2)))
+              static_cast<std::int32_t>(digits * static_cast<std::int32_t>(INT8_C(2)))
             + min_elem_digits10_plus_one
           );
 
-           precision(new_prec_as_digits10);
-        vi.precision(new_prec_as_digits10);
-         x.precision(new_prec_as_digits10);
+        precision(new_prec_as_digits10);
 
-        // Next iteration of vi
-        vi += vi * (((*this * vi) * static_cast<std::int32_t>(INT8_C(-2))) + one<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>());
+        my_prec_elem = (std::min)(my_prec_elem, original_prec_elem);
 
-        // Next iteration of *this
-        static_cast<void>
-        (
-          operator+=(vi * (-((*this) * (*this)) + x))
-        );
+        x.my_prec_elem = my_prec_elem;
+
+        // Compute the residual r = 1 - x * y^2 with the new precision.
+        // The square y^2 is computed in place, so that the squaring
+        // paths of the kernels are used.
+        decwide_t r(*this);
+
+        static_cast<void>(r *= r);
+        static_cast<void>(r *= x);
+        static_cast<void>(r.negate());
+        static_cast<void>(r += one<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>());
+
+        // Compute the correction y * r / 2 with the current precision.
+        decwide_t term(*this);
+
+        term.precision(static_cast<std::int32_t>(digits + min_elem_digits10_plus_one));
+
+        const auto term_prec_elem = (std::min)(term.my_prec_elem, my_prec_elem);
+
+        term.my_prec_elem = term_prec_elem;
+           r.my_prec_elem = term_prec_elem;
+
+        static_cast<void>(term *= r);
+        static_cast<void>(term /= static_cast<std::uint32_t>(UINT8_C(2)));
+
+        // The limbs of the correction beyond its precision are
+        // cleared, making it exact with the new precision.
+        term.eval_clear_elems(term_prec_elem, my_prec_elem);
+
+        term.my_prec_elem = my_prec_elem;
+
+        static_cast<void>(operator+=(term));
       }
 
       my_prec_elem = original_prec_elem;
@@ -1947,6 +2690,110 @@
       return *this;
     }
 
+    auto calculate_sqrt() -> decwide_t&
+    {
+      // Compute the square root of *this.
+
+      if(isneg())
+      {
+        return operator=(zero<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>());
+      }
+
+      if(iszero())
+      {
+        return *this;
+      }
+
+      if(isone())
+      {
+        return *this;
+      }
+
+      // Compute the square root with the inverse square root y = 1/sqrt(x)
+      // to only about half of the precision n. The square root is then
+      // obtained from the Karp-Markstein correction s = s0 + y * (x - s0^2) / 2,
+      // with s0 = x * y. Only the square s0^2 needs the full precision,
+      // and all of the other multiplications need half of the precision.
+
+      // See also A. H. Karp and P. Markstein, "High-Precision Division
+      // and Square Root", ACM TOMS 23(4), 1997, pp. 561-589.
+
+      const auto prec_elems = my_prec_elem;
+
+      // The correction doubles the number of correct limbs of s0.
+      // At least 16 guard digits (and two guard limbs) are kept, since
+      // the square of the error of y must remain below the last limb.
+      const auto guard_elems =
+        (std::max)
+        (
+          static_cast<std::int32_t>(static_cast<std::int32_t>(INT8_C(16)) / decwide_t_elem_digits10),
+          static_cast<std::int32_t>(INT8_C(2))
+        );
+
+      const auto half_elems =
+        (std::min)
+        (
+          static_cast<std::int32_t>
+          (
+              static_cast<std::int32_t>(prec_elems / static_cast<std::int32_t>(INT8_C(2)))
+            + guard_elems
+          ),
+          prec_elems
+        );
+
+      // Compute the inverse square root of x to half precision.
+      decwide_t y(*this);
+
+      y.my_prec_elem = half_elems;
+
+      static_cast<void>(y.calculate_rsqrt());
+
+      // The half-precision terms are used at full precision in the
+      // subtraction and in the addition below. So their limbs beyond
+      // half precision are cleared, making them exact at full precision.
+      const auto widen_to_full_precision =
+        [&half_elems, &prec_elems](decwide_t& z) // NOLINT(modernize-use-trailing-return-type)
+        {
+          z.eval_clear_elems(half_elems, prec_elems);
+
+          z.my_prec_elem = prec_elems;
+        };
+
+      // Compute s0 = x * y to half precision.
+      decwide_t s0(*this);
+
+      s0.my_prec_elem = half_elems;
+
+      static_cast<void>(s0 *= y);
+
+      widen_to_full_precision(s0);
+
+      // Compute the remainder r = x - s0^2 to full precision.
+      // Its leading (half_elems - 1) or so limbs cancel. The square
+      // is computed in place, so that the squaring paths are used.
+      decwide_t r(s0);
+
+      static_cast<void>(r *= r);
+      static_cast<void>(r.negate());
+      static_cast<void>(r += *this);
+
+      // Correct the square root with y * r / 2, computed to half precision.
+      r.my_prec_elem = half_elems;
+
+      static_cast<void>(r *= y);
+      static_cast<void>(r /= static_cast<std::uint32_t>(UINT8_C(2)));
+
+      widen_to_full_precision(r);
+
+      static_cast<void>(s0 += r);
+
+      static_cast<void>(operator=(s0));
+
+      my_prec_elem = prec_elems;
+
+      return *this;
+    }
+
     auto calculate_rootn_inv(std::int32_t p) -> decwide_t&
     {
       // Compute the inverse of the n'th root of *this.
@@ -1965,6 +2812,11 @@
       }
       // LCOV_EXCL_STOP
 
+      if(p == static_cast<std::int32_t>(INT8_C(2)))
+      {
+        return calculate_rsqrt();
+      }
+
       // Use the original value of *this for iteration below.
       decwide_t x(*this);
 
@@ -2091,6 +2943,214 @@
       }
     }
 
+    template<typename ForwardIteratorA,
+             typename ForwardIteratorB>
+    static auto calculate_dot(ForwardIteratorA a_first, ForwardIteratorA a_last, ForwardIteratorB b_first, const decwide_t& c) -> decwide_t
+    {
+      // Calculate c + sum(a[i] * b[i]) as a fused sum of products.
+      // The products are added into one fixed-point accumulator
+      // (having two guard limbs) at the largest exponent that any
+      // of the terms can have. The accumulator is not normalized
+      // during the summation, and the sum is normalized and truncated
+      // to the precision of the operands only once at the end.
+      // This avoids the normalization of, and the exponent alignment
+      // for, the temporary products and partial sums. Carries and borrows
+      // beyond the most significant limb are counted in acc_top, so
+      // that the sum is acc_top * elem_mask^acc_elems + acc.
+
+      // Find the precision and the exponent of the accumulator.
+      auto prec_elems = c.my_prec_elem;
+
+      auto acc_exp = static_cast<std::intmax_t>(c.iszero() ? (std::numeric_limits<std::intmax_t>::min)() : static_cast<std::intmax_t>(c.my_exp));
+
+      {
+        auto b_it = b_first;
+
+        for(auto a_it = a_first; a_it != a_last; ++a_it, ++b_it)
+        {
+          prec_elems = (std::min)(prec_elems, (std::min)(a_it->my_prec_elem, b_it->my_prec_elem));
+
+          if((!a_it->iszero()) && (!b_it->iszero()))
+          {
+            // The product may have one more leading limb.
+            const auto product_exp_max =
+              static_cast<std::intmax_t>
+              (
+                  static_cast<std::intmax_t>(static_cast<std::intmax_t>(a_it->my_exp) + static_cast<std::intmax_t>(b_it->my_exp))
+                + static_cast<std::intmax_t>(decwide_t_elem_digits10)
+              );
+
+            acc_exp = (std::max)(acc_exp, product_exp_max);
+          }
+        }
+      }
+
+      if(acc_exp == (std::numeric_limits<std::intmax_t>::min)())
+      {
+        // All of the terms are zero.
+        return decwide_t();
+      }
+
+      const auto acc_elems = static_cast<std::int32_t>(prec_elems + static_cast<std::int32_t>(INT8_C(2)));
+
+      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+      using fused_acc_pool_type = detail::scratch_frame<limb_type>;
+
+      fused_acc_pool_type my_fused_acc_pool(static_cast<typename fused_acc_pool_type::size_type>(acc_elems));
+      #endif
+
+      limb_type* acc = my_fused_acc_pool.data();
+
+      std::fill(acc, acc + static_cast<std::ptrdiff_t>(acc_elems), static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      auto acc_top = static_cast<std::intmax_t>(INT8_C(0));
+
+      const auto accumulate =
+        [&acc, &acc_top, &acc_exp, &acc_elems, &prec_elems](const decwide_t& term, const bool term_is_neg) // NOLINT(modernize-use-trailing-return-type)
+        {
+          // The limb term.my_data[0] belongs to acc[ofs]. Limbs
+          // below the last limb of the accumulator are dropped.
+          const auto ofs =
+            static_cast<std::intmax_t>
+            (
+                static_cast<std::intmax_t>(acc_exp - static_cast<std::intmax_t>(term.my_exp))
+              / static_cast<std::intmax_t>(decwide_t_elem_digits10)
+            );
+
+          if(ofs < static_cast<std::intmax_t>(acc_elems))
+          {
+            const auto count = (std::min)(term.eval_significant_elems(prec_elems), static_cast<std::int32_t>(acc_elems - static_cast<std::int32_t>(ofs)));
+
+            acc_top += detail::eval_accumulate_n(acc, static_cast<std::int32_t>(ofs), term.my_data.data(), count, term_is_neg);
+          }
+        };
+
+      if(!c.iszero())
+      {
+        accumulate(c, c.my_neg);
+      }
+
+      decwide_t term;
+
+      {
+        auto b_it = b_first;
+
+        for(auto a_it = a_first; a_it != a_last; ++a_it, ++b_it)
+        {
+          if((!a_it->iszero()) && (!b_it->iszero()))
+          {
+            term = *a_it;
+
+            // Use the squaring paths of the kernels for a[i] == b[i].
+            static_cast<void>((&(*a_it) == &(*b_it)) ? (term *= term) : (term *= *b_it));
+
+            accumulate(term, term.my_neg);
+          }
+        }
+      }
+
+      // Take the magnitude of the sum.
+      const auto result_is_neg = (acc_top < static_cast<std::intmax_t>(INT8_C(0)));
+
+      if(result_is_neg)
+      {
+        // Use |sum| = (-acc_top - 1) * elem_mask^acc_elems + (elem_mask^acc_elems - acc),
+        // where the second part is the complement of acc.
+        acc_top = static_cast<std::intmax_t>(-acc_top - static_cast<std::intmax_t>(INT8_C(1)));
+
+        std::transform(acc,
+                       acc + static_cast<std::ptrdiff_t>(acc_elems), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                       acc,
+                       [](const limb_type& d) // NOLINT(modernize-use-trailing-return-type)
+                       {
+                         return static_cast<limb_type>(decwide_t_elem_mask_min1 - d);
+                       });
+
+        const limb_type one_limb { static_cast<limb_type>(UINT8_C(1)) };
+
+        acc_top += detail::eval_accumulate_n(acc, static_cast<std::int32_t>(acc_elems - 1), &one_limb, static_cast<std::int32_t>(INT8_C(1)), false);
+      }
+
+      // The limbs of acc_top precede those of the accumulator.
+      std::array<limb_type, static_cast<std::size_t>(std::numeric_limits<std::uintmax_t>::digits10 + 1)> top_limbs { };
+
+      auto top_count = static_cast<std::int32_t>(INT8_C(0));
+
+      for(auto top = static_cast<std::uintmax_t>(acc_top); top != static_cast<std::uintmax_t>(UINT8_C(0)); top /= static_cast<std::uintmax_t>(decwide_t_elem_mask))
+      {
+        top_limbs[static_cast<std::size_t>(top_count)] = static_cast<limb_type>(top % static_cast<std::uintmax_t>(decwide_t_elem_mask));
+
+        ++top_count;
+      }
+
+      const auto acc_first_nonzero =
+        static_cast<std::int32_t>
+        (
+          std::distance(acc,
+                        std::find_if(acc,
+                                     acc + static_cast<std::ptrdiff_t>(acc_elems), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                                     [](const limb_type& d) // NOLINT(modernize-use-trailing-return-type)
+                                     {
+                                       return (d != static_cast<limb_type>(UINT8_C(0)));
+                                     }))
+        );
+
+      if((top_count == static_cast<std::int32_t>(INT8_C(0))) && (acc_first_nonzero == acc_elems))
+      {
+        // The sum is zero.
+        return decwide_t();
+      }
+
+      // Normalize the sum and set its exponent.
+      decwide_t result;
+
+      result.my_prec_elem = prec_elems;
+
+      auto result_elems = static_cast<std::int32_t>(INT8_C(0));
+
+      for(auto i = top_count; ((i > static_cast<std::int32_t>(INT8_C(0))) && (result_elems < prec_elems)); --i)
+      {
+        result.my_data[static_cast<typename representation_type::size_type>(result_elems)] = top_limbs[static_cast<std::size_t>(i - 1)];
+
+        ++result_elems;
+      }
+
+      const auto acc_first = ((top_count != static_cast<std::int32_t>(INT8_C(0))) ? static_cast<std::int32_t>(INT8_C(0)) : acc_first_nonzero);
+
+      for(auto i = acc_first; ((i < acc_elems) && (result_elems < prec_elems)); ++i)
+      {
+        result.my_data[static_cast<typename representation_type::size_type>(result_elems)] = acc[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        ++result_elems;
+      }
+
+      result.eval_set_used_elems(result_elems);
+
+      const auto result_exp =
+        static_cast<std::intmax_t>
+        (
+            acc_exp
+          + static_cast<std::intmax_t>(static_cast<std::intmax_t>(top_count - acc_first) * static_cast<std::intmax_t>(decwide_t_elem_digits10))
+        );
+
+      if(result_exp >= static_cast<std::intmax_t>(decwide_t_max_exp10))
+      {
+        result = my_value_max();
+      }
+      else if(result_exp <= static_cast<std::intmax_t>(decwide_t_min_exp10))
+      {
+        result = my_value_min();
+      }
+      else
+      {
+        result.my_exp = static_cast<exponent_type>(result_exp);
+      }
+
+      result.my_neg = result_is_neg;
+
+      return result;
+    }
+
     auto negate() -> decwide_t&
     {
       if(!iszero())
@@ -2159,15 +3219,9 @@
         }
         else
         {
-          const auto it_non_zero = // NOLINT(llvm-qualified-auto,readability-qualified-auto)
-            std::find_if(my_data.cbegin() + static_cast<std::ptrdiff_t>(offset_decimal_part),
-                         my_data.cend(),
-                         [](const limb_type& d) // NOLINT(modernize-use-trailing-return-type)
-                         {
-                           return (d != static_cast<limb_type>(UINT8_C(0)));
-                         });
-
-          value_is_int = (it_non_zero == my_data.cend());
+          // Check that the decimal part has no significant limbs.
+          // The limbs at and beyond my_used_elem are zero.
+          value_is_int = (detail::significant_elems(my_data, my_used_elem) <= static_cast<std::int32_t>(offset_decimal_part));
         }
       }
 
@@ -2294,9 +3348,7 @@
 
       const auto last_clear  = static_cast<std::ptrdiff_t>(decwide_t_elem_number);
 
-      std::fill(x.my_data.begin() + first_clear,
-                x.my_data.begin() + last_clear,
-                static_cast<limb_type>(UINT8_C(0)));
+      x.eval_clear_elems(static_cast<std::int32_t>(first_clear), static_cast<std::int32_t>(last_clear));
 
       return x;
     }
@@ -2575,25 +3627,24 @@
       // Initialization from initializer list of limbs,
       // exponent value (normed to limb granularity)
       // and optional sign flag.
+      // The limbs of the default-constructed value are zero.
+      // The limbs are stored by index, which keeps short values
+      // within the inline limbs of a small-buffer representation.
       auto a = decwide_t { };
 
-      if(limb_values.size() < a.my_data.size())
-      {
-        std::copy(limb_values.begin(),
-                  limb_values.end(),
-                  a.my_data.begin());
+      using local_size_type = typename representation_type::size_type;
 
-        std::fill(a.my_data.begin() + limb_values.size(),
-                  a.my_data.end(),
-                  static_cast<limb_type>(UINT8_C(0)));
-      }
-      else
+      const auto size_to_copy =
+        (std::min)(static_cast<local_size_type>(limb_values.size()),
+                   static_cast<local_size_type>(a.my_data.size()));
+
+      for(auto i = static_cast<local_size_type>(UINT8_C(0)); i < size_to_copy; ++i)
       {
-        std::copy(limb_values.begin(),
-                  limb_values.begin() + a.my_data.size(),
-                  a.my_data.begin());
+        a.my_data[i] = *(limb_values.begin() + static_cast<std::ptrdiff_t>(i)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
       }
 
+      a.eval_set_used_elems(static_cast<std::int32_t>(size_to_copy));
+
       a.my_exp       = e;
       a.my_neg       = is_neg;
       a.my_fpclass   = fpclass_type::decwide_t_finite;
@@ -2624,11 +3675,17 @@
   private:
     #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
     #else
-    static std::array<limb_type,      static_cast<std::size_t>((decwide_t_elems_for_kara - 1) * 2)>                                                                                               my_school_mul_pool;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
-    static std::array<limb_type,      static_cast<std::size_t>(detail::a029750::a029750_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t_elems_for_fft - 1)) * 8UL))> my_kara_mul_pool;    // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-    static std::array<fft_float_type, static_cast<std::size_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t_elem_number)) * 4UL))>       my_af_fft_mul_pool;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
-    static std::array<fft_float_type, static_cast<std::size_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t_elem_number)) * 4UL))>       my_bf_fft_mul_pool;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
-    static representation_type my_n_data_for_add_sub; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static WIDE_DECIMAL_STATIC_POOL_STORAGE std::array<limb_type,      static_cast<std::size_t>((decwide_t_elems_for_kara - 1) * 2)>                                                                                               my_school_mul_pool;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static WIDE_DECIMAL_STATIC_POOL_STORAGE std::array<limb_type,      static_cast<std::size_t>(detail::a029750::a029750_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t_elems_for_fft - 1)) * 8UL))> my_kara_mul_pool;    // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    static WIDE_DECIMAL_STATIC_POOL_STORAGE std::array<limb_type,      static_cast<std::size_t>(detail::a029750::a029750_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t_elems_for_fft + 1) / 3U)) * 3UL * 14UL)> my_toom3_mul_pool;   // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    static WIDE_DECIMAL_STATIC_POOL_STORAGE std::array<fft_float_type, static_cast<std::size_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t_elem_number)) * 2UL * detail::decwide_t_helper_base<LimbType>::fft_points_per_limb))>       my_af_fft_mul_pool;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static WIDE_DECIMAL_STATIC_POOL_STORAGE std::array<fft_float_type, static_cast<std::size_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t_elem_number)) * 2UL * detail::decwide_t_helper_base<LimbType>::fft_points_per_limb))>       my_bf_fft_mul_pool;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static WIDE_DECIMAL_STATIC_POOL_STORAGE std::array<fft_float_type, static_cast<std::size_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t_elem_number)) * 4UL * detail::decwide_t_helper_base<LimbType>::fft_points_per_limb))>       my_fft_twiddle_pool; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static WIDE_DECIMAL_STATIC_POOL_STORAGE std::uint32_t                                                                                                                                                                        my_fft_twiddle_size; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static WIDE_DECIMAL_STATIC_POOL_STORAGE std::array<std::uint32_t,  static_cast<std::size_t>(detail::ntt::ntt_length_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t_elem_number) * detail::decwide_t_helper_base<LimbType>::ntt_points_per_limb)) * 4UL)> my_ntt_mul_pool; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    static WIDE_DECIMAL_STATIC_POOL_STORAGE std::array<std::uint32_t,  static_cast<std::size_t>(detail::ntt::ntt_length_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t_elem_number) * detail::decwide_t_helper_base<LimbType>::ntt_points_per_limb)) * 3UL)> my_ntt_twiddle_pool; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    static WIDE_DECIMAL_STATIC_POOL_STORAGE std::uint32_t                                                                                                                                                                        my_ntt_twiddle_size; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static WIDE_DECIMAL_STATIC_POOL_STORAGE std::array<limb_type,      static_cast<std::size_t>(decwide_t_elem_number + 2)> my_fused_acc_pool; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
     #endif
 
     representation_type my_data;      // NOLINT(readability-identifier-naming)
@@ -2636,6 +3693,7 @@
     bool                my_neg;       // NOLINT(readability-identifier-naming,modernize-use-default-member-init)
     fpclass_type        my_fpclass;   // NOLINT(readability-identifier-naming)
     std::int32_t        my_prec_elem; // NOLINT(readability-identifier-naming)
+    std::int32_t        my_used_elem; // NOLINT(readability-identifier-naming)
 
     WIDE_DECIMAL_NODISCARD static auto isone_sign_neutral(const decwide_t& x) -> bool
     {
@@ -2648,18 +3706,13 @@
       if(   (x.my_data[static_cast<local_size_type>(UINT8_C(0))] == static_cast<limb_type>(UINT8_C(1)))
          && (x.my_exp == static_cast<exponent_type>(INT8_C(0))))
       {
-        const auto it_non_zero = // NOLINT(llvm-qualified-auto,readability-qualified-auto)
-          std::find_if(x.my_data.cbegin() + static_cast<std::ptrdiff_t>(INT8_C(1)),
-                       x.my_data.cend(),
-                       [](const limb_type& d) // NOLINT(modernize-use-trailing-return-type)
-                       {
-                         return (d != static_cast<limb_type>(UINT8_C(0)));
-                       });
-
-        value_is_one = (it_non_zero == x.my_data.cend());
+        // The value is one if its leading limb is its only significant
+        // limb. The limbs at and beyond my_used_elem are zero.
+        value_is_one = (detail::significant_elems(x.my_data, x.my_used_elem) == static_cast<std::int32_t>(INT8_C(1)));
       }
       else if(   (x.my_data[static_cast<local_size_type>(UINT8_C(0))] == static_cast<limb_type>(decwide_t_elem_mask_min1))
-              && (x.my_exp == static_cast<exponent_type>(-decwide_t_elem_digits10)))
+              && (x.my_exp == static_cast<exponent_type>(-decwide_t_elem_digits10))
+              && (x.my_used_elem == decwide_t_elem_number))
       {
         const auto it_non_nine = // NOLINT(llvm-qualified-auto,readability-qualified-auto)
           std::find_if(x.my_data.cbegin() + static_cast<std::ptrdiff_t>(INT8_C(1)),
@@ -2675,6 +3728,189 @@
       return value_is_one;
     }
 
+    using short_elems_array_type = std::array<limb_type, static_cast<std::size_t>(decwide_t_elems_for_short)>;
+
+    WIDE_DECIMAL_NODISCARD auto eval_significant_elems(const std::int32_t count) const -> std::int32_t
+    {
+      // Get the number of significant limbs among the first count limbs.
+      // The limbs at and beyond my_used_elem are zero. The kernels keep
+      // my_used_elem exact, so the backward scan for trailing zero limbs
+      // stops at once, unless the limbs have been modified through
+      // representation(). This scans only the inline limbs of a small
+      // value, which are the limbs that data() const reaches.
+      return detail::significant_elems(my_data, (std::min)(my_used_elem, count));
+    }
+
+    auto eval_set_used_elems(const std::int32_t used_elems_max) -> void
+    {
+      // Set my_used_elem from an upper bound of the used limbs,
+      // in other words the limbs beyond this bound must be zero.
+      // The trailing zero limbs below the bound are scanned
+      // from the back, so this is quick for a tight bound.
+      my_used_elem = detail::significant_elems(my_data, (std::min)(used_elems_max, decwide_t_elem_number));
+    }
+
+    auto eval_clear_elems(const std::int32_t first, const std::int32_t last) -> void
+    {
+      // Clear the limbs in the range [first, last). Only the significant
+      // limbs among these need to be cleared. These are cleared by index,
+      // which does not spill a small-buffer representation (also if
+      // my_used_elem is loose after a modification by representation()).
+      const auto last_used = eval_significant_elems(last);
+
+      if(first < last_used)
+      {
+        using local_size_type = typename representation_type::size_type;
+
+        for(auto i = first; i < last_used; ++i)
+        {
+          my_data[static_cast<local_size_type>(i)] = static_cast<limb_type>(UINT8_C(0));
+        }
+      }
+
+      if(my_used_elem <= last)
+      {
+        eval_set_used_elems((std::min)(first, last_used));
+      }
+    }
+
+    auto eval_copy_short_elems(short_elems_array_type& short_elems, const std::int32_t count) const -> void
+    {
+      // Copy the first count limbs (at most decwide_t_elems_for_short) by index.
+      using local_size_type = typename representation_type::size_type;
+
+      for(auto i = static_cast<std::int32_t>(INT8_C(0)); i < count; ++i)
+      {
+        short_elems[static_cast<std::size_t>(i)] = my_data[static_cast<local_size_type>(i)]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+      }
+    }
+
+    WIDE_DECIMAL_NODISCARD auto eval_compare_elems(const decwide_t& v, const std::int32_t count) const -> std::int_fast8_t
+    {
+      // Compare the first count limbs of *this and v from the front, up to
+      // the first differing limb. Only the limbs which are significant in
+      // both of these are compared. If these are equal, the value having
+      // more significant limbs is greater, since its last one is nonzero.
+      const auto u_elems =   eval_significant_elems(count);
+      const auto v_elems = v.eval_significant_elems(count);
+
+      const auto n_result =
+        detail::compare_ranges(my_data.data(),
+                               v.my_data.data(),
+                               static_cast<std::uint_fast32_t>((std::min)(u_elems, v_elems)));
+
+      if((n_result != static_cast<std::int_fast8_t>(INT8_C(0))) || (u_elems == v_elems))
+      {
+        return n_result;
+      }
+
+      return ((u_elems > v_elems) ? static_cast<std::int_fast8_t>(INT8_C(1)) : static_cast<std::int_fast8_t>(INT8_C(-1)));
+    }
+
+    auto eval_accumulate_elems(const decwide_t& v, const std::int32_t ofs, const std::int32_t count, const bool is_subtraction) -> std::int_fast8_t
+    {
+      // Add (or subtract) the first count limbs of v to (or from) the limbs
+      // of *this beginning at the offset ofs (see detail::eval_accumulate_n).
+      // Only the significant limbs of v are needed, since its trailing
+      // zero limbs leave the limbs of *this unchanged. The carry (or the
+      // borrow) reaches only the limbs before these. So the limbs of *this
+      // remain inline in a small-buffer representation if these suffice.
+      const auto v_elems = v.eval_significant_elems(count);
+
+      return detail::eval_accumulate_n(detail::elems_begin(my_data, static_cast<std::int32_t>(ofs + v_elems)), ofs, v.my_data.data(), v_elems, is_subtraction);
+    }
+
+    auto eval_mul_short(const decwide_t& v, const std::int32_t prec_elems_for_multiply) -> bool
+    {
+      // Multiply *this by v with the linear kernel if either of these is
+      // short, with a cost of about (long_elems * short_elems) limb
+      // products. Otherwise return false so that the regular
+      // multiplication method is used. Like the other kernels, this
+      // takes the first prec_elems_for_multiply limbs of the product.
+      const auto v_elems = v.eval_significant_elems(prec_elems_for_multiply);
+      const auto u_elems =   eval_significant_elems(prec_elems_for_multiply);
+
+      // A short v is preferred, since it does not need to be copied.
+      const auto v_is_short = ((v_elems <= u_elems) || (v_elems <= decwide_t_elems_for_short));
+
+      const auto short_elems = (v_is_short ? v_elems : u_elems);
+      const auto long_elems  = (v_is_short ? u_elems : v_elems);
+
+      // An operand within the inline limbs of a small-buffer
+      // representation is always multiplied here.
+      if(   (short_elems > decwide_t_elems_for_short)
+         || (   (static_cast<std::int32_t>(short_elems * static_cast<std::int32_t>(INT8_C(4))) > prec_elems_for_multiply)
+             && (short_elems > decwide_t_elems_inline)))
+      {
+        return false;
+      }
+
+      if(short_elems == static_cast<std::int32_t>(INT8_C(0)))
+      {
+        // The product is zero.
+        eval_clear_elems(static_cast<std::int32_t>(INT8_C(0)), prec_elems_for_multiply);
+
+        return true;
+      }
+
+      // The columns of the product beyond (long_elems + short_elems - 1)
+      // are zero. So only the limbs up to there need to be multiplied.
+      const auto product_elems =
+        (std::min)
+        (
+          prec_elems_for_multiply,
+          (std::max)(static_cast<std::int32_t>(static_cast<std::int32_t>(long_elems + short_elems) - static_cast<std::int32_t>(INT8_C(1))), short_elems)
+        );
+
+      short_elems_array_type short_limbs; // NOLINT(cppcoreguidelines-pro-type-member-init,hicpp-member-init)
+
+      // The product is formed in the inline limbs of a small-buffer
+      // representation, if these suffice.
+      if(v_is_short)
+      {
+        v.eval_copy_short_elems(short_limbs, short_elems);
+      }
+      else
+      {
+        eval_copy_short_elems(short_limbs, short_elems);
+
+        std::copy(v.my_data.cbegin(),
+                  v.my_data.cbegin() + static_cast<std::ptrdiff_t>(product_elems),
+                  detail::elems_begin(my_data, product_elems));
+      }
+
+      const auto carry =
+        detail::mul_loop_n_by_m(detail::elems_begin(my_data, product_elems),
+                                short_limbs.cbegin(),
+                                short_elems,
+                                product_elems);
+
+      auto used_elems_max = (std::max)(my_used_elem, product_elems);
+
+      if(carry != static_cast<limb_type>(UINT8_C(0)))
+      {
+        // Shift the product one limb to the right within the precision
+        // in order to make place for the carry.
+        my_exp = static_cast<exponent_type>(my_exp + static_cast<exponent_type>(decwide_t_elem_digits10));
+
+        const auto shift_elems = (std::min)(product_elems, static_cast<std::int32_t>(prec_elems_for_multiply - 1));
+
+        auto p_data = detail::elems_begin(my_data, static_cast<std::int32_t>(shift_elems + 1));
+
+        std::copy_backward(p_data,
+                           p_data + static_cast<std::ptrdiff_t>(shift_elems),
+                           p_data + static_cast<std::ptrdiff_t>(shift_elems + 1));
+
+        *p_data = carry;
+
+        used_elems_max = (std::max)(used_elems_max, static_cast<std::int32_t>(shift_elems + 1));
+      }
+
+      eval_set_used_elems(used_elems_max);
+
+      return true;
+    }
+
     auto from_unsigned_long_long(unsigned long long u) -> void // NOLINT(google-runtime-int)
     {
       my_exp = static_cast<exponent_type>(INT8_C(0));
@@ -2737,13 +3973,16 @@
                      static_cast<std::uint_fast32_t>(decwide_t_elem_number))
         );
 
-      std::copy(tmp.cbegin(),
-                tmp.cbegin() + static_cast<std::ptrdiff_t>((std::min)(static_cast<std::ptrdiff_t>(i), copy_limit)),
-                my_data.begin());
+      eval_clear_elems(static_cast<std::int32_t>(INT8_C(0)), decwide_t_elem_number);
 
-      std::fill(my_data.begin() + static_cast<std::ptrdiff_t>((std::min)(static_cast<std::ptrdiff_t>(i), copy_limit)),
-                my_data.end(),
-                static_cast<limb_type>(UINT8_C(0)));
+      using local_size_type = typename representation_type::size_type;
+
+      for(auto j = static_cast<std::ptrdiff_t>(INT8_C(0)); j < (std::min)(static_cast<std::ptrdiff_t>(i), copy_limit); ++j)
+      {
+        my_data[static_cast<local_size_type>(j)] = tmp[static_cast<std::size_t>(j)]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+      }
+
+      eval_set_used_elems(static_cast<std::int32_t>((std::min)(static_cast<std::ptrdiff_t>(i), copy_limit)));
     }
 
     template<typename FloatingPointType>
@@ -2789,48 +4028,35 @@
       static_cast<void>(p_nullparam);
 
       // Use school multiplication.
-      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
-      using school_mul_pool_type = util::dynamic_array<limb_type>;
-
-      auto my_school_mul_pool =
-        school_mul_pool_type
-        (
-          static_cast<typename school_mul_pool_type::size_type>
-          (
-              static_cast<typename school_mul_pool_type::size_type>(prec_elems_for_multiply)
-            * static_cast<typename school_mul_pool_type::size_type>(UINT8_C(2))
-          )
-        );
-      #endif
-
-      limb_type* result = my_school_mul_pool.data();
-
-      using const_limb_pointer_type = typename std::add_const<limb_type*>::type;
+      eval_mul_school(v, prec_elems_for_multiply);
+    }
 
-      detail::eval_multiply_n_by_n_to_2n(result,
-                                         const_cast<const_limb_pointer_type>(my_data.data()),   // NOLINT(cppcoreguidelines-pro-type-const-cast)
-                                         const_cast<const_limb_pointer_type>(v.my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
-                                         prec_elems_for_multiply);
+    template<const ::std::int32_t OtherDigits10>
+    auto eval_mul_dispatch_multiplication_method
+    (
+      const decwide_t<OtherDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v,
+      const ::std::int32_t prec_elems_for_multiply,
+      const typename std::enable_if<(   (OtherDigits10 == ParamDigitsBaseTen)
+                                     && (decwide_t<OtherDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number >= decwide_t_elems_for_kara)
+                                     && (decwide_t<OtherDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number <  decwide_t_elems_for_fft))>::type* p_nullparam = nullptr
+    ) -> void
+    {
+      static_cast<void>(p_nullparam);
 
-      // Handle a potential carry.
-      if(result[static_cast<std::size_t>(UINT8_C(0))] != static_cast<limb_type>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      if(prec_elems_for_multiply < decwide_t_elems_for_kara)
       {
-        my_exp = static_cast<exponent_type>(my_exp + static_cast<exponent_type>(decwide_t_elem_digits10));
-
-        // Shift the result of the multiplication one element to the right.
-        std::copy(result,
-                  result + static_cast<std::ptrdiff_t>(prec_elems_for_multiply), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                  my_data.begin());
+        // Use school multiplication.
+        eval_mul_school(v, prec_elems_for_multiply);
+      }
+      else if(prec_elems_for_multiply < decwide_t_elems_for_toom3)
+      {
+        // Use Karatsuba multiplication.
+        eval_mul_kara(v, prec_elems_for_multiply);
       }
       else
       {
-        const auto kara_limit = (std::min)(decwide_t_elem_number, decwide_t_elems_for_kara);
-
-        const auto copy_limit = static_cast<std::ptrdiff_t>((std::min)(prec_elems_for_multiply, kara_limit));
-
-        std::copy(result +                             static_cast<std::ptrdiff_t>(INT8_C(1)),               // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                  result + static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(INT8_C(1)) + copy_limit), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                  my_data.begin());
+        // Use Toom-Cook 3-way multiplication.
+        eval_mul_toom3(v, prec_elems_for_multiply);
       }
     }
 
@@ -2840,8 +4066,8 @@
       const decwide_t<OtherDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v,
       const ::std::int32_t prec_elems_for_multiply,
       const typename std::enable_if<(   (OtherDigits10 == ParamDigitsBaseTen)
-                                     && (decwide_t<OtherDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number >= decwide_t_elems_for_kara)
-                                     && (decwide_t<OtherDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number <  decwide_t_elems_for_fft))>::type* p_nullparam = nullptr
+                                     && (decwide_t<OtherDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number >= decwide_t_elems_for_fft)
+                                     && (decwide_t<OtherDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number <  decwide_t_elems_for_ntt))>::type* p_nullparam = nullptr
     ) -> void
     {
       static_cast<void>(p_nullparam);
@@ -2849,291 +4075,501 @@
       if(prec_elems_for_multiply < decwide_t_elems_for_kara)
       {
         // Use school multiplication.
-        #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
-        using school_mul_pool_type = util::dynamic_array<limb_type>;
+        eval_mul_school(v, prec_elems_for_multiply);
+      }
+      else if(prec_elems_for_multiply < decwide_t_elems_for_toom3)
+      {
+        // Use Karatsuba multiplication.
+        eval_mul_kara(v, prec_elems_for_multiply);
+      }
+      else if(prec_elems_for_multiply < decwide_t_elems_for_fft)
+      {
+        // Use Toom-Cook 3-way multiplication.
+        eval_mul_toom3(v, prec_elems_for_multiply);
+      }
+      else
+      {
+        // Use FFT-based multiplication.
+        eval_mul_fft(v, prec_elems_for_multiply);
+      }
+    }
 
-        auto my_school_mul_pool =
-          school_mul_pool_type
-          (
-            static_cast<typename school_mul_pool_type::size_type>
-            (
-                static_cast<typename school_mul_pool_type::size_type>(prec_elems_for_multiply)
-              * static_cast<typename school_mul_pool_type::size_type>(UINT8_C(2))
-            )
-          );
-        #endif
+    template<const ::std::int32_t OtherDigits10>
+    auto eval_mul_dispatch_multiplication_method
+    (
+      const decwide_t<OtherDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v,
+      const ::std::int32_t prec_elems_for_multiply,
+      const typename std::enable_if<(   (OtherDigits10 == ParamDigitsBaseTen)
+                                     && (decwide_t<OtherDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number >= decwide_t_elems_for_fft)
+                                     && (decwide_t<OtherDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number >= decwide_t_elems_for_ntt))>::type* p_nullparam = nullptr
+    ) -> void
+    {
+      static_cast<void>(p_nullparam);
 
-        limb_type* result = my_school_mul_pool.data();
+      // The NTT supports transform lengths up to 2^24, in other words
+      // up to 2^23 limbs (2^22 limbs for 64-bit limbs). Beyond this,
+      // the FFT is used nonetheless.
+      const auto prec_elems_is_in_ntt_range =
+        (   (prec_elems_for_multiply >= decwide_t_elems_for_ntt)
+         && (static_cast<std::uint32_t>(static_cast<std::uint32_t>(prec_elems_for_multiply) * detail::decwide_t_helper_base<limb_type>::ntt_points_per_limb) <= static_cast<std::uint32_t>(detail::ntt::ntt_max_length() / 2U)));
 
-        using const_limb_pointer_type = typename std::add_const<limb_type*>::type;
+      if(prec_elems_for_multiply < decwide_t_elems_for_kara)
+      {
+        // Use school multiplication.
+        eval_mul_school(v, prec_elems_for_multiply);
+      }
+      else if(prec_elems_for_multiply < decwide_t_elems_for_toom3)
+      {
+        // Use Karatsuba multiplication.
+        eval_mul_kara(v, prec_elems_for_multiply);
+      }
+      else if(prec_elems_for_multiply < decwide_t_elems_for_fft)
+      {
+        // Use Toom-Cook 3-way multiplication.
+        eval_mul_toom3(v, prec_elems_for_multiply);
+      }
+      else if(!prec_elems_is_in_ntt_range)
+      {
+        // Use FFT-based multiplication.
+        eval_mul_fft(v, prec_elems_for_multiply);
+      }
+      else
+      {
+        // Use exact NTT-based multiplication.
+        eval_mul_ntt(v, prec_elems_for_multiply);
+      }
+    }
+
+    auto eval_mul_prepared(const prepared_multiplier& p, const std::int32_t prec_elems_for_multiply) -> bool
+    {
+      // Multiply *this by the prepared multiplier if its cached data
+      // match the precision of the multiplication. Otherwise return
+      // false so that the regular multiplication method is used.
+      // The prepared multiplier is a distinct object, so the general
+      // (non-squaring) paths of the kernels are used, also for x *= p
+      // with x equal to p.value(). The results are those of x *= v for
+      // a distinct operand v having the value of p. They also equal those
+      // of x *= x, although the schoolbook and Karatsuba short products
+      // truncate: their squaring paths sum the same truncated columns as
+      // the general paths (the cross products a1 * a0 and a0 * a1 of
+      // Karatsuba are computed once and added twice).
+      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+      if(prec_elems_for_multiply != p.my_prec_elems_for_multiply)
+      {
+        return false;
+      }
 
-        detail::eval_multiply_n_by_n_to_2n(result,
-                                           const_cast<const_limb_pointer_type>(my_data.data()),   // NOLINT(cppcoreguidelines-pro-type-const-cast)
-                                           const_cast<const_limb_pointer_type>(v.my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
-                                           prec_elems_for_multiply);
+      auto result_is_prepared = true;
 
-        // Handle a potential carry.
-        if(result[static_cast<std::size_t>(UINT8_C(0))] != static_cast<limb_type>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      if(!p.my_fft_data.empty())
+      {
+        eval_mul_fft(p.value(), prec_elems_for_multiply, p.my_fft_data.data());
+      }
+      else if(!p.my_padded_data.empty())
+      {
+        if(prec_elems_for_multiply < decwide_t_elems_for_toom3)
         {
-          my_exp = static_cast<exponent_type>(my_exp + static_cast<exponent_type>(decwide_t_elem_digits10));
-
-          // Shift the result of the multiplication one element to the right.
-          std::copy(result,
-                    result + static_cast<std::ptrdiff_t>(prec_elems_for_multiply), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    my_data.begin());
+          eval_mul_kara(p.value(), prec_elems_for_multiply, p.my_padded_data.data());
         }
         else
         {
-          const auto kara_limit = (std::min)(decwide_t_elem_number, decwide_t_elems_for_kara);
+          eval_mul_toom3(p.value(), prec_elems_for_multiply, p.my_padded_data.data());
+        }
+      }
+      else
+      {
+        result_is_prepared = false;
+      }
 
-          const auto copy_limit = static_cast<std::ptrdiff_t>((std::min)(prec_elems_for_multiply, kara_limit));
+      return result_is_prepared;
+      #else
+      // Without dynamic memory allocation, the prepared
+      // multiplier does not hold any cached data.
+      static_cast<void>(p);
+      static_cast<void>(prec_elems_for_multiply);
 
-          std::copy(result +                             static_cast<std::ptrdiff_t>(INT8_C(1)),               // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    result + static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(INT8_C(1)) + copy_limit), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    my_data.begin());
-        }
+      return false;
+      #endif
+    }
+
+    auto eval_mul_store_result(const limb_type* result, const std::int32_t prec_elems_for_multiply) -> void
+    {
+      // Store the (2n)-limb result of an (n * n) multiplication
+      // in the data of *this and handle a potential carry.
+      if(result[static_cast<std::size_t>(UINT8_C(0))] != static_cast<limb_type>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        my_exp = static_cast<exponent_type>(my_exp + static_cast<exponent_type>(decwide_t_elem_digits10));
+
+        // Shift the result of the multiplication one element to the right.
+        std::copy(result,
+                  result + static_cast<std::ptrdiff_t>(prec_elems_for_multiply), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                  my_data.begin());
       }
-      else if(   (prec_elems_for_multiply >= decwide_t_elems_for_kara)
-              && (prec_elems_for_multiply <  decwide_t_elems_for_fft))
+      else
       {
-        // Karatsuba multiplication.
+        const auto copy_limit = static_cast<std::ptrdiff_t>((std::min)(prec_elems_for_multiply, decwide_t_elem_number));
 
-        // Sloanes's A029750: Numbers of the form 2^k times 1, 3, 5 or 7.
-        const auto kara_elems_for_multiply =
-          detail::a029750::a029750_as_runtime_value(static_cast<std::uint32_t>(prec_elems_for_multiply));
+        std::copy(result +                             static_cast<std::ptrdiff_t>(INT8_C(1)),               // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                  result + static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(INT8_C(1)) + copy_limit), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                  my_data.begin());
+      }
+    }
 
-        #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
-        using kara_mul_pool_type = util::dynamic_array<limb_type>;
+    auto eval_mul_school(const decwide_t& v, const std::int32_t prec_elems_for_multiply) -> void
+    {
+      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+      using school_mul_pool_type = detail::scratch_frame<limb_type>;
 
-        auto my_kara_mul_pool =
-          kara_mul_pool_type
+      school_mul_pool_type
+        my_school_mul_pool
+        (
+          static_cast<typename school_mul_pool_type::size_type>
           (
-            static_cast<typename kara_mul_pool_type::size_type>
-            (
-                static_cast<typename kara_mul_pool_type::size_type>(kara_elems_for_multiply)
-              * static_cast<typename kara_mul_pool_type::size_type>(UINT8_C(8))
-            )
-          );
-        #endif
+              static_cast<typename school_mul_pool_type::size_type>(prec_elems_for_multiply)
+            * static_cast<typename school_mul_pool_type::size_type>(UINT8_C(2))
+          )
+        );
+      #endif
+
+      limb_type* result = my_school_mul_pool.data();
 
-        limb_type* u_local = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        limb_type* v_local = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(1))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        limb_type* result  = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(2))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        limb_type* t       = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(4))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      using const_limb_pointer_type = typename std::add_const<limb_type*>::type;
 
-        std::copy(my_data.cbegin(), my_data.cbegin() + prec_elems_for_multiply, u_local);
+      // Only the limbs result[0 ... prec_elems_for_multiply]
+      // are stored, so a short product suffices.
+      const auto high_count = static_cast<std::int32_t>(prec_elems_for_multiply + static_cast<std::int32_t>(INT8_C(1)));
+
+      if(this == &v)
+      {
+        detail::eval_square_n_to_high(result,
+                                      const_cast<const_limb_pointer_type>(my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                                      prec_elems_for_multiply,
+                                      high_count);
+      }
+      else
+      {
+        detail::eval_multiply_n_by_n_to_high(result,
+                                             const_cast<const_limb_pointer_type>(my_data.data()),   // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                                             const_cast<const_limb_pointer_type>(v.my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                                             prec_elems_for_multiply,
+                                             high_count);
+      }
+
+      eval_mul_store_result(result, prec_elems_for_multiply);
+    }
+
+    auto eval_mul_kara(const decwide_t& v, const std::int32_t prec_elems_for_multiply, const limb_type* v_prepared = nullptr) -> void
+    {
+      // Use Sloane's A029750: The so-called 7-smooth numbers having the form 2^k times 1, 3, 5 or 7.
+      const auto kara_elems_for_multiply =
+        detail::a029750::a029750_as_runtime_value(static_cast<std::uint32_t>(prec_elems_for_multiply));
+
+      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+      using kara_mul_pool_type = detail::scratch_frame<limb_type>;
+
+      // The pool holds the padded operands u and v (1n each),
+      // the result (2n) and the temporary storage (4n, or more
+      // for the multithreaded Karatsuba multiplication).
+      #if defined(WIDE_DECIMAL_MUL_PARALLEL)
+      const auto kara_temp_elems = detail::eval_multiply_kara_high_parallel_temp_elems(static_cast<std::uint_fast32_t>(kara_elems_for_multiply));
+      #else
+      const auto kara_temp_elems = static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(4)));
+      #endif
+
+      kara_mul_pool_type
+        my_kara_mul_pool
+        (
+          static_cast<typename kara_mul_pool_type::size_type>
+          (
+              static_cast<typename kara_mul_pool_type::size_type>(static_cast<typename kara_mul_pool_type::size_type>(kara_elems_for_multiply) * static_cast<typename kara_mul_pool_type::size_type>(UINT8_C(4)))
+            + static_cast<typename kara_mul_pool_type::size_type>(kara_temp_elems)
+          )
+        );
+      #endif
+
+      limb_type* u_local = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      limb_type* v_local = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(1))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      limb_type* result  = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(2))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      limb_type* t       = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(4))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      std::copy(my_data.cbegin(), my_data.cbegin() + prec_elems_for_multiply, u_local);
+      std::fill(u_local + prec_elems_for_multiply, u_local + kara_elems_for_multiply, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      if(this == &v)
+      {
+        // Squaring is recognized by identical operands in the kernel.
+        v_local = u_local;
+      }
+      else if(v_prepared != nullptr)
+      {
+        // The padded copy of v is taken from a prepared multiplier.
+        v_local = const_cast<limb_type*>(v_prepared); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+      }
+      else
+      {
         std::copy(v.my_data.cbegin(), v.my_data.cbegin() + static_cast<std::ptrdiff_t>(prec_elems_for_multiply), v_local);
-
-        std::fill(u_local + prec_elems_for_multiply, u_local + kara_elems_for_multiply, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
         std::fill(v_local + prec_elems_for_multiply, v_local + kara_elems_for_multiply, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      // Only the limbs result[0 ... prec_elems_for_multiply] are stored.
+      // The short product computes these with one or two guard limbs.
+      const auto high_count =
+        (std::min)
+        (
+          static_cast<std::uint_fast32_t>(static_cast<std::uint_fast32_t>(static_cast<std::uint_fast32_t>(prec_elems_for_multiply) + 1U) + detail::eval_multiply_kara_high_guard_elems<limb_type>(static_cast<std::uint_fast32_t>(kara_elems_for_multiply))),
+          static_cast<std::uint_fast32_t>(static_cast<std::uint_fast32_t>(kara_elems_for_multiply) * 2U)
+        );
 
-        detail::eval_multiply_kara_n_by_n_to_2n(result,
+      #if defined(WIDE_DECIMAL_MUL_PARALLEL)
+      detail::eval_multiply_kara_n_by_n_to_high_parallel(result,
+                                                         static_cast<const limb_type*>(u_local),
+                                                         static_cast<const limb_type*>(v_local),
+                                                         static_cast<std::uint_fast32_t>(kara_elems_for_multiply),
+                                                         high_count,
+                                                         t);
+      #else
+      detail::eval_multiply_kara_n_by_n_to_high(result,
                                                 u_local,
                                                 v_local,
                                                 kara_elems_for_multiply,
+                                                high_count,
                                                 t);
+      #endif
 
-        // Handle a potential carry.
-        if(result[static_cast<std::size_t>(UINT8_C(0))] != static_cast<limb_type>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        {
-          my_exp = static_cast<exponent_type>(my_exp + static_cast<exponent_type>(decwide_t_elem_digits10));
-
-          // Shift the result of the multiplication one element to the right.
-          std::copy(result,
-                    result + static_cast<std::ptrdiff_t>(prec_elems_for_multiply), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    my_data.begin());
-        }
-        else
-        {
-          const auto fft_limit = (std::min)(decwide_t_elem_number, decwide_t_elems_for_fft);
-
-          const auto copy_limit = static_cast<std::ptrdiff_t>((std::min)(prec_elems_for_multiply, fft_limit));
-
-          std::copy(result +                             static_cast<std::ptrdiff_t>(INT8_C(1)),               // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    result + static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(INT8_C(1)) + copy_limit), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    my_data.begin());
-        }
-      }
+      eval_mul_store_result(result, prec_elems_for_multiply);
     }
 
-    template<const ::std::int32_t OtherDigits10>
-    auto eval_mul_dispatch_multiplication_method
-    (
-      const decwide_t<OtherDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v,
-      const ::std::int32_t prec_elems_for_multiply,
-      const typename std::enable_if<(   (OtherDigits10 == ParamDigitsBaseTen)
-                                     && (decwide_t<OtherDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number >= decwide_t_elems_for_fft))>::type* p_nullparam = nullptr
-    ) -> void
+    auto eval_mul_toom3(const decwide_t& v, const std::int32_t prec_elems_for_multiply, const limb_type* v_prepared = nullptr) -> void
     {
-      static_cast<void>(p_nullparam);
-
-      if(prec_elems_for_multiply < decwide_t_elems_for_kara)
-      {
-        // Use school multiplication.
-        #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
-        using school_mul_pool_type = util::dynamic_array<limb_type>;
+      // The Toom-Cook 3-way multiplication splits its operands into
+      // three parts, each of which is subsequently multiplied with
+      // Karatsuba multiplication (or recursively with Toom-Cook 3-way).
+      // So the operand size is padded to three (or nine) times
+      // a number from Sloane's A029750.
+      const auto toom3_elems_for_multiply =
+        detail::toom3_elems_as_runtime_value(static_cast<std::uint32_t>(prec_elems_for_multiply));
+
+      // The scratch pool holds the padded operands u and v (1n each),
+      // the result (2n) and the temporary storage (10n).
+      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+      using toom3_mul_pool_type = detail::scratch_frame<limb_type>;
 
-        auto my_school_mul_pool =
-          school_mul_pool_type
+      toom3_mul_pool_type
+        my_toom3_mul_pool
+        (
+          static_cast<typename toom3_mul_pool_type::size_type>
           (
-            static_cast<typename school_mul_pool_type::size_type>
-            (
-                static_cast<typename school_mul_pool_type::size_type>(prec_elems_for_multiply)
-              * static_cast<typename school_mul_pool_type::size_type>(UINT8_C(2))
-            )
-          );
+              static_cast<typename toom3_mul_pool_type::size_type>(toom3_elems_for_multiply)
+            * static_cast<typename toom3_mul_pool_type::size_type>(UINT8_C(14))
+          )
+        );
+      #endif
 
-        #endif
+      limb_type* u_local = my_toom3_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(toom3_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      limb_type* v_local = my_toom3_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(toom3_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(1))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      limb_type* result  = my_toom3_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(toom3_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(2))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      limb_type* t       = my_toom3_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(toom3_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(4))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-        limb_type* result = my_school_mul_pool.data();
+      std::copy(my_data.cbegin(), my_data.cbegin() + prec_elems_for_multiply, u_local);
+      std::fill(u_local + prec_elems_for_multiply, u_local + toom3_elems_for_multiply, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-        using const_limb_pointer_type = typename std::add_const<limb_type*>::type;
+      if(this == &v)
+      {
+        // Squaring is recognized by identical operands in the kernel.
+        v_local = u_local;
+      }
+      else if(v_prepared != nullptr)
+      {
+        // The padded copy of v is taken from a prepared multiplier.
+        v_local = const_cast<limb_type*>(v_prepared); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+      }
+      else
+      {
+        std::copy(v.my_data.cbegin(), v.my_data.cbegin() + static_cast<std::ptrdiff_t>(prec_elems_for_multiply), v_local);
+        std::fill(v_local + prec_elems_for_multiply, v_local + toom3_elems_for_multiply, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
 
-        detail::eval_multiply_n_by_n_to_2n(result,
-                                           const_cast<const_limb_pointer_type>(my_data.data()),   // NOLINT(cppcoreguidelines-pro-type-const-cast)
-                                           const_cast<const_limb_pointer_type>(v.my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
-                                           prec_elems_for_multiply);
+      detail::eval_multiply_toom3_n_by_n_to_2n(result,
+                                               u_local,
+                                               v_local,
+                                               toom3_elems_for_multiply,
+                                               t);
 
-        // Handle a potential carry.
-        if(result[static_cast<std::size_t>(UINT8_C(0))] != static_cast<limb_type>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        {
-          my_exp += static_cast<exponent_type>(decwide_t_elem_digits10);
+      eval_mul_store_result(result, prec_elems_for_multiply);
+    }
 
-          // Shift the result of the multiplication one element to the right.
-          std::copy(result,
-                    result + static_cast<std::ptrdiff_t>(prec_elems_for_multiply), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    my_data.begin());
-        }
-        else
-        {
-          const auto kara_limit = (std::min)(decwide_t_elem_number, decwide_t_elems_for_kara);
+    auto eval_mul_fft(const decwide_t& v, const std::int32_t prec_elems_for_multiply, const fft_float_type* v_prepared = nullptr) -> void
+    {
+      // Determine the required FFT size n_fft,
+      // where n_fft must be a power of two.
+
+      // We use half-limbs in the FFT in order to reduce
+      // the size of the data points in the FFTs.
+      // This helps preserve precision for large
+      // array lengths.
+
+      // The size is doubled in order to contain the multiplication
+      // result. This is because we are performing (n * n -> 2n)
+      // multiplication. Furthermore, the FFT size is doubled again
+      // since half-limbs are used (or quadrupled for the quarter-limbs
+      // of 64-bit limbs).
+
+      // Obtain the needed FFT size doubled (and doubled again),
+      // with the added condition of needing to be a power of 2.
+      const auto n_fft =
+        static_cast<std::uint32_t>
+        (
+            detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(prec_elems_for_multiply))
+          * static_cast<std::uint32_t>(static_cast<std::uint32_t>(UINT8_C(2)) * detail::decwide_t_helper_base<limb_type>::fft_points_per_limb)
+        );
 
-          const auto copy_limit = static_cast<std::ptrdiff_t>((std::min)(prec_elems_for_multiply, kara_limit));
+      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+      // The twiddle table and the scratch buffers are taken
+      // from the (thread-local) FFT plan of this float type.
+      auto& my_fft_plan = detail::fft::fft_plan_cache<fft_float_type>(n_fft);
 
-          std::copy(result +                             static_cast<std::ptrdiff_t>(INT8_C(1)),               // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    result + static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(INT8_C(1)) + copy_limit), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    my_data.begin());
-        }
-      }
-      else if(   (prec_elems_for_multiply >= decwide_t_elems_for_kara)
-              && (prec_elems_for_multiply <  decwide_t_elems_for_fft))
+      fft_float_type*       fft_af = my_fft_plan.af();
+      fft_float_type*       fft_bf = my_fft_plan.bf();
+      const fft_float_type* fft_tw = my_fft_plan.twiddles();
+      #else
+      // The static twiddle table is regenerated only
+      // when a larger FFT size is needed.
+      if(n_fft > my_fft_twiddle_size)
       {
-        // Use Karatsuba multiplication.
+        detail::fft::fft_make_twiddles(n_fft, my_fft_twiddle_pool.data());
 
-        // Use Sloane's A029750: The so-called 7-smooth numbers having the form 2^k times 1, 3, 5 or 7.
-        const auto kara_elems_for_multiply =
-          detail::a029750::a029750_as_runtime_value(static_cast<std::uint32_t>(prec_elems_for_multiply));
-
-        #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
-        using kara_mul_pool_type = util::dynamic_array<limb_type>;
+        my_fft_twiddle_size = n_fft;
+      }
 
-        auto my_kara_mul_pool =
-          kara_mul_pool_type
-          (
-            static_cast<typename kara_mul_pool_type::size_type>
-            (
-                static_cast<typename kara_mul_pool_type::size_type>(kara_elems_for_multiply)
-              * static_cast<typename kara_mul_pool_type::size_type>(UINT8_C(8))
-            )
-          );
-        #endif
+      fft_float_type*       fft_af = my_af_fft_mul_pool.data();
+      fft_float_type*       fft_bf = my_bf_fft_mul_pool.data();
+      const fft_float_type* fft_tw = my_fft_twiddle_pool.data();
+      #endif
 
-        limb_type* u_local = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        limb_type* v_local = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(1))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        limb_type* result  = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(2))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        limb_type* t       = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(4))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      using const_limb_pointer_type = typename std::add_const<limb_type*>::type;
 
-        std::copy(my_data.cbegin(), my_data.cbegin() + prec_elems_for_multiply, u_local);
-        std::copy(v.my_data.cbegin(), v.my_data.cbegin() + static_cast<std::ptrdiff_t>(prec_elems_for_multiply), v_local);
+      if(v_prepared != nullptr)
+      {
+        // The forward FFT of v is taken from a prepared multiplier.
+        detail::mul_loop_fft_transformed(my_data.data(),
+                                         const_cast<const_limb_pointer_type>(my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                                         fft_af,
+                                         v_prepared,
+                                         fft_tw,
+                                         static_cast<std::int32_t>(prec_elems_for_multiply),
+                                         n_fft);
+      }
+      else
+      {
+        detail::mul_loop_fft(my_data.data(),
+                             const_cast<const_limb_pointer_type>(  my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                             const_cast<const_limb_pointer_type>(v.my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                             fft_af,
+                             fft_bf,
+                             fft_tw,
+                             static_cast<std::int32_t>(prec_elems_for_multiply),
+                             n_fft);
+      }
 
-        std::fill(u_local + prec_elems_for_multiply, u_local + kara_elems_for_multiply, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        std::fill(v_local + prec_elems_for_multiply, v_local + kara_elems_for_multiply, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+      if(n_fft > detail::mul_transform_cache_max_points())
+      {
+        detail::fft::fft_plan_cache_release<fft_float_type>();
+      }
+      #endif
 
-        detail::eval_multiply_kara_n_by_n_to_2n(result,
-                                                u_local,
-                                                v_local,
-                                                kara_elems_for_multiply,
-                                                t);
+      if(my_data.front() != static_cast<limb_type>(UINT8_C(0)))
+      {
+        // Adjust the exponent because of the internal scaling of the FFT multiplication.
+        my_exp += static_cast<exponent_type>(decwide_t_elem_digits10);
+      }
+      else
+      {
+        // The product occupies the limbs [0, prec_elems_for_multiply).
+        // Shift it one limb to the left within these limbs.
+        const auto copy_limit = static_cast<std::ptrdiff_t>((std::min)(prec_elems_for_multiply, decwide_t_elem_number));
 
-        // Handle a potential carry.
-        if(result[static_cast<std::size_t>(UINT8_C(0))] != static_cast<limb_type>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        {
-          my_exp = static_cast<exponent_type>(my_exp + static_cast<exponent_type>(decwide_t_elem_digits10));
+        std::copy(my_data.cbegin() + static_cast<std::ptrdiff_t>(INT8_C(1)), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                  my_data.cbegin() + copy_limit,                             // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                  my_data.begin());
 
-          // Shift the result of the multiplication one element to the right.
-          std::copy(result,
-                    result + static_cast<std::ptrdiff_t>(prec_elems_for_multiply), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    my_data.begin());
-        }
-        else
-        {
-          const auto fft_limit = (std::min)(decwide_t_elem_number, decwide_t_elems_for_fft);
+        my_data[static_cast<std::size_t>(copy_limit - static_cast<std::ptrdiff_t>(INT8_C(1)))] = static_cast<limb_type>(UINT8_C(0));
+      }
+    }
 
-          const auto copy_limit = static_cast<std::ptrdiff_t>((std::min)(prec_elems_for_multiply, fft_limit));
+    auto eval_mul_ntt(const decwide_t& v, const std::int32_t prec_elems_for_multiply) -> void
+    {
+      // Determine the required NTT size n_ntt, where n_ntt must be
+      // a power of two that contains the (n * n -> 2n) multiplication
+      // result. Full limbs (half-limbs for 64-bit limbs) are used
+      // in the NTT, since the three-prime transform is exact.
+      const auto n_ntt = detail::ntt::ntt_length_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(prec_elems_for_multiply) * detail::decwide_t_helper_base<limb_type>::ntt_points_per_limb));
 
-          std::copy(result +                             static_cast<std::ptrdiff_t>(INT8_C(1)),               // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    result + static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(INT8_C(1)) + copy_limit), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    my_data.begin());
-        }
-      }
-      else if(prec_elems_for_multiply >= decwide_t_elems_for_fft)
-      {
-        // Use FFT-based multiplication.
+      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+      using ntt_mul_storage_type = detail::scratch_frame<std::uint32_t>;
 
-        // Determine the required FFT size n_fft,
-        // where n_fft must be a power of two.
+      ntt_mul_storage_type my_ntt_mul_pool(static_cast<typename ntt_mul_storage_type::size_type>(n_ntt * static_cast<std::uint32_t>(UINT8_C(4))));
 
-        // We use half-limbs in the FFT in order to reduce
-        // the size of the data points in the FFTs.
-        // This helps preserve precision for large
-        // array lengths.
+      // The twiddle tables are taken from the (thread-local) NTT plans.
+      const std::uint32_t* ntt_tw0 = detail::ntt::ntt_plan_cache<detail::ntt::ntt_prime_0>(n_ntt).twiddles();
+      const std::uint32_t* ntt_tw1 = detail::ntt::ntt_plan_cache<detail::ntt::ntt_prime_1>(n_ntt).twiddles();
+      const std::uint32_t* ntt_tw2 = detail::ntt::ntt_plan_cache<detail::ntt::ntt_prime_2>(n_ntt).twiddles();
+      #else
+      // The static twiddle tables are regenerated only
+      // when a longer NTT is needed.
+      const auto ntt_twiddle_pool_stride = static_cast<std::size_t>(my_ntt_twiddle_pool.size() / 3U);
 
-        // The size is doubled in order to contain the multiplication
-        // result. This is because we are performing (n * n -> 2n)
-        // multiplication. Furthermore, the FFT size is doubled again
-        // since half-limbs are used.
+      std::uint32_t* ntt_tw0 = my_ntt_twiddle_pool.data();
+      std::uint32_t* ntt_tw1 = ntt_tw0 + ntt_twiddle_pool_stride; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::uint32_t* ntt_tw2 = ntt_tw1 + ntt_twiddle_pool_stride; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-        // Obtain the needed FFT size doubled (and doubled again),
-        // with the added condition of needing to be a power of 2.
-        const auto n_fft =
-          static_cast<std::uint32_t>
-          (
-              detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(prec_elems_for_multiply))
-            * static_cast<std::uint32_t>(UINT8_C(4))
-          );
+      if(n_ntt > my_ntt_twiddle_size)
+      {
+        detail::ntt::ntt_make_twiddles<detail::ntt::ntt_prime_0>(n_ntt, ntt_tw0);
+        detail::ntt::ntt_make_twiddles<detail::ntt::ntt_prime_1>(n_ntt, ntt_tw1);
+        detail::ntt::ntt_make_twiddles<detail::ntt::ntt_prime_2>(n_ntt, ntt_tw2);
 
-        #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
-        using fft_mul_storage_type = util::dynamic_array<fft_float_type>;
+        my_ntt_twiddle_size = n_ntt;
+      }
+      #endif
 
-        auto my_af_fft_mul_pool = fft_mul_storage_type(static_cast<typename fft_mul_storage_type::size_type>(n_fft));
-        auto my_bf_fft_mul_pool = fft_mul_storage_type(static_cast<typename fft_mul_storage_type::size_type>(n_fft));
-        #endif
+      using const_limb_pointer_type = typename std::add_const<limb_type*>::type;
 
-        using const_limb_pointer_type = typename std::add_const<limb_type*>::type;
+      detail::mul_loop_ntt(my_data.data(),
+                           const_cast<const_limb_pointer_type>(  my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                           const_cast<const_limb_pointer_type>(v.my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                           my_ntt_mul_pool.data(),
+                           ntt_tw0,
+                           ntt_tw1,
+                           ntt_tw2,
+                           static_cast<std::int32_t>(prec_elems_for_multiply),
+                           n_ntt);
 
-        detail::mul_loop_fft(my_data.data(),
-                             const_cast<const_limb_pointer_type>(  my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
-                             const_cast<const_limb_pointer_type>(v.my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
-                             my_af_fft_mul_pool.data(),
-                             my_bf_fft_mul_pool.data(),
-                             static_cast<std::int32_t>(prec_elems_for_multiply),
-                             n_fft);
+      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+      if(n_ntt > detail::mul_transform_cache_max_points())
+      {
+        detail::ntt::ntt_plan_cache_release<detail::ntt::ntt_prime_0>();
+        detail::ntt::ntt_plan_cache_release<detail::ntt::ntt_prime_1>();
+        detail::ntt::ntt_plan_cache_release<detail::ntt::ntt_prime_2>();
+      }
+      #endif
 
-        if(my_data.front() != static_cast<limb_type>(UINT8_C(0)))
-        {
-          // Adjust the exponent because of the internal scaling of the FFT multiplication.
-          my_exp += static_cast<exponent_type>(decwide_t_elem_digits10);
-        }
-        else
-        {
-          const auto copy_limit = static_cast<std::ptrdiff_t>((std::min)(prec_elems_for_multiply, decwide_t_elem_number));
+      if(my_data.front() != static_cast<limb_type>(UINT8_C(0)))
+      {
+        // Adjust the exponent because of the internal scaling of the NTT multiplication.
+        my_exp += static_cast<exponent_type>(decwide_t_elem_digits10);
+      }
+      else
+      {
+        // The product occupies the limbs [0, prec_elems_for_multiply).
+        // Shift it one limb to the left within these limbs.
+        const auto copy_limit = static_cast<std::ptrdiff_t>((std::min)(prec_elems_for_multiply, decwide_t_elem_number));
 
-          std::copy(my_data.cbegin() +                             static_cast<std::ptrdiff_t>(INT8_C(1)),               // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    my_data.cbegin() + static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(INT8_C(1)) + copy_limit), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    my_data.begin());
+        std::copy(my_data.cbegin() + static_cast<std::ptrdiff_t>(INT8_C(1)), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                  my_data.cbegin() + copy_limit,                             // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                  my_data.begin());
 
-          my_data.back() = static_cast<limb_type>(UINT8_C(0));
-        }
+        my_data[static_cast<std::size_t>(copy_limit - static_cast<std::ptrdiff_t>(INT8_C(1)))] = static_cast<limb_type>(UINT8_C(0));
       }
     }
 
@@ -3253,9 +4689,7 @@
 
           if(do_clear_lower_limbs)
           {
-            std::fill(my_data.begin() + static_cast<local_size_type>(least_digit_idx_plus_one),
-                      my_data.end(),
-                      static_cast<local_limb_type>(UINT8_C(0)));
+            eval_clear_elems(least_digit_idx_plus_one, decwide_t_elem_number);
           }
         }
 
@@ -3317,16 +4751,23 @@
               // In rare cases, propagation of the carry reaches the zero'th limb
               // of highest significance, and we must shift the data, create a new limb
               // with the carry value of 1 and adjust the exponent accordingly.
+              // The limbs beyond the used limbs are zero and remain zero.
+              const auto shift_elems = (std::min)(my_used_elem, static_cast<std::int32_t>(decwide_t_elem_number - static_cast<std::int32_t>(INT8_C(1))));
+
               std::copy_backward(my_data.cbegin(),
-                                 my_data.cend() - static_cast<std::ptrdiff_t>(INT8_C(1)),
-                                 my_data.end());
+                                 my_data.cbegin() + static_cast<std::ptrdiff_t>(shift_elems),
+                                 my_data.begin()  + static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(shift_elems) + static_cast<std::ptrdiff_t>(INT8_C(1))));
 
               my_data[static_cast<local_size_type>(UINT8_C(0))] = carry_out;
 
               my_exp = static_cast<exponent_type>(my_exp + static_cast<exponent_type>(decwide_t_elem_digits10));
+
+              my_used_elem = static_cast<std::int32_t>(shift_elems + static_cast<std::int32_t>(INT8_C(1)));
             }
           }
         }
+
+        eval_set_used_elems(my_used_elem);
       }
     }
 
@@ -3656,7 +5097,7 @@
       // input form as described in the comment above.
 
       // Set all the data elements to 0.
-      std::fill(my_data.begin(), my_data.end(), static_cast<limb_type>(UINT8_C(0)));
+      eval_clear_elems(static_cast<std::int32_t>(INT8_C(0)), decwide_t_elem_number);
 
       // Extract the data.
 
@@ -3725,6 +5166,8 @@
           );
       }
 
+      eval_set_used_elems(static_cast<std::int32_t>(i_end + static_cast<std::string::difference_type>(INT8_C(1))));
+
       return true;
     }
     #endif //!(WIDE_DECIMAL_DISABLE_CONSTRUCT_FROM_STRING)
@@ -4355,16 +5798,110 @@
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_radix;          // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_digits10;  // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number;    // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
-  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_mask;      // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
-  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_mask_half; // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
-  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_kara; // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
-  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_fft;  // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::elem_mask_type decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_mask;      // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::elem_mask_type decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_mask_half; // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_kara;  // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_toom3; // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_fft;   // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_ntt;   // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::exponent_type decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_max_exp10; // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::exponent_type decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_min_exp10; // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::exponent_type decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_max_exp;   // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::exponent_type decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_min_exp;   // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
 
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
+  class decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::prepared_multiplier
+  {
+  public:
+    explicit prepared_multiplier(const decwide_t& v)
+      : my_value                  (v),
+        my_prec_elems_for_multiply(v.my_prec_elem)
+    {
+      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+      const auto prec_elems = my_prec_elems_for_multiply;
+
+      // Select the data to cache in the same way as
+      // eval_mul_dispatch_multiplication_method selects
+      // the multiplication method for this precision.
+      const auto prec_elems_is_in_ntt_range =
+        (   (prec_elems >= decwide_t_elems_for_ntt)
+         && (static_cast<std::uint32_t>(static_cast<std::uint32_t>(prec_elems) * detail::decwide_t_helper_base<limb_type>::ntt_points_per_limb) <= static_cast<std::uint32_t>(detail::ntt::ntt_max_length() / 2U)));
+
+      using const_limb_pointer_type = typename std::add_const<limb_type*>::type;
+
+      if((prec_elems >= decwide_t_elems_for_kara) && (prec_elems < decwide_t_elems_for_fft))
+      {
+        // Cache the padded copy of the limbs for Karatsuba
+        // (or Toom-Cook 3-way) multiplication.
+        const auto padded_elems =
+          static_cast<std::size_t>
+          (
+            (prec_elems < decwide_t_elems_for_toom3)
+              ? detail::a029750::a029750_as_runtime_value(static_cast<std::uint32_t>(prec_elems))
+              : detail::toom3_elems_as_runtime_value     (static_cast<std::uint32_t>(prec_elems))
+          );
+
+        my_padded_data = padded_storage_type(static_cast<typename padded_storage_type::size_type>(padded_elems));
+
+        std::copy(my_value.my_data.cbegin(), my_value.my_data.cbegin() + static_cast<std::ptrdiff_t>(prec_elems), my_padded_data.begin());
+        std::fill(my_padded_data.begin() + static_cast<std::ptrdiff_t>(prec_elems), my_padded_data.end(), static_cast<limb_type>(UINT8_C(0)));
+      }
+      else if((prec_elems >= decwide_t_elems_for_fft) && (!prec_elems_is_in_ntt_range))
+      {
+        // Cache the forward FFT of the limbs. The FFT size
+        // is determined in the same way as in eval_mul_fft.
+        const auto n_fft =
+          static_cast<std::uint32_t>
+          (
+              detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(prec_elems))
+            * static_cast<std::uint32_t>(static_cast<std::uint32_t>(UINT8_C(2)) * detail::decwide_t_helper_base<limb_type>::fft_points_per_limb)
+          );
+
+        my_fft_data = fft_storage_type(static_cast<typename fft_storage_type::size_type>(n_fft));
+
+        const auto& my_fft_plan = detail::fft::fft_plan_cache<fft_float_type>(n_fft);
+
+        detail::mul_loop_fft_transform(my_fft_data.data(),
+                                       const_cast<const_limb_pointer_type>(my_value.my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                                       my_fft_plan.twiddles(),
+                                       prec_elems,
+                                       n_fft);
+
+        if(n_fft > detail::mul_transform_cache_max_points())
+        {
+          detail::fft::fft_plan_cache_release<fft_float_type>();
+        }
+      }
+      #endif
+    }
+
+    prepared_multiplier(const prepared_multiplier&) = default;
+    prepared_multiplier(prepared_multiplier&&) noexcept = default;
+
+    ~prepared_multiplier() = default;
+
+    auto operator=(const prepared_multiplier&) -> prepared_multiplier& = delete;
+    auto operator=(prepared_multiplier&&) noexcept -> prepared_multiplier& = delete;
+
+    auto value() const noexcept -> const decwide_t& { return my_value; }
+
+  private:
+    #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+    using padded_storage_type = util::dynamic_array<limb_type>;
+    using fft_storage_type    = util::dynamic_array<fft_float_type>;
+    #endif
+
+    decwide_t           my_value;
+    std::int32_t        my_prec_elems_for_multiply;
+    #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+    padded_storage_type my_padded_data { };
+    fft_storage_type    my_fft_data    { };
+    #endif
+
+    friend class decwide_t;
+  };
+
   #if !defined(WIDE_DECIMAL_DISABLE_CACHED_CONSTANTS)
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
   const typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::initializer decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_initializer; // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
@@ -4372,11 +5909,17 @@
 
   #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
   #else
-  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::limb_type, static_cast<std::size_t>((decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_kara - 1) * 2)>                                                                                                    decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_school_mul_pool; // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables)
-  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::limb_type, static_cast<std::size_t>(detail::a029750::a029750_as_constexpr     (static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_fft - 1)) * 8UL))> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_kara_mul_pool;   // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::fft_float_type, static_cast<std::size_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number)) * 4UL))>       decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_af_fft_mul_pool; // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
-  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::fft_float_type, static_cast<std::size_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number)) * 4UL))>       decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_bf_fft_mul_pool; // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
-  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::representation_type decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_n_data_for_add_sub;                                                                                                                                                                                                                                                                        // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> WIDE_DECIMAL_STATIC_POOL_STORAGE std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::limb_type, static_cast<std::size_t>((decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_kara - 1) * 2)>                                                                                                    decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_school_mul_pool; // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> WIDE_DECIMAL_STATIC_POOL_STORAGE std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::limb_type, static_cast<std::size_t>(detail::a029750::a029750_as_constexpr     (static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_fft - 1)) * 8UL))> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_kara_mul_pool;   // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> WIDE_DECIMAL_STATIC_POOL_STORAGE std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::limb_type, static_cast<std::size_t>(detail::a029750::a029750_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_fft + 1) / 3U)) * 3UL * 14UL)> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_toom3_mul_pool;  // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> WIDE_DECIMAL_STATIC_POOL_STORAGE std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::fft_float_type, static_cast<std::size_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number)) * 2UL * detail::decwide_t_helper_base<LimbType>::fft_points_per_limb))>       decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_af_fft_mul_pool; // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> WIDE_DECIMAL_STATIC_POOL_STORAGE std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::fft_float_type, static_cast<std::size_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number)) * 2UL * detail::decwide_t_helper_base<LimbType>::fft_points_per_limb))>       decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_bf_fft_mul_pool; // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> WIDE_DECIMAL_STATIC_POOL_STORAGE std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::fft_float_type, static_cast<std::size_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number)) * 4UL * detail::decwide_t_helper_base<LimbType>::fft_points_per_limb))>       decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_fft_twiddle_pool; // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> WIDE_DECIMAL_STATIC_POOL_STORAGE std::uint32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_fft_twiddle_size; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> WIDE_DECIMAL_STATIC_POOL_STORAGE std::array<std::uint32_t, static_cast<std::size_t>(detail::ntt::ntt_length_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number) * detail::decwide_t_helper_base<LimbType>::ntt_points_per_limb)) * 4UL)> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_ntt_mul_pool; // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> WIDE_DECIMAL_STATIC_POOL_STORAGE std::array<std::uint32_t, static_cast<std::size_t>(detail::ntt::ntt_length_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number) * detail::decwide_t_helper_base<LimbType>::ntt_points_per_limb)) * 3UL)> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_ntt_twiddle_pool; // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> WIDE_DECIMAL_STATIC_POOL_STORAGE std::uint32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_ntt_twiddle_size; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> WIDE_DECIMAL_STATIC_POOL_STORAGE std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::limb_type, static_cast<std::size_t>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number + 2)> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_fused_acc_pool; // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables)
   #endif
 
   #if !defined(WIDE_DECIMAL_DISABLE_IOSTREAM)
@@ -4650,7 +6193,7 @@
       a      += sqrt(bB);
       a      /= static_cast<unsigned>(UINT8_C(2));
       val_pi  = a;
-      val_pi *= a;
+      val_pi *= val_pi;
       bB      = val_pi;
       bB     -= t;
       bB     *= static_cast<unsigned>(UINT8_C(2));
@@ -4822,6 +6365,41 @@
       );
   }
 
+  template<const ::std::int32_t ParamDigitsBaseTen,
+           typename LimbType,
+           typename AllocatorType,
+           typename InternalFloatType,
+           typename ExponentType,
+           typename FftFloatType>
+  #if !defined(WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION)
+  auto calc_pi(const std::function<void(const std::uint32_t)>& pfn_callback_to_report_digits10) -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint64_t>::value), decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  #else
+  auto calc_pi(void(*pfn_callback_to_report_digits10)(const std::uint32_t)) -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint64_t>::value), decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  #endif
+  {
+    // N[Pi, 121]
+    // 3.141592653589793238462643383279502884197169399375105820974944592307816406286208998628034825342117067982148086513282306647
+
+    static_cast<void>(pfn_callback_to_report_digits10);
+
+    using local_wide_decimal_type =
+      decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+    using local_limb_type = typename local_wide_decimal_type::limb_type;
+
+    return
+      local_wide_decimal_type::from_lst
+      (
+        {
+          static_cast<local_limb_type>(UINT64_C(               3)),
+          static_cast<local_limb_type>(UINT64_C(1415926535897932)), static_cast<local_limb_type>(UINT64_C(3846264338327950)),
+          static_cast<local_limb_type>(UINT64_C(2884197169399375)), static_cast<local_limb_type>(UINT64_C(1058209749445923)),
+          static_cast<local_limb_type>(UINT64_C( 781640628620899)), static_cast<local_limb_type>(UINT64_C(8628034825342117)),
+          static_cast<local_limb_type>(UINT64_C( 679821480865132))
+        }
+      );
+  }
+
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
   auto calc_ln_two() -> typename std::enable_if<(ParamDigitsBaseTen > static_cast<std::int32_t>(INT8_C(51))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
   {
@@ -5009,6 +6587,30 @@
       );
   }
 
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
+  auto calc_ln_two() -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint64_t>::value), decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  {
+    // N[Log[2], 121]
+    // 0.6931471805599453094172321214581765680755001343602552541206800094933936219696947156058633269964186875420014810205706857337
+
+    using local_wide_decimal_type =
+      decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+    using local_limb_type = typename local_wide_decimal_type::limb_type;
+
+    return
+      local_wide_decimal_type::from_lst
+      (
+        {
+          static_cast<local_limb_type>(UINT64_C(6931471805599453)), static_cast<local_limb_type>(UINT64_C( 941723212145817)),
+          static_cast<local_limb_type>(UINT64_C(6568075500134360)), static_cast<local_limb_type>(UINT64_C(2552541206800094)),
+          static_cast<local_limb_type>(UINT64_C(9339362196969471)), static_cast<local_limb_type>(UINT64_C(5605863326996418)),
+          static_cast<local_limb_type>(UINT64_C(6875420014810205)),
+        },
+        static_cast<typename local_wide_decimal_type::exponent_type>(INT8_C(-16))
+      );
+  }
+
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
   auto calc_ln_ten_low_precision() -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint8_t>::value), decwide_t<ParamDigitsBaseTen, std::uint8_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
   {
@@ -5087,6 +6689,30 @@
       );
   }
 
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
+  auto calc_ln_ten_low_precision() -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint64_t>::value), decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  {
+    // N[Log[10], 121]
+    // 2.302585092994045684017991454684364207601101488628772976033327900967572609677352480235997205089598298341967784042286248633
+
+    using local_wide_decimal_type =
+      decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+    using local_limb_type = typename local_wide_decimal_type::limb_type;
+
+    return
+      local_wide_decimal_type::from_lst
+      (
+        {
+          static_cast<local_limb_type>(UINT64_C(               2)),
+          static_cast<local_limb_type>(UINT64_C(3025850929940456)), static_cast<local_limb_type>(UINT64_C(8401799145468436)),
+          static_cast<local_limb_type>(UINT64_C(4207601101488628)), static_cast<local_limb_type>(UINT64_C(7729760333279009)),
+          static_cast<local_limb_type>(UINT64_C(6757260967735248)), static_cast<local_limb_type>(UINT64_C( 235997205089598)),
+          static_cast<local_limb_type>(UINT64_C(2983419677840422))
+        }
+      );
+  }
+
   #if !defined(WIDE_DECIMAL_DISABLE_CACHED_CONSTANTS)
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
   #if !defined(WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION)
@@ -5134,7 +6760,7 @@
   // Global add/sub/mul/div of const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& with const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&.
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>auto operator+(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType> { using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>; return local_wide_decimal_type(u) += v; }
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>auto operator-(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType> { using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>; return local_wide_decimal_type(u) -= v; }
-  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>auto operator*(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType> { using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>; return local_wide_decimal_type(u) *= v; }
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>auto operator*(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType> { using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>; local_wide_decimal_type result(u); return ((&u == &v) ? (result *= result) : (result *= v)); }
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>auto operator/(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType> { using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>; return local_wide_decimal_type(u) /= v; }
 
   // Global add/sub/mul/div of const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& with all built-in types.
@@ -5671,6 +7297,29 @@
     return v1 - (nv * v2);
   }
 
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
+  auto fma(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& a,
+           const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& b,
+           const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& c) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>
+  {
+    // Calculate a * b + c with one normalization of the result
+    // (see decwide_t::calculate_dot).
+    using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+    return local_wide_decimal_type::calculate_dot(&a, &a + 1U, &b, c);
+  }
+
+  template<typename ForwardIteratorA, typename ForwardIteratorB>
+  auto dot(ForwardIteratorA a_first, ForwardIteratorA a_last, ForwardIteratorB b_first) -> typename std::iterator_traits<ForwardIteratorA>::value_type
+  {
+    // Calculate the sum of the products a[i] * b[i] for the range
+    // [a_first, a_last) with one normalization of the result
+    // (see decwide_t::calculate_dot).
+    using local_wide_decimal_type = typename std::iterator_traits<ForwardIteratorA>::value_type;
+
+    return local_wide_decimal_type::calculate_dot(a_first, a_last, b_first, local_wide_decimal_type());
+  }
+
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
   auto sqrt(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& x) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>
   {
@@ -5679,6 +7328,14 @@
     return local_wide_decimal_type(x).calculate_sqrt();
   }
 
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
+  auto rsqrt(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& x) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>
+  {
+    using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+    return local_wide_decimal_type(x).calculate_rsqrt();
+  }
+
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
   auto cbrt(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& x) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>
   {
@@ -6263,9 +7920,9 @@
     if     (p <  static_cast<std::int64_t>(INT8_C(0))) { result = pow(b, -p).calculate_inv(); }
     else if(p == static_cast<std::int64_t>(INT8_C(0))) { result = local_wide_decimal_type(static_cast<unsigned>(UINT8_C(1))); }
     else if(p == static_cast<std::int64_t>(INT8_C(1))) { result = b; }
-    else if(p == static_cast<std::int64_t>(INT8_C(2))) { result = b; result *= b; }
-    else if(p == static_cast<std::int64_t>(INT8_C(3))) { result = b; result *= b; result *= b; }
-    else if(p == static_cast<std::int64_t>(INT8_C(4))) { result = b; result *= b; result *= result; }
+    else if(p == static_cast<std::int64_t>(INT8_C(2))) { result = b; result *= result; }
+    else if(p == static_cast<std::int64_t>(INT8_C(3))) { result = b; result *= result; result *= b; }
+    else if(p == static_cast<std::int64_t>(INT8_C(4))) { result = b; result *= result; result *= result; }
     else
     {
       result = local_wide_decimal_type(static_cast<unsigned>(UINT8_C(1)));
@@ -16,6 +16,7 @@
 
   #include <math/wide_decimal/decwide_t_detail_namespace.h>
 
+  #include <util/memory/util_small_buffer_allocator.h>
   #include <util/utility/util_dynamic_array.h>
 
   #include <algorithm>
@@ -23,8 +24,10 @@
   #include <cmath>
   #include <cstdint>
   #include <initializer_list>
+  #include <iterator>
   #include <limits>
   #include <memory>
+  #include <type_traits>
 
   #if defined(_MSC_VER)
     #if (_MSC_VER >= 1900) && defined(_HAS_CXX20) && (_HAS_CXX20 != 0)
@@ -60,6 +63,10 @@
     #endif
   #endif
 
+  #if defined(__SIZEOF_INT128__) && !defined(WIDE_DECIMAL_DISABLE_INT128)
+    #define WIDE_DECIMAL_HAS_INT128 // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
   WIDE_DECIMAL_NAMESPACE_BEGIN
 
   #if(__cplusplus >= 201703L)
@@ -260,6 +267,143 @@
   template<const std::size_t BitCount> struct uint_type_helper<BitCount, typename std::enable_if<(BitCount >= static_cast<std::size_t>(UINT8_C(17))) && (BitCount <= static_cast<std::size_t>(UINT8_C( 32)))>::type> { using exact_unsigned_type = std::uint32_t; using exact_signed_type = std::int32_t; using fast_unsigned_type = std::uint_fast32_t; using fast_signed_type = std::int_fast32_t; };
   template<const std::size_t BitCount> struct uint_type_helper<BitCount, typename std::enable_if<(BitCount >= static_cast<std::size_t>(UINT8_C(33))) && (BitCount <= static_cast<std::size_t>(UINT8_C( 64)))>::type> { using exact_unsigned_type = std::uint64_t; using exact_signed_type = std::int64_t; using fast_unsigned_type = std::uint_fast64_t; using fast_signed_type = std::int_fast64_t; };
 
+  #if defined(WIDE_DECIMAL_HAS_INT128)
+  __extension__ typedef unsigned __int128 uint128_type; // NOLINT(modernize-use-using)
+  #else
+  class uint128_type final
+  {
+  public:
+    // This is a minimal portable unsigned 128-bit integer. It serves
+    // as double limb for 64-bit limbs if the compiler does not provide
+    // unsigned __int128. Only the operations used by the multiplication
+    // and division kernels are provided. Division and modulus are
+    // restricted to divisors that fit in 64 bits.
+
+    constexpr uint128_type() noexcept = default;
+
+    constexpr uint128_type(std::uint64_t u) noexcept : my_lo(u) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    template<typename UnsignedIntegralType,
+             typename std::enable_if<(   std::is_integral<UnsignedIntegralType>::value
+                                      && std::is_unsigned<UnsignedIntegralType>::value)>::type const* = nullptr>
+    explicit constexpr operator UnsignedIntegralType() const noexcept { return static_cast<UnsignedIntegralType>(my_lo); }
+
+    auto operator+=(const uint128_type& other) noexcept -> uint128_type&
+    {
+      const auto lo = static_cast<std::uint64_t>(my_lo + other.my_lo);
+
+      my_hi = static_cast<std::uint64_t>(static_cast<std::uint64_t>(my_hi + other.my_hi) + ((lo < my_lo) ? 1U : 0U));
+      my_lo = lo;
+
+      return *this;
+    }
+
+    friend auto operator+(const uint128_type& a, const uint128_type& b) noexcept -> uint128_type
+    {
+      uint128_type result(a);
+
+      result += b;
+
+      return result;
+    }
+
+    friend auto operator*(const uint128_type& a, const uint128_type& b) noexcept -> uint128_type
+    {
+      // The lower 128 bits of the product are computed
+      // from the 32-bit parts of the lower 64-bit halves.
+      constexpr auto mask32 = static_cast<std::uint64_t>(UINT32_C(0xFFFFFFFF));
+
+      const auto a0 = static_cast<std::uint64_t>(a.my_lo & mask32);
+      const auto a1 = static_cast<std::uint64_t>(a.my_lo >> 32U);
+      const auto b0 = static_cast<std::uint64_t>(b.my_lo & mask32);
+      const auto b1 = static_cast<std::uint64_t>(b.my_lo >> 32U);
+
+      const auto p00 = static_cast<std::uint64_t>(a0 * b0);
+      const auto p01 = static_cast<std::uint64_t>(a0 * b1);
+      const auto p10 = static_cast<std::uint64_t>(a1 * b0);
+      const auto p11 = static_cast<std::uint64_t>(a1 * b1);
+
+      const auto mid = static_cast<std::uint64_t>(static_cast<std::uint64_t>(p00 >> 32U) + static_cast<std::uint64_t>(p01 & mask32) + static_cast<std::uint64_t>(p10 & mask32));
+
+      uint128_type result;
+
+      result.my_lo = static_cast<std::uint64_t>(static_cast<std::uint64_t>(p00 & mask32) | static_cast<std::uint64_t>(mid << 32U));
+      result.my_hi = static_cast<std::uint64_t>(  p11
+                                                + static_cast<std::uint64_t>(p01 >> 32U)
+                                                + static_cast<std::uint64_t>(p10 >> 32U)
+                                                + static_cast<std::uint64_t>(mid >> 32U)
+                                                + static_cast<std::uint64_t>(a.my_hi * b.my_lo)
+                                                + static_cast<std::uint64_t>(a.my_lo * b.my_hi));
+
+      return result;
+    }
+
+    friend auto operator/(const uint128_type& a, const std::uint64_t d) noexcept -> uint128_type
+    {
+      uint128_type q;
+
+      static_cast<void>(a.divide(d, q));
+
+      return q;
+    }
+
+    friend auto operator%(const uint128_type& a, const std::uint64_t d) noexcept -> uint128_type
+    {
+      uint128_type q;
+
+      return uint128_type(a.divide(d, q));
+    }
+
+  private:
+    std::uint64_t my_lo { }; // NOLINT(readability-identifier-naming)
+    std::uint64_t my_hi { }; // NOLINT(readability-identifier-naming)
+
+    auto divide(const std::uint64_t d, uint128_type& q) const noexcept -> std::uint64_t
+    {
+      // Divide by d and return the remainder.
+      q.my_hi = static_cast<std::uint64_t>(my_hi / d);
+
+      auto rem = static_cast<std::uint64_t>(my_hi % d);
+
+      if(d <= static_cast<std::uint64_t>(UINT32_C(0xFFFFFFFF)))
+      {
+        // Short division of the lower half in two 32-bit digits.
+        const auto t1 = static_cast<std::uint64_t>(static_cast<std::uint64_t>(rem << 32U) | static_cast<std::uint64_t>(my_lo >> 32U));
+        const auto q1 = static_cast<std::uint64_t>(t1 / d);
+
+        const auto t0 = static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(t1 % d) << 32U) | static_cast<std::uint64_t>(my_lo & static_cast<std::uint64_t>(UINT32_C(0xFFFFFFFF))));
+
+        q.my_lo = static_cast<std::uint64_t>(static_cast<std::uint64_t>(q1 << 32U) | static_cast<std::uint64_t>(t0 / d));
+        rem     = static_cast<std::uint64_t>(t0 % d);
+      }
+      else
+      {
+        // Bitwise long division of the lower half.
+        q.my_lo = static_cast<std::uint64_t>(UINT8_C(0));
+
+        for(auto i = static_cast<unsigned>(UINT8_C(64)); i > static_cast<unsigned>(UINT8_C(0)); --i)
+        {
+          const auto rem_top = ((rem >> 63U) != static_cast<std::uint64_t>(UINT8_C(0)));
+
+          rem = static_cast<std::uint64_t>(static_cast<std::uint64_t>(rem << 1U) | static_cast<std::uint64_t>(static_cast<std::uint64_t>(my_lo >> static_cast<unsigned>(i - 1U)) & 1U));
+
+          q.my_lo = static_cast<std::uint64_t>(q.my_lo << 1U);
+
+          if(rem_top || (rem >= d))
+          {
+            rem     = static_cast<std::uint64_t>(rem - d);
+            q.my_lo = static_cast<std::uint64_t>(q.my_lo | 1U);
+          }
+        }
+      }
+
+      return rem;
+    }
+  };
+  #endif
+
+  template<const std::size_t BitCount> struct uint_type_helper<BitCount, typename std::enable_if<(BitCount >= static_cast<std::size_t>(UINT8_C(65))) && (BitCount <= static_cast<std::size_t>(UINT8_C(128)))>::type> { using exact_unsigned_type = uint128_type; using fast_unsigned_type = uint128_type; };
+
   template<typename UnsignedIntegralType>
   constexpr auto negate(UnsignedIntegralType u) -> typename std::enable_if<(   std::is_integral<UnsignedIntegralType>::value
                                                                             && std::is_unsigned<UnsignedIntegralType>::value), UnsignedIntegralType>::type
@@ -348,6 +492,30 @@
     }
   };
 
+  inline auto toom3_elems_as_runtime_value(std::uint32_t value) noexcept -> std::uint32_t
+  {
+    // Obtain the padded operand size for Toom-Cook 3-way multiplication.
+    // This is the smallest number at least as large as value that has
+    // either the form 3 * A029750(m) or the form 9 * A029750(m).
+    // The latter form allows for a second level of Toom-Cook 3-way
+    // recursion and generally leads to less padding.
+    const auto elems_one_level =
+      static_cast<std::uint32_t>
+      (
+          a029750::a029750_as_runtime_value(static_cast<std::uint32_t>(static_cast<std::uint32_t>(value + static_cast<std::uint32_t>(UINT8_C(2))) / static_cast<std::uint32_t>(UINT8_C(3))))
+        * static_cast<std::uint32_t>(UINT8_C(3))
+      );
+
+    const auto elems_two_levels =
+      static_cast<std::uint32_t>
+      (
+          a029750::a029750_as_runtime_value(static_cast<std::uint32_t>(static_cast<std::uint32_t>(value + static_cast<std::uint32_t>(UINT8_C(8))) / static_cast<std::uint32_t>(UINT8_C(9))))
+        * static_cast<std::uint32_t>(UINT8_C(9))
+      );
+
+    return (std::min)(elems_one_level, elems_two_levels);
+  }
+
   struct a000079
   {
     static constexpr auto a000079_as_constexpr(const std::uint32_t value) noexcept -> std::uint32_t // NOLINT(readability-function-cognitive-complexity)
@@ -367,39 +535,49 @@
   };
 
   // LCOV_EXCL_START
-  constexpr auto pow10_maker(std::uint32_t n) noexcept -> std::uint32_t // NOLINT(misc-no-recursion)
+  constexpr auto pow10_maker(std::uint32_t n) noexcept -> std::uint64_t // NOLINT(misc-no-recursion)
   {
     // Make the constant power of 10^n.
     return
-      static_cast<std::uint32_t>
+      static_cast<std::uint64_t>
       (
         (n == static_cast<std::uint32_t>(UINT8_C(0)))
-          ? static_cast<std::uint32_t>(UINT8_C(1))
-          : static_cast<std::uint32_t>
+          ? static_cast<std::uint64_t>(UINT8_C(1))
+          : static_cast<std::uint64_t>
             (
                 pow10_maker(static_cast<std::uint32_t>(n - static_cast<std::uint32_t>(UINT8_C(1))))
-              * static_cast<std::uint32_t>(UINT8_C(10))
+              * static_cast<std::uint64_t>(UINT8_C(10))
             )
       );
   }
   // LCOV_EXCL_STOP
 
-  inline auto pow10_maker_as_runtime_value(std::uint32_t n) noexcept -> std::uint32_t
+  inline auto pow10_maker_as_runtime_value(std::uint32_t n) noexcept -> std::uint64_t
   {
-    using local_array_type = std::array<std::uint32_t, static_cast<std::size_t>(UINT8_C(10))>; // NOLINT(,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    using local_array_type = std::array<std::uint64_t, static_cast<std::size_t>(UINT8_C(20))>; // NOLINT(,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
 
     constexpr local_array_type local_p10_table =
     {{
-      static_cast<std::uint32_t>(UINT32_C(1)),
-      static_cast<std::uint32_t>(UINT32_C(10)),
-      static_cast<std::uint32_t>(UINT32_C(100)),
-      static_cast<std::uint32_t>(UINT32_C(1000)),
-      static_cast<std::uint32_t>(UINT32_C(10000)),
-      static_cast<std::uint32_t>(UINT32_C(100000)),
-      static_cast<std::uint32_t>(UINT32_C(1000000)),
-      static_cast<std::uint32_t>(UINT32_C(10000000)),
-      static_cast<std::uint32_t>(UINT32_C(100000000)),
-      static_cast<std::uint32_t>(UINT32_C(1000000000))
+      static_cast<std::uint64_t>(UINT64_C(1)),
+      static_cast<std::uint64_t>(UINT64_C(10)),
+      static_cast<std::uint64_t>(UINT64_C(100)),
+      static_cast<std::uint64_t>(UINT64_C(1000)),
+      static_cast<std::uint64_t>(UINT64_C(10000)),
+      static_cast<std::uint64_t>(UINT64_C(100000)),
+      static_cast<std::uint64_t>(UINT64_C(1000000)),
+      static_cast<std::uint64_t>(UINT64_C(10000000)),
+      static_cast<std::uint64_t>(UINT64_C(100000000)),
+      static_cast<std::uint64_t>(UINT64_C(1000000000)),
+      static_cast<std::uint64_t>(UINT64_C(10000000000)),
+      static_cast<std::uint64_t>(UINT64_C(100000000000)),
+      static_cast<std::uint64_t>(UINT64_C(1000000000000)),
+      static_cast<std::uint64_t>(UINT64_C(10000000000000)),
+      static_cast<std::uint64_t>(UINT64_C(100000000000000)),
+      static_cast<std::uint64_t>(UINT64_C(1000000000000000)),
+      static_cast<std::uint64_t>(UINT64_C(10000000000000000)),
+      static_cast<std::uint64_t>(UINT64_C(100000000000000000)),
+      static_cast<std::uint64_t>(UINT64_C(1000000000000000000)),
+      static_cast<std::uint64_t>(UINT64_C(10000000000000000000))
     }};
 
     {
@@ -461,14 +639,33 @@
     using local_limb_type = LimbType;
 
   public:
-    static constexpr std::int32_t elem_digits10 =
-      (std::is_same<local_limb_type, std::uint32_t>::value
-        ? static_cast<std::int32_t>(INT8_C(8))
-        : (std::is_same<local_limb_type, std::uint16_t>::value ? static_cast<std::int32_t>(INT8_C(4))
-                                                               : static_cast<std::int32_t>(INT8_C(2))));
+    // The limb masks of 64-bit limbs (10^16) exceed the range
+    // of std::int32_t, so these are held in a signed type that
+    // is at least as wide as the limb.
+    using elem_mask_type =
+      typename std::conditional<std::is_same<local_limb_type, std::uint64_t>::value, std::int64_t, std::int32_t>::type;
 
-    static constexpr std::int32_t elem_mask      = static_cast<std::int32_t>(pow10_maker(static_cast<std::uint32_t>(elem_digits10)));
-    static constexpr std::int32_t elem_mask_half = static_cast<std::int32_t>(pow10_maker(static_cast<std::uint32_t>(elem_digits10 / 2)));
+    static constexpr std::int32_t elem_digits10 =
+      (std::is_same<local_limb_type, std::uint64_t>::value
+        ? static_cast<std::int32_t>(INT8_C(16))
+        : (std::is_same<local_limb_type, std::uint32_t>::value
+            ? static_cast<std::int32_t>(INT8_C(8))
+            : (std::is_same<local_limb_type, std::uint16_t>::value ? static_cast<std::int32_t>(INT8_C(4))
+                                                                   : static_cast<std::int32_t>(INT8_C(2)))));
+
+    static constexpr elem_mask_type elem_mask      = static_cast<elem_mask_type>(pow10_maker(static_cast<std::uint32_t>(elem_digits10)));
+    static constexpr elem_mask_type elem_mask_half = static_cast<elem_mask_type>(pow10_maker(static_cast<std::uint32_t>(elem_digits10 / 2)));
+
+    // The FFT multiplication splits each limb into points of fft_point_mask,
+    // which are half-limbs for limbs up to 32 bits and quarter-limbs for
+    // 64-bit limbs. The NTT multiplication uses full limbs for limbs up to
+    // 32 bits and half-limbs for 64-bit limbs. This keeps the convolution
+    // terms of 64-bit limbs in the same range as those of 32-bit limbs.
+    static constexpr std::uint32_t fft_points_per_limb = (std::is_same<local_limb_type, std::uint64_t>::value ? static_cast<std::uint32_t>(UINT8_C(4)) : static_cast<std::uint32_t>(UINT8_C(2)));
+    static constexpr std::uint32_t ntt_points_per_limb = (std::is_same<local_limb_type, std::uint64_t>::value ? static_cast<std::uint32_t>(UINT8_C(2)) : static_cast<std::uint32_t>(UINT8_C(1)));
+
+    static constexpr elem_mask_type fft_point_mask = static_cast<elem_mask_type>(pow10_maker(static_cast<std::uint32_t>(static_cast<std::uint32_t>(elem_digits10) / fft_points_per_limb)));
+    static constexpr elem_mask_type ntt_point_mask = static_cast<elem_mask_type>(pow10_maker(static_cast<std::uint32_t>(static_cast<std::uint32_t>(elem_digits10) / ntt_points_per_limb)));
 
     static constexpr auto digit_at_pos_in_limb(local_limb_type u, unsigned pos) noexcept -> std::uint8_t
     {
@@ -485,8 +682,12 @@
   };
 
   template<typename LimbType> constexpr std::int32_t decwide_t_helper_base<LimbType>::elem_digits10;  // NOLINT(readability-redundant-declaration)
-  template<typename LimbType> constexpr std::int32_t decwide_t_helper_base<LimbType>::elem_mask;      // NOLINT(readability-redundant-declaration)
-  template<typename LimbType> constexpr std::int32_t decwide_t_helper_base<LimbType>::elem_mask_half; // NOLINT(readability-redundant-declaration)
+  template<typename LimbType> constexpr typename decwide_t_helper_base<LimbType>::elem_mask_type decwide_t_helper_base<LimbType>::elem_mask;      // NOLINT(readability-redundant-declaration)
+  template<typename LimbType> constexpr typename decwide_t_helper_base<LimbType>::elem_mask_type decwide_t_helper_base<LimbType>::elem_mask_half; // NOLINT(readability-redundant-declaration)
+  template<typename LimbType> constexpr std::uint32_t decwide_t_helper_base<LimbType>::fft_points_per_limb;                                 // NOLINT(readability-redundant-declaration)
+  template<typename LimbType> constexpr std::uint32_t decwide_t_helper_base<LimbType>::ntt_points_per_limb;                                 // NOLINT(readability-redundant-declaration)
+  template<typename LimbType> constexpr typename decwide_t_helper_base<LimbType>::elem_mask_type decwide_t_helper_base<LimbType>::fft_point_mask; // NOLINT(readability-redundant-declaration)
+  template<typename LimbType> constexpr typename decwide_t_helper_base<LimbType>::elem_mask_type decwide_t_helper_base<LimbType>::ntt_point_mask; // NOLINT(readability-redundant-declaration)
 
   template<const std::int32_t ParamDigitsBaseTen,
            typename LimbType>
@@ -512,6 +713,292 @@
   template<const std::int32_t ParamDigitsBaseTen, typename LimbType> constexpr std::int32_t decwide_t_helper<ParamDigitsBaseTen, LimbType>::elem_number_extra; // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
   template<const std::int32_t ParamDigitsBaseTen, typename LimbType> constexpr std::int32_t decwide_t_helper<ParamDigitsBaseTen, LimbType>::elem_number;       // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
 
+  template<typename LimbType,
+           typename FftFloatType>
+  constexpr auto fft_is_safe_as_constexpr(const std::uint32_t n_fft, const std::uint32_t log2_n_fft) -> bool
+  {
+    // Use an a-priori estimate of the form 2 * N^(3/2) * M^2 * u for the
+    // rounding error of the FFT convolution, where N is the FFT size,
+    // M is the largest FFT point and u is the unit roundoff of the
+    // FFT float type. This is a heuristic estimate, not a rigorous bound.
+    // The twiddle factors are taken from a table computed with long double
+    // trigonometric functions (see fft_make_twiddles), and the measured
+    // errors grow roughly linearly with N. The power 3/2 (instead of
+    // N * log2(N)) is kept as a conservative margin. For worst-case operands
+    // (all nines) with 32-bit limbs and double, the estimate lies a factor
+    // of about 50 (N = 2^10) up to 3500 (N = 2^24) above the measured errors.
+    // The FFT is considered to be safe if the estimate does not exceed 1/2.
+    return
+      (
+           static_cast<long double>(  static_cast<long double>(2.0L)
+                                    * static_cast<long double>(n_fft)
+                                    * static_cast<long double>(static_cast<long double>(UINT32_C(1) << static_cast<unsigned>(log2_n_fft / 2U)) * (((log2_n_fft % 2U) != 0U) ? static_cast<long double>(1.4142135623730950488016887242096980785697L) : static_cast<long double>(1.0L)))
+                                    * static_cast<long double>(decwide_t_helper_base<LimbType>::fft_point_mask - 1)
+                                    * static_cast<long double>(decwide_t_helper_base<LimbType>::fft_point_mask - 1)
+                                    * static_cast<long double>(static_cast<long double>(std::numeric_limits<FftFloatType>::epsilon()) / 2))
+        <= static_cast<long double>(0.5L)
+      );
+  }
+
+  template<typename LimbType,
+           typename FftFloatType>
+  constexpr auto fft_safe_elems_as_constexpr(const std::uint32_t n_fft      = static_cast<std::uint32_t>(UINT8_C(32)),
+                                             const std::uint32_t log2_n_fft = static_cast<std::uint32_t>(UINT8_C(5))) -> std::int32_t // NOLINT(misc-no-recursion)
+  {
+    // Obtain the largest limb count for which FFT multiplication
+    // (with n_fft = 2 * fft_points_per_limb * A000079(count)) is safe
+    // with respect to rounding. Zero is returned if the FFT is not
+    // even safe for the smallest size.
+    return
+      (!fft_is_safe_as_constexpr<LimbType, FftFloatType>(n_fft, log2_n_fft))
+        ? static_cast<std::int32_t>(INT8_C(0))
+        : (((n_fft < static_cast<std::uint32_t>(UINT32_C(0x40000000))) && fft_is_safe_as_constexpr<LimbType, FftFloatType>(static_cast<std::uint32_t>(n_fft * 2U), static_cast<std::uint32_t>(log2_n_fft + 1U)))
+            ? fft_safe_elems_as_constexpr<LimbType, FftFloatType>(static_cast<std::uint32_t>(n_fft * 2U), static_cast<std::uint32_t>(log2_n_fft + 1U))
+            : static_cast<std::int32_t>(n_fft / static_cast<std::uint32_t>(2U * decwide_t_helper_base<LimbType>::fft_points_per_limb)));
+  }
+
+  constexpr auto mul_transform_cache_max_points() noexcept -> std::uint32_t
+  {
+    // Get the largest transform length whose FFT plan (or NTT twiddle
+    // tables) remains cached per thread after a multiplication. Larger
+    // plans are released after each multiplication, so that a single
+    // huge multiplication does not hold its tables for the lifetime of
+    // the thread. The default of 2^20 points covers all FFT sizes below
+    // elems_for_ntt for 32 and 64-bit limbs with double as FFT float type.
+    // It can be set with the macro WIDE_DECIMAL_MUL_CACHE_MAX_POINTS.
+    #if defined(WIDE_DECIMAL_MUL_CACHE_MAX_POINTS)
+    return static_cast<std::uint32_t>(WIDE_DECIMAL_MUL_CACHE_MAX_POINTS);
+    #else
+    return static_cast<std::uint32_t>(UINT32_C(1) << 20U);
+    #endif
+  }
+
+  #if defined(WIDE_DECIMAL_DIV_RECIPROCAL_CACHE_SIZE)
+  template<typename DecwideType>
+  struct div_reciprocal_cache
+  {
+    // This holds the recently used divisors and their reciprocals
+    // for the (optional) reciprocal cache of decwide_t division.
+    // The entries are replaced in round-robin order. The counters
+    // of hits and misses can be used to size the cache, which is set
+    // with the macro WIDE_DECIMAL_DIV_RECIPROCAL_CACHE_SIZE.
+    static constexpr std::size_t cache_size = static_cast<std::size_t>(WIDE_DECIMAL_DIV_RECIPROCAL_CACHE_SIZE);
+
+    static_assert(cache_size > static_cast<std::size_t>(UINT8_C(0)),
+                  "Error: The size of the reciprocal cache must be at least one");
+
+    std::array<DecwideType,   cache_size> values   { }; // NOLINT(readability-identifier-naming)
+    std::array<DecwideType,   cache_size> inverses { }; // NOLINT(readability-identifier-naming)
+    std::array<std::uint64_t, cache_size> hashes   { }; // NOLINT(readability-identifier-naming)
+
+    std::size_t   used   { }; // NOLINT(readability-identifier-naming)
+    std::size_t   next   { }; // NOLINT(readability-identifier-naming)
+    std::uint64_t hits   { }; // NOLINT(readability-identifier-naming)
+    std::uint64_t misses { }; // NOLINT(readability-identifier-naming)
+
+    auto clear() -> void
+    {
+      std::fill(values.begin(),   values.end(),   DecwideType());
+      std::fill(inverses.begin(), inverses.end(), DecwideType());
+
+      used   = static_cast<std::size_t>(UINT8_C(0));
+      next   = static_cast<std::size_t>(UINT8_C(0));
+      hits   = static_cast<std::uint64_t>(UINT8_C(0));
+      misses = static_cast<std::uint64_t>(UINT8_C(0));
+    }
+  };
+  #endif
+
+  #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+  template<typename ValueType>
+  class scratch_arena
+  {
+  public:
+    // The scratch arena holds the temporary storage of the multiplication
+    // kernels. It is kept per value type and per thread and it only grows,
+    // so that repeated multiplications do not allocate. Storage is taken
+    // and given back in stack order (see scratch_frame). A request which
+    // does not fit while other storage is taken (nested use) returns nullptr.
+    // The arena is then enlarged to the peak demand when it is next used
+    // from its bottom. Storage exceeding four times
+    // mul_transform_cache_max_points() is freed when it is given back.
+
+    using value_type = ValueType;
+    using size_type  = std::size_t;
+
+    scratch_arena() = default;
+
+    scratch_arena(const scratch_arena&) = delete;
+    scratch_arena(scratch_arena&&) noexcept = default;
+
+    ~scratch_arena() = default;
+
+    auto operator=(const scratch_arena&) -> scratch_arena& = delete;
+    auto operator=(scratch_arena&&) noexcept -> scratch_arena& = default;
+
+    auto take(const size_type count) -> value_type*
+    {
+      my_demand = (std::max)(my_demand, static_cast<size_type>(my_used + count));
+
+      if((my_used == static_cast<size_type>(UINT8_C(0))) && (my_demand > my_storage.size()))
+      {
+        my_storage = storage_type(my_demand);
+      }
+
+      if(count > static_cast<size_type>(my_storage.size() - my_used))
+      {
+        return nullptr;
+      }
+
+      value_type* p = my_storage.data() + my_used; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      my_used += count;
+
+      return p;
+    }
+
+    auto give_back(const size_type count) -> void
+    {
+      my_used -= count;
+
+      if(   (my_used == static_cast<size_type>(UINT8_C(0)))
+         && (my_storage.size() > static_cast<size_type>(static_cast<size_type>(mul_transform_cache_max_points()) * 4U)))
+      {
+        release();
+      }
+    }
+
+    auto release() -> void
+    {
+      // Storage which is in use can not be freed.
+      if(my_used == static_cast<size_type>(UINT8_C(0)))
+      {
+        my_storage = storage_type();
+        my_demand  = static_cast<size_type>(UINT8_C(0));
+      }
+    }
+
+    auto capacity() const noexcept -> size_type { return my_storage.size(); }
+
+  private:
+    using storage_type = util::dynamic_array<value_type>;
+
+    storage_type my_storage { };
+    size_type    my_used    { };
+    size_type    my_demand  { };
+  };
+
+  template<typename ValueType>
+  auto scratch_arena_instance() -> scratch_arena<ValueType>&
+  {
+    // The arenas are kept per value type and per thread,
+    // so that concurrent multiplications do not share them.
+    static thread_local scratch_arena<ValueType> my_arena { };
+
+    return my_arena;
+  }
+
+  template<typename ValueType>
+  auto scratch_arena_release() -> void
+  {
+    // Free the arena of the calling thread (if none of it is in use).
+    scratch_arena_instance<ValueType>().release();
+  }
+
+  template<typename ValueType>
+  class scratch_frame
+  {
+  public:
+    // A scratch frame takes count elements (which are not initialized)
+    // from the arena of the calling thread for its lifetime. It falls back
+    // to its own storage if the arena can not provide the elements.
+
+    using value_type = ValueType;
+    using size_type  = std::size_t;
+
+    explicit scratch_frame(const size_type count)
+      : my_arena(scratch_arena_instance<value_type>()),
+        my_count(count),
+        my_data (my_arena.take(count))
+    {
+      if(my_data == nullptr)
+      {
+        my_own_storage = storage_type(count);
+
+        my_data = my_own_storage.data();
+      }
+    }
+
+    scratch_frame() = delete;
+
+    scratch_frame(const scratch_frame&) = delete;
+    scratch_frame(scratch_frame&&) = delete;
+
+    ~scratch_frame()
+    {
+      if(my_own_storage.data() == nullptr)
+      {
+        my_arena.give_back(my_count);
+      }
+    }
+
+    auto operator=(const scratch_frame&) -> scratch_frame& = delete;
+    auto operator=(scratch_frame&&) -> scratch_frame& = delete;
+
+    auto data() noexcept -> value_type* { return my_data; }
+
+  private:
+    using storage_type = util::dynamic_array<value_type>;
+
+    scratch_arena<value_type>& my_arena;       // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+    size_type                  my_count;
+    value_type*                my_data;
+    storage_type               my_own_storage { };
+  };
+  #endif
+
+  template<typename LimbType,
+           typename FftFloatType>
+  struct decwide_t_mul_thresholds
+  {
+    // These are the limb counts at which multiplication switches
+    // from schoolbook to Karatsuba, from Karatsuba to Toom-Cook 3-way,
+    // from Toom-Cook 3-way to FFT and from FFT to NTT. The defaults
+    // of the first three depend on the limb type only and lie between
+    // the crossover points measured on x86_64 for portable (-O2) and for
+    // host-tuned (-O3 -march=native) builds. The NTT takes over where
+    // the FFT is no longer considered to be safe with respect to rounding,
+    // according to the heuristic error estimate of fft_is_safe_as_constexpr.
+    // Host-specific values for each pair of limb type and FFT float type
+    // can be provided as explicit specializations in a header generated
+    // by the calibration tool (see tools/decwide_t_calibrate.cpp).
+    // This header is included below if WIDE_DECIMAL_MUL_THRESHOLDS_HEADER
+    // is defined.
+
+    // Note for 16-bit limbs: The column-wise schoolbook multiplication
+    // accumulates up to (elems_for_kara - 1) products of two limbs
+    // in a 32-bit sum, so elems_for_kara may not exceed 43 here.
+    // For 64-bit limbs, the 128-bit products make the schoolbook kernel
+    // competitive up to several hundred limbs, and Toom-Cook 3-way
+    // does not pay off before the FFT takes over.
+    static constexpr std::int32_t elems_for_kara  = std::is_same<LimbType, std::uint64_t>::value ? static_cast<std::int32_t>(INT32_C( 500) + INT32_C(1))
+                                                  : std::is_same<LimbType, std::uint32_t>::value ? static_cast<std::int32_t>(INT32_C( 112) + INT32_C(1))
+                                                  : std::is_same<LimbType, std::uint16_t>::value ? static_cast<std::int32_t>(INT32_C(  42) + INT32_C(1))
+                                                  :                                                static_cast<std::int32_t>(INT32_C(  40) + INT32_C(1));
+    static constexpr std::int32_t elems_for_toom3 = std::is_same<LimbType, std::uint64_t>::value ? static_cast<std::int32_t>(INT32_C( 640) + INT32_C(1))
+                                                  : std::is_same<LimbType, std::uint32_t>::value ? static_cast<std::int32_t>(INT32_C( 576) + INT32_C(1))
+                                                  :                                                static_cast<std::int32_t>(INT32_C( 416) + INT32_C(1));
+    static constexpr std::int32_t elems_for_fft   = std::is_same<LimbType, std::uint32_t>::value ? static_cast<std::int32_t>(INT32_C(1792) + INT32_C(1))
+                                                  : std::is_same<LimbType, std::uint16_t>::value ? static_cast<std::int32_t>(INT32_C(1152) + INT32_C(1))
+                                                  :                                                static_cast<std::int32_t>(INT32_C( 640) + INT32_C(1));
+    static constexpr std::int32_t elems_for_ntt   = static_cast<std::int32_t>(fft_safe_elems_as_constexpr<LimbType, FftFloatType>() + INT32_C(1));
+  };
+
+  template<typename LimbType, typename FftFloatType> constexpr std::int32_t decwide_t_mul_thresholds<LimbType, FftFloatType>::elems_for_kara;  // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+  template<typename LimbType, typename FftFloatType> constexpr std::int32_t decwide_t_mul_thresholds<LimbType, FftFloatType>::elems_for_toom3; // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+  template<typename LimbType, typename FftFloatType> constexpr std::int32_t decwide_t_mul_thresholds<LimbType, FftFloatType>::elems_for_fft;   // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+  template<typename LimbType, typename FftFloatType> constexpr std::int32_t decwide_t_mul_thresholds<LimbType, FftFloatType>::elems_for_ntt;   // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+
   template<typename MyType,
            const std::size_t MySize,
            typename MyAlloc>
@@ -632,6 +1119,384 @@
     auto operator[](const size_type i) const -> typename base_class_type::const_reference { return base_class_type::operator[](static_cast<typename base_class_type::size_type>(i)); }
   };
 
+  // The fixed_small_buffer_array stores the first MySmallSize elements
+  // inline. It takes the storage of all MySize elements from the allocator
+  // only when non-const access reaches an element beyond these (spilling).
+  // Const access never spills, so const values can be read by several
+  // threads at the same time. The const iterators of a small array read
+  // its inline elements followed by zeros. The pointer of data() const
+  // reaches only the inline elements of a small array. If the allocator
+  // is exhausted (an n_slot_array_allocator returns nullptr when all
+  // of its slots are in use), the storage is taken from std::allocator.
+
+  template<typename MyType,
+           const std::size_t MySize,
+           const std::size_t MySmallSize,
+           typename MyAlloc>
+  class fixed_small_buffer_array final
+  {
+  private:
+    static constexpr auto my_small_size = (std::min)(MySmallSize, MySize);
+
+    using small_array_type = std::array<MyType, my_small_size>;
+
+  public:
+    using allocator_type  = typename std::allocator_traits<MyAlloc>::template rebind_alloc<MyType>;
+    using value_type      = MyType;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       =       value_type&;
+    using const_reference = const value_type&;
+    using pointer         =       value_type*;
+    using const_pointer   = const value_type*;
+    using iterator        =       value_type*;
+
+    class const_iterator
+    {
+    public:
+      using iterator_category = std::random_access_iterator_tag;
+      using value_type        = MyType;
+      using difference_type   = std::ptrdiff_t;
+      using pointer           = const value_type*;
+      using reference         = const value_type&;
+
+      constexpr const_iterator() = default;
+
+      constexpr const_iterator(const_pointer p, const size_type valid_count, const difference_type index) noexcept
+        : my_p(p),
+          my_valid_count(valid_count),
+          my_index(index) { }
+
+      auto operator* () const -> reference { return operator[](static_cast<difference_type>(INT8_C(0))); }
+
+      auto operator[](const difference_type n) const -> reference
+      {
+        const auto i = static_cast<size_type>(my_index + n);
+
+        return ((i < my_valid_count) ? my_p[i] : my_zero); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      auto operator++() -> const_iterator& { ++my_index; return *this; }
+      auto operator--() -> const_iterator& { --my_index; return *this; }
+
+      auto operator++(int) -> const_iterator { const_iterator tmp(*this); ++my_index; return tmp; }
+      auto operator--(int) -> const_iterator { const_iterator tmp(*this); --my_index; return tmp; }
+
+      auto operator+=(const difference_type n) -> const_iterator& { my_index += n; return *this; }
+      auto operator-=(const difference_type n) -> const_iterator& { my_index -= n; return *this; }
+
+      auto operator+(const difference_type n) const -> const_iterator { return const_iterator(my_p, my_valid_count, my_index + n); }
+      auto operator-(const difference_type n) const -> const_iterator { return const_iterator(my_p, my_valid_count, my_index - n); }
+
+      auto operator-(const const_iterator& other) const -> difference_type { return my_index - other.my_index; }
+
+      auto operator==(const const_iterator& other) const -> bool { return (my_index == other.my_index); }
+      auto operator!=(const const_iterator& other) const -> bool { return (my_index != other.my_index); }
+      auto operator< (const const_iterator& other) const -> bool { return (my_index <  other.my_index); }
+      auto operator> (const const_iterator& other) const -> bool { return (my_index >  other.my_index); }
+      auto operator<=(const const_iterator& other) const -> bool { return (my_index <= other.my_index); }
+      auto operator>=(const const_iterator& other) const -> bool { return (my_index >= other.my_index); }
+
+    private:
+      const_pointer   my_p           { nullptr }; // NOLINT(readability-identifier-naming)
+      size_type       my_valid_count { };         // NOLINT(readability-identifier-naming)
+      difference_type my_index       { };         // NOLINT(readability-identifier-naming)
+    };
+
+    static constexpr auto static_size() -> size_type { return MySize; }
+    static constexpr auto small_size () -> size_type { return my_small_size; }
+
+    explicit fixed_small_buffer_array(const size_type   s = MySize,
+                                      const value_type& v = value_type())
+    {
+      const auto size_to_fill = (std::min)(s, static_size());
+
+      if(v != value_type())
+      {
+        if(size_to_fill <= small_size())
+        {
+          std::fill(my_small.begin(), my_small.begin() + static_cast<std::ptrdiff_t>(size_to_fill), v);
+        }
+        else
+        {
+          std::fill(begin(), begin() + static_cast<std::ptrdiff_t>(size_to_fill), v);
+        }
+      }
+    }
+
+    fixed_small_buffer_array(std::initializer_list<value_type> lst)
+    {
+      const auto size_to_copy = (std::min)(static_cast<size_type>(lst.size()), static_size());
+
+      for(auto i = static_cast<size_type>(UINT8_C(0)); i < size_to_copy; ++i)
+      {
+        operator[](i) = *(lst.begin() + static_cast<std::ptrdiff_t>(i));
+      }
+    }
+
+    fixed_small_buffer_array(const fixed_small_buffer_array& other) : my_small(other.my_small)
+    {
+      if(other.my_large != nullptr)
+      {
+        std::copy(other.my_large, other.my_large + static_size(), allocate_large()); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
+
+    fixed_small_buffer_array(fixed_small_buffer_array&& other) noexcept : my_small(other.my_small),
+                                                                          my_large(other.my_large),
+                                                                          my_large_is_fallback(other.my_large_is_fallback)
+    {
+      other.my_large             = nullptr;
+      other.my_large_is_fallback = false;
+    }
+
+    ~fixed_small_buffer_array()
+    {
+      release_large();
+    }
+
+    auto operator=(const fixed_small_buffer_array& other) -> fixed_small_buffer_array& // NOLINT(cert-oop54-cpp)
+    {
+      if(this != &other)
+      {
+        if(other.my_large == nullptr)
+        {
+          // Assigning a small value makes this small too.
+          release_large();
+
+          my_small = other.my_small;
+        }
+        else
+        {
+          std::copy(other.my_large,
+                    other.my_large + static_size(), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    ((my_large == nullptr) ? allocate_large() : my_large));
+        }
+      }
+
+      return *this;
+    }
+
+    auto operator=(fixed_small_buffer_array&& other) noexcept -> fixed_small_buffer_array&
+    {
+      swap(other);
+
+      return *this;
+    }
+
+    WIDE_DECIMAL_NODISCARD auto is_small() const noexcept -> bool { return (my_large == nullptr); }
+
+    auto begin ()       -> iterator       { return spill(); }
+    auto end   ()       -> iterator       { return spill() + static_size(); } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto begin () const -> const_iterator { return cbegin(); }
+    auto end   () const -> const_iterator { return cend(); }
+    auto cbegin() const -> const_iterator { return const_iterator(data(), valid_size(), static_cast<difference_type>(INT8_C(0))); }
+    auto cend  () const -> const_iterator { return const_iterator(data(), valid_size(), static_cast<difference_type>(static_size())); }
+
+    auto data()       -> pointer       { return spill(); }
+    auto data() const -> const_pointer { return ((my_large != nullptr) ? my_large : my_small.data()); }
+
+    auto begin_within(const size_type count) -> iterator
+    {
+      // Get the first count elements for reading and writing. These are
+      // the inline elements, if the array is small and these suffice.
+      return (((my_large == nullptr) && (count <= small_size())) ? my_small.data() : spill());
+    }
+
+    static constexpr auto size    () noexcept -> size_type { return static_size(); }
+    static constexpr auto max_size() noexcept -> size_type { return static_size(); }
+    static constexpr auto empty   () noexcept -> bool      { return (static_size() == static_cast<size_type>(UINT8_C(0))); }
+
+    auto operator[](const size_type i) -> reference
+    {
+      if(my_large != nullptr)
+      {
+        return my_large[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      return ((i < small_size()) ? my_small[i] : spill()[i]); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    auto operator[](const size_type i) const -> const_reference
+    {
+      return
+        ((my_large != nullptr) ? my_large[i]                                    // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                               : ((i < small_size()) ? my_small[i] : my_zero)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    }
+
+    auto front()       -> reference       { return operator[](static_cast<size_type>(UINT8_C(0))); }
+    auto front() const -> const_reference { return operator[](static_cast<size_type>(UINT8_C(0))); }
+
+    auto fill(const value_type& v) -> void
+    {
+      if((my_large == nullptr) && (v == value_type()))
+      {
+        my_small.fill(v);
+      }
+      else
+      {
+        std::fill(begin(), end(), v);
+      }
+    }
+
+    auto swap(fixed_small_buffer_array& other) noexcept -> void
+    {
+      if(this != &other)
+      {
+        std::swap(my_small,             other.my_small);
+        std::swap(my_large,             other.my_large);
+        std::swap(my_large_is_fallback, other.my_large_is_fallback);
+      }
+    }
+
+    auto swap(fixed_small_buffer_array&& other) noexcept -> void
+    {
+      swap(other);
+    }
+
+  private:
+    static constexpr value_type my_zero { };
+
+    small_array_type my_small             { };         // NOLINT(readability-identifier-naming)
+    pointer          my_large             { nullptr }; // NOLINT(readability-identifier-naming)
+    bool             my_large_is_fallback { false };   // NOLINT(readability-identifier-naming)
+
+    auto valid_size() const noexcept -> size_type { return ((my_large != nullptr) ? static_size() : small_size()); }
+
+    auto allocate_large() -> pointer
+    {
+      allocator_type my_a;
+
+      my_large = std::allocator_traits<allocator_type>::allocate(my_a, static_size());
+
+      if(my_large == nullptr)
+      {
+        // The allocator is exhausted. Exceptions are not used,
+        // so take the storage from std::allocator instead.
+        std::allocator<value_type> my_fallback_a;
+
+        my_large = std::allocator_traits<std::allocator<value_type>>::allocate(my_fallback_a, static_size());
+
+        my_large_is_fallback = true;
+      }
+
+      return my_large;
+    }
+
+    auto release_large() -> void
+    {
+      if(my_large != nullptr)
+      {
+        if(my_large_is_fallback)
+        {
+          std::allocator<value_type> my_fallback_a;
+
+          std::allocator_traits<std::allocator<value_type>>::deallocate(my_fallback_a, my_large, static_size());
+        }
+        else
+        {
+          allocator_type my_a;
+
+          std::allocator_traits<allocator_type>::deallocate(my_a, my_large, static_size());
+        }
+
+        my_large             = nullptr;
+        my_large_is_fallback = false;
+      }
+    }
+
+    auto spill() -> pointer
+    {
+      if(my_large == nullptr)
+      {
+        // Move the inline elements to the allocated storage
+        // and clear the elements beyond these.
+        std::copy(my_small.cbegin(), my_small.cend(), allocate_large());
+
+        std::fill(my_large + small_size(), my_large + static_size(), value_type()); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      return my_large;
+    }
+  };
+
+  template<typename MyType, const std::size_t MySize, const std::size_t MySmallSize, typename MyAlloc> constexpr typename fixed_small_buffer_array<MyType, MySize, MySmallSize, MyAlloc>::value_type fixed_small_buffer_array<MyType, MySize, MySmallSize, MyAlloc>::my_zero; // NOLINT(readability-redundant-declaration)
+
+  // Get the number of significant elements among the first count
+  // elements of a representation. These exclude the trailing zeros.
+  template<typename RepresentationType>
+  auto significant_elems(const RepresentationType& data, const std::int32_t count) -> std::int32_t
+  {
+    auto it = data.cbegin() + static_cast<std::ptrdiff_t>(count); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+    while((it != data.cbegin()) && (*(it - 1) == static_cast<typename RepresentationType::value_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      --it;
+    }
+
+    return static_cast<std::int32_t>(it - data.cbegin());
+  }
+
+  template<typename MyType, const std::size_t MySize, const std::size_t MySmallSize, typename MyAlloc>
+  auto significant_elems(const fixed_small_buffer_array<MyType, MySize, MySmallSize, MyAlloc>& data, const std::int32_t count) -> std::int32_t
+  {
+    // The elements of a small value are zero beyond its inline
+    // elements. These are scanned by index, which does not spill.
+    if(!data.is_small())
+    {
+      const auto* p_data = data.data();
+
+      auto n = count;
+
+      while((n > static_cast<std::int32_t>(INT8_C(0))) && (p_data[n - 1] == static_cast<MyType>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        --n;
+      }
+
+      return n;
+    }
+
+    auto n = (std::min)(count, static_cast<std::int32_t>(data.small_size()));
+
+    while((n > static_cast<std::int32_t>(INT8_C(0))) && (data[static_cast<std::size_t>(n - 1)] == static_cast<MyType>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      --n;
+    }
+
+    return n;
+  }
+
+  // Get an iterator to the first count elements of a representation
+  // for reading and writing these. A small-buffer representation
+  // spills only if count exceeds its inline elements.
+  template<typename RepresentationType>
+  auto elems_begin(RepresentationType& data, const std::int32_t count) -> typename RepresentationType::iterator
+  {
+    static_cast<void>(count);
+
+    return data.begin();
+  }
+
+  template<typename MyType, const std::size_t MySize, const std::size_t MySmallSize, typename MyAlloc>
+  auto elems_begin(fixed_small_buffer_array<MyType, MySize, MySmallSize, MyAlloc>& data, const std::int32_t count) -> typename fixed_small_buffer_array<MyType, MySize, MySmallSize, MyAlloc>::iterator
+  {
+    return data.begin_within(static_cast<std::size_t>(count));
+  }
+
+  // Query the inline element count of an allocator used by decwide_t.
+  // It is nonzero only for util::small_buffer_allocator.
+  template<typename AllocatorType>
+  struct small_buffer_allocator_traits
+  {
+    static constexpr auto small_count() noexcept -> std::size_t { return static_cast<std::size_t>(UINT8_C(0)); }
+  };
+
+  template<typename T, const std::size_t SmallCount, typename AllocatorType>
+  struct small_buffer_allocator_traits<util::small_buffer_allocator<T, SmallCount, AllocatorType>>
+  {
+    static constexpr auto small_count() noexcept -> std::size_t { return SmallCount; }
+  };
+
   enum class os_float_field_type // NOLINT(performance-enum-size)
   {
     scientific,
@@ -767,4 +1632,13 @@
 
   WIDE_DECIMAL_NAMESPACE_END
 
+  // Optionally pick up host-specific multiplication thresholds.
+  // These are explicit specializations of decwide_t_mul_thresholds
+  // as generated by the calibration tool. Define the header name
+  // when compiling, for instance as in:
+  // -DWIDE_DECIMAL_MUL_THRESHOLDS_HEADER=\"decwide_t_mul_thresholds_host.h\"
+  #if defined(WIDE_DECIMAL_MUL_THRESHOLDS_HEADER)
+  #include WIDE_DECIMAL_MUL_THRESHOLDS_HEADER
+  #endif
+
 #endif // DECWIDE_T_DETAIL_2020_10_26_H
@@ -11,12 +11,23 @@
 
 // This file implements a somewhat naive FFT used
 // for large-digit FFT multiplication in decwide_t.
+// The twiddle factors are precomputed in tables,
+// which are cached (along with the scratch buffers)
+// in FFT plans.
 
 #ifndef DECWIDE_T_DETAIL_FFT_2013_01_08_H // NOLINT(llvm-header-guard)
   #define DECWIDE_T_DETAIL_FFT_2013_01_08_H
 
+  #include <math/wide_decimal/decwide_t_detail_fft_simd.h>
+  #include <util/utility/util_dynamic_array.h>
+
+  #include <algorithm>
   #include <array>
+  #include <cmath>
+  #include <cstddef>
   #include <cstdint>
+  #include <type_traits>
+  #include <utility>
 
   WIDE_DECIMAL_NAMESPACE_BEGIN
 
@@ -65,120 +76,118 @@
   // LCOV_EXCL_STOP
 
   template<typename float_type>
-  constexpr auto template_sin_order_1(std::uint32_t num_points) -> float_type // NOLINT(readability-function-cognitive-complexity)
+  auto fft_make_twiddles(const std::uint32_t num_points, float_type* tw) -> void
   {
-    // Mathematica command: Table[N[Sin[Pi / (2^n)], 41], {n, 1, 31, 1}]
-    return
-      (num_points == static_cast<std::uint32_t>(UINT32_C(2)       )) ? static_cast<float_type>(1.0F)                                            : // Pi / 2    : as uint64_t --> UINT64_C(0x3FF0000000000000) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(4)       )) ? static_cast<float_type>(7.0710678118654752440084436210484903928484E-01L) : // Pi / 4    : as uint64_t --> UINT64_C(0x3FE6A09E667F3BCD) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(8)       )) ? static_cast<float_type>(3.8268343236508977172845998403039886676134E-01L) : // Pi / 8    : as uint64_t --> UINT64_C(0x3FD87DE2A6AEA963) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(16)      )) ? static_cast<float_type>(1.9509032201612826784828486847702224092769E-01L) : // Pi / 16   : as uint64_t --> UINT64_C(0x3FC8F8B83C69A60B) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(32)      )) ? static_cast<float_type>(9.8017140329560601994195563888641845861137E-02L) : // Pi / 32   : as uint64_t --> UINT64_C(0x3FB917A6BC29B42C) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(64)      )) ? static_cast<float_type>(4.9067674327418014254954976942682658314745E-02L) : // Pi / 64   : as uint64_t --> UINT64_C(0x3FA91F65F10DD814) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(128)     )) ? static_cast<float_type>(2.4541228522912288031734529459282925065466E-02L) : // Pi / 128  : as uint64_t --> UINT64_C(0x3F992155F7A3667E) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) <<  8U)) ? static_cast<float_type>(1.2271538285719926079408261951003212140372E-02L) : // Pi / 2^8  : as uint64_t --> UINT64_C(0x3F8921D1FCDEC784) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) <<  9U)) ? static_cast<float_type>(6.1358846491544753596402345903725809170579E-03L) : // Pi / 2^9  : as uint64_t --> UINT64_C(0x3F7921F0FE670071) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 10U)) ? static_cast<float_type>(3.0679567629659762701453654909198425189446E-03L) : // Pi / 2^10 : as uint64_t --> UINT64_C(0x3F6921F8BECCA4BA) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 11U)) ? static_cast<float_type>(1.5339801862847656123036971502640790799549E-03L) : // Pi / 2^11 : as uint64_t --> UINT64_C(0x3F5921FAAEE6472E) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 12U)) ? static_cast<float_type>(7.6699031874270452693856835794857664314092E-04L) : // Pi / 2^12 : as uint64_t --> UINT64_C(0x3F4921FB2AECB360) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 13U)) ? static_cast<float_type>(3.8349518757139558907246168118138126339503E-04L) : // Pi / 2^13 : as uint64_t --> UINT64_C(0x3F3921FB49EE4EA6) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 14U)) ? static_cast<float_type>(1.9174759731070330743990956198900093346887E-04L) : // Pi / 2^14 : as uint64_t --> UINT64_C(0x3F2921FB51AEB57C) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 15U)) ? static_cast<float_type>(9.5873799095977345870517210976476351187066E-05L) : // Pi / 2^15 : as uint64_t --> UINT64_C(0x3F1921FB539ECF31) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 16U)) ? static_cast<float_type>(4.7936899603066884549003990494658872746867E-05L) : // Pi / 2^16 : as uint64_t --> UINT64_C(0x3F0921FB541AD59E) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      // LCOV_EXCL_START
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 17U)) ? static_cast<float_type>(2.3968449808418218729186577165021820094761E-05L) : // Pi / 2^17 : as uint64_t --> UINT64_C(0x3EF921FB5439D73A) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 18U)) ? static_cast<float_type>(1.1984224905069706421521561596988984804732E-05L) : // Pi / 2^18 : as uint64_t --> UINT64_C(0x3EE921FB544197A1) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 19U)) ? static_cast<float_type>(5.9921124526424278428797118088908617299872E-06L) : // Pi / 2^19 : as uint64_t --> UINT64_C(0x3ED921FB544387BA) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 20U)) ? static_cast<float_type>(2.9960562263346607504548128083570598118252E-06L) : // Pi / 2^20 : as uint64_t --> UINT64_C(0x3EC921FB544403C1) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 21U)) ? static_cast<float_type>(1.4980281131690112288542788461553611206918E-06L) : // Pi / 2^21 : as uint64_t --> UINT64_C(0x3EB921FB544422C2) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 22U)) ? static_cast<float_type>(7.4901405658471572113049856673065563715596E-07L) : // Pi / 2^22 : as uint64_t --> UINT64_C(0x3EA921FB54442A83) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 23U)) ? static_cast<float_type>(3.7450702829238412390316917908463317739740E-07L) : // Pi / 2^23 : as uint64_t --> UINT64_C(0x3E9921FB54442C73) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 24U)) ? static_cast<float_type>(1.8725351414619534486882457659356361712045E-07L) : // Pi / 2^24 : as uint64_t --> UINT64_C(0x3E8921FB54442CEF) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 25U)) ? static_cast<float_type>(9.3626757073098082799067286680885620193237E-08L) : // Pi / 2^25 : as uint64_t --> UINT64_C(0x3E7921FB54442D0E) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 26U)) ? static_cast<float_type>(4.6813378536549092695115518138540096959504E-08L) : // Pi / 2^26 : as uint64_t --> UINT64_C(0x3E6921FB54442D16) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 27U)) ? static_cast<float_type>(2.3406689268274552759505493419034844037886E-08L) : // Pi / 2^27 : as uint64_t --> UINT64_C(0x3E5921FB54442D18) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 28U)) ? static_cast<float_type>(1.1703344634137277181246213503238103798093E-08L) : // Pi / 2^28 : as uint64_t --> UINT64_C(0x3E4921FB54442D18) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 29U)) ? static_cast<float_type>(5.8516723170686386908097901008341396943900E-09L) : // Pi / 2^29 : as uint64_t --> UINT64_C(0x3E3921FB54442D18) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 30U)) ? static_cast<float_type>(2.9258361585343193579282304690689559020176E-09L) : // Pi / 2^30 : as uint64_t --> UINT64_C(0x3E2921FB54442D18) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 31U)) ? static_cast<float_type>(1.4629180792671596805295321618659637103743E-09L) : // Pi / 2^31 : as uint64_t --> UINT64_C(0x3E1921FB54442D18) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      // LCOV_EXCL_STOP
-                                                                       static_cast<float_type>(0.0F)                                              // Pi        : as uint64_t --> UINT64_C(0x0000000000000000) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      ;
-  }
+    // Store the twiddle factors w_L^k = exp(2*pi*i*k / L) for all stages
+    // L = 2, 4, ..., num_points contiguously as complex numbers.
+    // For the stage L, the factors with k = 0...(L/2 - 1) are located
+    // at the complex index (L/2) + k, in other words at tw[L + 2k]
+    // (real part) and tw[L + 2k + 1] (imaginary part). The table
+    // thus has (2 * num_points) elements. The tables of the smaller
+    // stages are also the tables of smaller transforms.
 
-  template<typename float_type>
-  constexpr auto template_sin_order_2(std::uint32_t num_points) -> float_type
-  {
-    return template_sin_order_1<float_type>(static_cast<std::uint32_t>(num_points / 2U));
-  }
+    // The factors of the largest stage are computed with trigonometric
+    // functions in long double, using the symmetries within the first
+    // two octants. The smaller stages use every second factor of
+    // the next larger stage. Inverse transforms use the complex
+    // conjugates of the factors.
 
-  template<typename float_type,
-           const bool IsForwardFft>
-  constexpr auto const_unique_wp_real_init(std::uint32_t num_points) -> typename std::enable_if<IsForwardFft, float_type>::type
-  {
-    return template_sin_order_1<float_type>(num_points);
-  }
+    constexpr auto two_pi = static_cast<long double>(6.2831853071795864769252867665590057683943L); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
 
-  template<typename float_type,
-           const bool IsForwardFft>
-  constexpr auto const_unique_wp_real_init(std::uint32_t num_points) -> typename std::enable_if<(!IsForwardFft), float_type>::type
-  {
-    return static_cast<float_type>(-template_sin_order_1<float_type>(num_points));
-  }
+    const auto n_half    = static_cast<std::uint32_t>(num_points / 2U);
+    const auto n_quarter = static_cast<std::uint32_t>(num_points / 4U);
+    const auto n_eighth  = static_cast<std::uint32_t>(num_points / 8U);
 
-  template<typename float_type,
-           const bool IsForwardFft>
-  constexpr auto const_unique_wp_imag(std::uint32_t num_points) -> typename std::enable_if<IsForwardFft, float_type>::type
-  {
-    return template_sin_order_2<float_type>(num_points);
+    float_type* tw_top = tw + num_points; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    using std::cos;
+    using std::sin;
+
+    for(auto k = static_cast<std::uint32_t>(UINT8_C(0)); k <= n_eighth; ++k)
+    {
+      const auto phi = static_cast<long double>((two_pi * static_cast<long double>(k)) / static_cast<long double>(num_points));
+
+      const auto c = static_cast<float_type>(cos(phi));
+      const auto s = static_cast<float_type>(sin(phi));
+
+      // w^k = (c, s), w^(n/4 - k) = (s, c)
+      // w^(n/4 + k) = (-s, c), w^(n/2 - k) = (-c, s)
+      tw_top[(k * 2U) + 0U] = c; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      tw_top[(k * 2U) + 1U] = s; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      tw_top[((n_quarter - k) * 2U) + 0U] = s; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      tw_top[((n_quarter - k) * 2U) + 1U] = c; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      if((n_quarter + k) < n_half)
+      {
+        tw_top[((n_quarter + k) * 2U) + 0U] = -s; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        tw_top[((n_quarter + k) * 2U) + 1U] =  c; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      if(k > static_cast<std::uint32_t>(UINT8_C(0)))
+      {
+        tw_top[((n_half - k) * 2U) + 0U] = -c; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        tw_top[((n_half - k) * 2U) + 1U] =  s; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
+
+    for(auto stage = n_half; stage >= static_cast<std::uint32_t>(UINT8_C(2)); stage /= 2U)
+    {
+      float_type*       tw_dst = tw + stage;                // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const float_type* tw_src = tw + (stage * 2U);         // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      for(auto k = static_cast<std::uint32_t>(UINT8_C(0)); k < stage; k += 2U)
+      {
+        tw_dst[k + 0U] = tw_src[(k * 2U) + 0U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        tw_dst[k + 1U] = tw_src[(k * 2U) + 1U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
   }
 
   template<typename float_type,
            const bool IsForwardFft>
-  constexpr auto const_unique_wp_imag(std::uint32_t num_points) -> typename std::enable_if<(!IsForwardFft), float_type>::type
+  constexpr auto twiddle_imag(const float_type imag_part) -> typename std::enable_if<IsForwardFft, float_type>::type
   {
-    return static_cast<float_type>(-template_sin_order_2<float_type>(num_points));
+    return imag_part;
   }
 
   template<typename float_type,
            const bool IsForwardFft>
-  constexpr auto const_unique_wp_real(std::uint32_t num_points) -> float_type
+  constexpr auto twiddle_imag(const float_type imag_part) -> typename std::enable_if<(!IsForwardFft), float_type>::type
   {
-    return
-      static_cast<float_type>
-      (
-        -2 * (  const_unique_wp_real_init<float_type, IsForwardFft>(num_points)
-              * const_unique_wp_real_init<float_type, IsForwardFft>(num_points))
-      );
+    return -imag_part;
   }
 
   template<typename float_type,
            const bool IsForwardFft>
-  auto danielson_lanczos_apply_4_basecase(float_type* data) -> void;
+  auto danielson_lanczos_apply_4_basecase(float_type* data, const float_type* tw) -> void;
 
   template<typename float_type,
            const bool IsForwardFft>
-  auto danielson_lanczos_apply(std::uint32_t num_points, float_type* data) -> void // NOLINT(misc-no-recursion)
+  auto danielson_lanczos_apply(std::uint32_t num_points, float_type* data, const float_type* tw) -> void // NOLINT(misc-no-recursion)
   {
     if(num_points == static_cast<std::uint32_t>(UINT8_C(8)))
     {
-      danielson_lanczos_apply_4_basecase<float_type, IsForwardFft>(data);
-      danielson_lanczos_apply_4_basecase<float_type, IsForwardFft>(data + num_points); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      danielson_lanczos_apply_4_basecase<float_type, IsForwardFft>(data, tw);
+      danielson_lanczos_apply_4_basecase<float_type, IsForwardFft>(data + num_points, tw); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     }
     else
     {
-      danielson_lanczos_apply<float_type, IsForwardFft>(num_points / 2U, data);
-      danielson_lanczos_apply<float_type, IsForwardFft>(num_points / 2U, data + num_points); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      danielson_lanczos_apply<float_type, IsForwardFft>(num_points / 2U, data, tw);
+      danielson_lanczos_apply<float_type, IsForwardFft>(num_points / 2U, data + num_points, tw); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     }
 
-    auto real_part = static_cast<float_type>(1);
-    auto imag_part = static_cast<float_type>(0);
+    // The twiddle factors of this stage are located at tw + num_points.
+    const float_type* tw_stage = tw + num_points; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
     for(auto i  = static_cast<std::uint32_t>(UINT8_C(0));
              i  < num_points;
              i += static_cast<std::uint32_t>(UINT8_C(2)))
     {
-            auto tmp_real = static_cast<float_type>((real_part * data[i + (num_points + 0U)]) - (imag_part * data[i + (num_points + 1U)])); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const auto real_part =                                        tw_stage[i + 0U];  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const auto imag_part = twiddle_imag<float_type, IsForwardFft>(tw_stage[i + 1U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      const auto tmp_real = static_cast<float_type>((real_part * data[i + (num_points + 0U)]) - (imag_part * data[i + (num_points + 1U)])); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
       const auto tmp_imag = static_cast<float_type>((real_part * data[i + (num_points + 1U)]) + (imag_part * data[i + (num_points + 0U)])); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
       data[i + (num_points + 0U)] = data[i + 0U] - tmp_real; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -186,17 +195,12 @@
 
       data[i + 0U] += tmp_real; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
       data[i + 1U] += tmp_imag; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-
-      tmp_real = real_part;
-
-      real_part += ((tmp_real  * const_unique_wp_real<float_type, IsForwardFft>(num_points)) - (imag_part * const_unique_wp_imag<float_type, IsForwardFft>(num_points)));
-      imag_part += ((imag_part * const_unique_wp_real<float_type, IsForwardFft>(num_points)) + (tmp_real  * const_unique_wp_imag<float_type, IsForwardFft>(num_points)));
     }
   }
 
   template<typename float_type,
            const bool IsForwardFft>
-  auto danielson_lanczos_apply_4_basecase(float_type* data) -> void
+  auto danielson_lanczos_apply_4_basecase(float_type* data, const float_type* tw) -> void
   {
     const auto tmp_real_2_0 = data[2U];            // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     const auto tmp_imag_2_0 = data[3U];            // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -223,8 +227,9 @@
     data[0U] += tmp_real;                          // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     data[1U] += tmp_imag;                          // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-    const auto real_part = static_cast<float_type>(const_unique_wp_real<float_type, IsForwardFft>(4U) + template_one<float_type>());
-    const auto imag_part = static_cast<float_type>(const_unique_wp_imag<float_type, IsForwardFft>(4U));
+    // The twiddle factor w_4^1 is located at the complex index 3.
+    const auto real_part =                                        tw[6U];  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    const auto imag_part = twiddle_imag<float_type, IsForwardFft>(tw[7U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
 
     tmp_real = (real_part * data[6U]) - (imag_part * data[7U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
     tmp_imag = (real_part * data[7U]) + (imag_part * data[6U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
@@ -236,48 +241,331 @@
     data[3U] += tmp_imag;                          // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
   }
 
+  inline auto fft_log2(std::uint32_t num_points) -> std::uint32_t
+  {
+    auto log2_num_points = static_cast<std::uint32_t>(UINT8_C(0));
+
+    for( ; num_points > static_cast<std::uint32_t>(UINT8_C(1)); num_points >>= 1U) { ++log2_num_points; }
+
+    return log2_num_points;
+  }
+
+  inline auto fft_bit_reverse_bits(std::uint32_t index, const std::uint32_t bit_count) -> std::uint32_t
+  {
+    auto result = static_cast<std::uint32_t>(UINT8_C(0));
+
+    for(auto bit = static_cast<std::uint32_t>(UINT8_C(0)); bit < bit_count; ++bit)
+    {
+      result = static_cast<std::uint32_t>(result << 1U) | static_cast<std::uint32_t>(index & 1U);
+
+      index >>= 1U;
+    }
+
+    return result;
+  }
+
+  constexpr auto fft_bit_reverse_block_bits() -> std::uint32_t { return static_cast<std::uint32_t>(UINT8_C(4)); }
+
+  constexpr auto fft_bit_reverse_blocked_min_points() -> std::uint32_t { return static_cast<std::uint32_t>(UINT32_C(1) << 12U); }
+
+  inline auto fft_bit_reverse_blocked_mid_count(const std::uint32_t num_points) -> std::uint32_t
+  {
+    return static_cast<std::uint32_t>(num_points >> (fft_bit_reverse_block_bits() * 2U));
+  }
+
+  template<typename float_type>
+  auto fft_bit_reverse_blocked(const std::uint32_t num_points, float_type* data, const std::uint32_t mid_first, const std::uint32_t mid_last) -> void
+  {
+    // Permute num_points complex points to bit-reversed order.
+    // The point index is split into (hi, mid, lo), where hi and lo
+    // have block_bits bits each. The bit-reversed index is then
+    // (rev(lo), rev(mid), rev(hi)). For each pair of middle parts
+    // (mid, rev(mid)), the two blocks of (side * side) points
+    // are read into local buffers row by row and written back
+    // to each other's places row by row. This avoids the cache
+    // misses of swapping single points at scattered locations.
+    // Only the middle parts in the range [mid_first, mid_last)
+    // are handled, so that distinct ranges can be permuted
+    // independently of each other.
+
+    constexpr auto block_bits = fft_bit_reverse_block_bits();
+    constexpr auto side       = static_cast<std::uint32_t>(UINT32_C(1) << block_bits);
+
+    using buffer_type = std::array<float_type, static_cast<std::size_t>(side * side * 2U)>;
+
+    buffer_type buffer_mid     { };
+    buffer_type buffer_mid_rev { };
+
+    std::array<std::uint32_t, static_cast<std::size_t>(side)> rev_side { };
+
+    for(auto i = static_cast<std::uint32_t>(UINT8_C(0)); i < side; ++i)
+    {
+      rev_side[static_cast<std::size_t>(i)] = fft_bit_reverse_bits(i, block_bits);
+    }
+
+    const auto log2_num_points = fft_log2(num_points);
+    const auto mid_bits        = static_cast<std::uint32_t>(log2_num_points - (block_bits * 2U));
+    const auto hi_shift        = static_cast<std::uint32_t>(log2_num_points - block_bits);
+
+    const auto load =
+      [&data, &hi_shift](buffer_type& buffer, const std::uint32_t mid)
+      {
+        for(auto hi = static_cast<std::uint32_t>(UINT8_C(0)); hi < side; ++hi)
+        {
+          const float_type* src = data + (static_cast<std::uint32_t>(static_cast<std::uint32_t>(hi << hi_shift) | static_cast<std::uint32_t>(mid << block_bits)) * 2U); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          std::copy(src, src + (side * 2U), buffer.begin() + static_cast<std::ptrdiff_t>(hi * side * 2U)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+      };
+
+    const auto store =
+      [&data, &hi_shift, &rev_side](const buffer_type& buffer, const std::uint32_t mid_rev)
+      {
+        for(auto hi = static_cast<std::uint32_t>(UINT8_C(0)); hi < side; ++hi)
+        {
+          float_type* dst = data + (static_cast<std::uint32_t>(static_cast<std::uint32_t>(hi << hi_shift) | static_cast<std::uint32_t>(mid_rev << block_bits)) * 2U); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          for(auto lo = static_cast<std::uint32_t>(UINT8_C(0)); lo < side; ++lo)
+          {
+            const auto src_index = static_cast<std::size_t>(((rev_side[static_cast<std::size_t>(lo)] * side) + rev_side[static_cast<std::size_t>(hi)]) * 2U);
+
+            dst[(lo * 2U) + 0U] = buffer[src_index + 0U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            dst[(lo * 2U) + 1U] = buffer[src_index + 1U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          }
+        }
+      };
+
+    for(auto mid = mid_first; mid < mid_last; ++mid)
+    {
+      const auto mid_rev = fft_bit_reverse_bits(mid, mid_bits);
+
+      if(mid_rev >= mid)
+      {
+        load(buffer_mid, mid);
+
+        if(mid_rev != mid)
+        {
+          load(buffer_mid_rev, mid_rev);
+
+          store(buffer_mid_rev, mid);
+        }
+
+        store(buffer_mid, mid_rev);
+      }
+    }
+  }
+
   template<typename float_type,
            const bool IsForwardFft>
-  auto fft_lanczos_fft(std::uint32_t num_points, float_type* data) -> void
+  auto fft_radix4_pass(const std::uint32_t len, float_type* data, const std::uint32_t num_points, const float_type* tw, const std::uint32_t quarter_first, const std::uint32_t quarter_last) -> void
   {
-    auto j = static_cast<std::uint32_t>(UINT8_C(1));
-
-    for(auto i  = static_cast<std::uint32_t>(UINT8_C(1));
-             i  < static_cast<std::uint32_t>(num_points << 1U);
-             i += static_cast<std::uint32_t>(UINT8_C(2)))
+    // Combine the transforms of length (len / 4) in the quarters
+    // of each block of length len to transforms of length len.
+    // The array data holds num_points complex points, where
+    // num_points is a multiple of len. This uses three complex
+    // multiplications per butterfly, with the twiddle factors
+    // w_len^k and w_len^(2k) = w_(len/2)^k from the table tw
+    // and w_len^(3k) = w_len^k * w_len^(2k). Only the butterflies
+    // at the points [quarter_first, quarter_last) within each
+    // quarter are carried out.
+
+    const auto quarter = static_cast<std::uint32_t>(len / 4U);
+
+    const float_type* tw1 = tw + len;                 // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const float_type* tw2 = tw + (len / 2U);          // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    for(auto block = static_cast<std::uint32_t>(UINT8_C(0)); block < num_points; block += len)
     {
-      if(j > i)
+      float_type* x0 = data + (block * 2U);           // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      float_type* x1 = x0   + (quarter * 2U);         // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      float_type* x2 = x1   + (quarter * 2U);         // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      float_type* x3 = x2   + (quarter * 2U);         // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      for(auto k = static_cast<std::uint32_t>(quarter_first * 2U); k < (quarter_last * 2U); k += 2U)
       {
-        std::swap(data[j - 1U], data[i - 1U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        std::swap(data[j],      data[i]);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto w1r =                                        tw1[k + 0U];  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto w1i = twiddle_imag<float_type, IsForwardFft>(tw1[k + 1U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto w2r =                                        tw2[k + 0U];  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto w2i = twiddle_imag<float_type, IsForwardFft>(tw2[k + 1U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        const auto w3r = static_cast<float_type>((w1r * w2r) - (w1i * w2i));
+        const auto w3i = static_cast<float_type>((w1r * w2i) + (w1i * w2r));
+
+        const auto t1r = static_cast<float_type>((w2r * x1[k + 0U]) - (w2i * x1[k + 1U])); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto t1i = static_cast<float_type>((w2r * x1[k + 1U]) + (w2i * x1[k + 0U])); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto t2r = static_cast<float_type>((w1r * x2[k + 0U]) - (w1i * x2[k + 1U])); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto t2i = static_cast<float_type>((w1r * x2[k + 1U]) + (w1i * x2[k + 0U])); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto t3r = static_cast<float_type>((w3r * x3[k + 0U]) - (w3i * x3[k + 1U])); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto t3i = static_cast<float_type>((w3r * x3[k + 1U]) + (w3i * x3[k + 0U])); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        const auto s0r = static_cast<float_type>(x0[k + 0U] + t1r); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto s0i = static_cast<float_type>(x0[k + 1U] + t1i); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto d0r = static_cast<float_type>(x0[k + 0U] - t1r); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto d0i = static_cast<float_type>(x0[k + 1U] - t1i); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        const auto s1r = static_cast<float_type>(t2r + t3r);
+        const auto s1i = static_cast<float_type>(t2i + t3i);
+
+        // Multiply (t2 - t3) by w_len^(len/4), which is +i for
+        // the forward transform and -i for the inverse transform.
+        const auto d1r = twiddle_imag<float_type, IsForwardFft>(static_cast<float_type>(t3i - t2i));
+        const auto d1i = twiddle_imag<float_type, IsForwardFft>(static_cast<float_type>(t2r - t3r));
+
+        x0[k + 0U] = s0r + s1r; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        x0[k + 1U] = s0i + s1i; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        x1[k + 0U] = d0r + d1r; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        x1[k + 1U] = d0i + d1i; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        x2[k + 0U] = s0r - s1r; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        x2[k + 1U] = s0i - s1i; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        x3[k + 0U] = d0r - d1r; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        x3[k + 1U] = d0i - d1i; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
       }
+    }
+  }
+
+  template<typename float_type,
+           const bool IsForwardFft>
+  auto fft_radix4_pass_any(const std::uint32_t len, float_type* data, const std::uint32_t num_points, const float_type* tw, const std::uint32_t quarter_first, const std::uint32_t quarter_last) -> void
+  {
+    // Use the vectorized pass if supported (see fft_radix4_pass_simd).
+    if(!fft_radix4_pass_simd<float_type, IsForwardFft>(len, data, num_points, tw, quarter_first, quarter_last))
+    {
+      fft_radix4_pass<float_type, IsForwardFft>(len, data, num_points, tw, quarter_first, quarter_last);
+    }
+  }
+
+  template<typename float_type>
+  auto fft_radix2_pass(float_type* data, const std::uint32_t num_points) -> void
+  {
+    // Combine pairs of points to transforms of length 2.
+    for(auto i = static_cast<std::uint32_t>(UINT8_C(0)); i < (num_points * 2U); i += 4U)
+    {
+      const auto tmp_real = data[i + 2U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const auto tmp_imag = data[i + 3U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      data[i + 2U]  = data[i + 0U] - tmp_real; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      data[i + 3U]  = data[i + 1U] - tmp_imag; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      data[i + 0U] += tmp_real;                // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      data[i + 1U] += tmp_imag;                // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
+
+  constexpr auto fft_radix4_block_points() -> std::uint32_t { return static_cast<std::uint32_t>(UINT32_C(1) << 12U); }
+
+  inline auto fft_radix4_len_first(const std::uint32_t num_points) -> std::uint32_t
+  {
+    // If num_points is an odd power of two, the radix-4 passes
+    // are preceded by a radix-2 pass.
+    return
+      static_cast<std::uint32_t>
+      (
+        ((fft_log2(num_points) % 2U) != static_cast<std::uint32_t>(UINT8_C(0))) ? UINT8_C(8) : UINT8_C(4)
+      );
+  }
+
+  template<typename float_type,
+           const bool IsForwardFft>
+  auto fft_radix4_apply_block(const std::uint32_t len_first, const std::uint32_t block_points, float_type* data, const float_type* tw) -> void
+  {
+    // Carry out all passes from the length len_first
+    // up to the length block_points within one block
+    // of block_points complex points.
+    for(auto len = len_first; len <= block_points; len *= 4U)
+    {
+      fft_radix4_pass_any<float_type, IsForwardFft>(len, data, block_points, tw, static_cast<std::uint32_t>(UINT8_C(0)), static_cast<std::uint32_t>(len / 4U));
+    }
+  }
+
+  template<typename float_type,
+           const bool IsForwardFft>
+  auto fft_radix4_apply(std::uint32_t num_points, float_type* data, const float_type* tw) -> void
+  {
+    // Iterative, in-place radix-4 transform of num_points complex points
+    // in bit-reversed order. This is an alternative to the recursive
+    // danielson_lanczos_apply, which uses the same twiddle table.
+    // The passes are vectorized if supported (see fft_radix4_pass_simd).
+
+    const auto len_first = fft_radix4_len_first(num_points);
+
+    if(len_first != static_cast<std::uint32_t>(UINT8_C(4)))
+    {
+      fft_radix2_pass(data, num_points);
+    }
+
+    // For cache-friendly access, the passes of lengths up to the block
+    // size are carried out block by block, so that each block remains
+    // in the cache for these passes. The remaining passes run over the
+    // entire array, each of them combining two radix-2 stages.
+    const auto block_points = (std::min)(num_points, fft_radix4_block_points());
 
-      auto m = num_points;
+    for(auto block = static_cast<std::uint32_t>(UINT8_C(0)); block < num_points; block += block_points)
+    {
+      fft_radix4_apply_block<float_type, IsForwardFft>(len_first, block_points, data + (block * 2U), tw); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
 
-      while((m > static_cast<std::uint32_t>(UINT8_C(1))) && (j > m)) // NOLINT(altera-id-dependent-backward-branch)
+    for(auto len = len_first; len <= num_points; len *= 4U)
+    {
+      if(len > block_points)
       {
-        j  -= m;
-        m >>= 1U;
+        fft_radix4_pass_any<float_type, IsForwardFft>(len, data, num_points, tw, static_cast<std::uint32_t>(UINT8_C(0)), static_cast<std::uint32_t>(len / 4U));
       }
+    }
+  }
 
-      j += m;
+  template<typename float_type,
+           const bool IsForwardFft>
+  auto fft_lanczos_fft(std::uint32_t num_points, float_type* data, const float_type* tw) -> void
+  {
+    if(num_points >= fft_bit_reverse_blocked_min_points())
+    {
+      fft_bit_reverse_blocked(num_points, data, static_cast<std::uint32_t>(UINT8_C(0)), fft_bit_reverse_blocked_mid_count(num_points));
+    }
+    else
+    {
+      auto j = static_cast<std::uint32_t>(UINT8_C(1));
+
+      for(auto i  = static_cast<std::uint32_t>(UINT8_C(1));
+               i  < static_cast<std::uint32_t>(num_points << 1U);
+               i += static_cast<std::uint32_t>(UINT8_C(2)))
+      {
+        if(j > i)
+        {
+          std::swap(data[j - 1U], data[i - 1U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          std::swap(data[j],      data[i]);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+
+        auto m = num_points;
+
+        while((m > static_cast<std::uint32_t>(UINT8_C(1))) && (j > m)) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          j  -= m;
+          m >>= 1U;
+        }
+
+        j += m;
+      }
     }
 
-    danielson_lanczos_apply<float_type, IsForwardFft>(num_points, data);
+    #if !defined(WIDE_DECIMAL_DISABLE_FFT_RADIX4)
+    fft_radix4_apply<float_type, IsForwardFft>(num_points, data, tw);
+    #else
+    danielson_lanczos_apply<float_type, IsForwardFft>(num_points, data, tw);
+    #endif
   }
 
   template<typename float_type,
            const bool IsForwardFft>
-  auto rfft_lanczos_rfft(std::uint32_t num_points, float_type* data) -> typename std::enable_if<IsForwardFft, void>::type
+  auto rfft_lanczos_split(const std::uint32_t num_points, float_type* data, const float_type* tw, const std::uint32_t i_first, const std::uint32_t i_last) -> typename std::enable_if<IsForwardFft, void>::type
   {
-    fft_lanczos_fft<float_type, true>(num_points / 2U, data);
+    // Separate the complex transform of length (num_points / 2)
+    // into the real transform of length num_points, for the
+    // index pairs i in the range [i_first, i_last), where
+    // the full range is [1, num_points / 4).
 
-    auto real_part = static_cast<float_type>(static_cast<float_type>(1) + const_unique_wp_real<float_type, true>(num_points));
-    auto imag_part = static_cast<float_type>(                             const_unique_wp_imag<float_type, true>(num_points));
+    // The twiddle factors w_n^i of the real transform are located at tw + num_points.
+    const float_type* tw_real = tw + num_points; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-    for(auto   i = static_cast<std::uint32_t>(UINT8_C(1));
-               i < static_cast<std::uint32_t>(num_points >> 2U);
-             ++i)
+    for(auto i = i_first; i < i_last; ++i)
     {
       const auto i1 = static_cast<std::uint32_t>(i          + i);
       const auto i3 = static_cast<std::uint32_t>(num_points - i1);
@@ -285,41 +573,36 @@
       const auto i2 = static_cast<std::uint32_t>(1U + i1);
       const auto i4 = static_cast<std::uint32_t>(1U + i3);
 
-      {
-        const auto h1r = template_fast_div_by_two(data[i1] + data[i3]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        const auto h1i = template_fast_div_by_two(data[i2] - data[i4]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-
-        const auto h2r = template_fast_div_by_two(data[i2] + data[i4]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        const auto h2i = template_fast_div_by_two(data[i1] - data[i3]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const auto real_part = tw_real[i1]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const auto imag_part = tw_real[i2]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-        data[i1] = (+h1r + (real_part * h2r)) + (imag_part * h2i);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        data[i2] = (+h1i - (real_part * h2i)) + (imag_part * h2r);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        data[i3] = (+h1r - (real_part * h2r)) - (imag_part * h2i);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        data[i4] = (-h1i - (real_part * h2i)) + (imag_part * h2r);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      }
+      const auto h1r = template_fast_div_by_two(data[i1] + data[i3]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const auto h1i = template_fast_div_by_two(data[i2] - data[i4]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-      const auto tmp_real = real_part;
+      const auto h2r = template_fast_div_by_two(data[i2] + data[i4]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const auto h2i = template_fast_div_by_two(data[i1] - data[i3]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-      real_part += ((tmp_real  * const_unique_wp_real<float_type, true>(num_points)) - (imag_part * const_unique_wp_imag<float_type, true>(num_points)));
-      imag_part += ((imag_part * const_unique_wp_real<float_type, true>(num_points)) + (tmp_real  * const_unique_wp_imag<float_type, true>(num_points)));
+      data[i1] = (+h1r + (real_part * h2r)) + (imag_part * h2i);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      data[i2] = (+h1i - (real_part * h2i)) + (imag_part * h2r);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      data[i3] = (+h1r - (real_part * h2r)) - (imag_part * h2i);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      data[i4] = (-h1i - (real_part * h2i)) + (imag_part * h2r);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     }
-
-    const auto f0_tmp = data[0U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-
-    data[0U] = f0_tmp + data[1U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    data[1U] = f0_tmp - data[1U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
   }
 
   template<typename float_type,
            const bool IsForwardFft>
-  auto rfft_lanczos_rfft(std::uint32_t num_points, float_type* data) -> typename std::enable_if<(!IsForwardFft), void>::type
+  auto rfft_lanczos_split(const std::uint32_t num_points, float_type* data, const float_type* tw, const std::uint32_t i_first, const std::uint32_t i_last) -> typename std::enable_if<(!IsForwardFft), void>::type
   {
-    auto real_part = static_cast<float_type>(static_cast<float_type>(1) + const_unique_wp_real<float_type, false>(num_points));
-    auto imag_part = static_cast<float_type>(                             const_unique_wp_imag<float_type, false>(num_points));
+    // Combine the real input of length num_points for the inverse
+    // complex transform of length (num_points / 2), for the index
+    // pairs i in the range [i_first, i_last), where the full
+    // range is [1, num_points / 4).
+
+    // The twiddle factors w_n^i of the real transform are located at tw + num_points.
+    // The inverse transform uses their complex conjugates.
+    const float_type* tw_real = tw + num_points; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-    for(auto   i = static_cast<std::uint32_t>(UINT8_C(1));
-               i < static_cast<std::uint32_t>(num_points >> 2U);
-             ++i)
+    for(auto i = i_first; i < i_last; ++i)
     {
       const auto i1 = static_cast<std::uint32_t>(i          + i);
       const auto i3 = static_cast<std::uint32_t>(num_points - i1);
@@ -327,6 +610,9 @@
       const auto i2 = static_cast<std::uint32_t>(1U + i1);
       const auto i4 = static_cast<std::uint32_t>(1U + i3);
 
+      const auto real_part =  tw_real[i1]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const auto imag_part = -tw_real[i2]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
       const auto h1r = template_fast_div_by_two(data[i1] + data[i3]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
       const auto h1i = template_fast_div_by_two(data[i2] - data[i4]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
@@ -337,21 +623,128 @@
       data[i2] = (+h1i + (real_part * h2i)) - (imag_part * h2r);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
       data[i3] = (+h1r + (real_part * h2r)) + (imag_part * h2i);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
       data[i4] = (-h1i + (real_part * h2i)) - (imag_part * h2r);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
 
-      const auto tmp_real = real_part;
+  template<typename float_type,
+           const bool IsForwardFft>
+  auto rfft_lanczos_rfft(std::uint32_t num_points, float_type* data, const float_type* tw) -> typename std::enable_if<IsForwardFft, void>::type
+  {
+    // The twiddle table tw has (2 * num_points) elements
+    // (see fft_make_twiddles).
 
-      real_part += ((tmp_real  * const_unique_wp_real<float_type, false>(num_points)) - (imag_part * const_unique_wp_imag<float_type, false>(num_points)));
-      imag_part += ((imag_part * const_unique_wp_real<float_type, false>(num_points)) + (tmp_real  * const_unique_wp_imag<float_type, false>(num_points)));
-    }
+    fft_lanczos_fft<float_type, true>(num_points / 2U, data, tw);
+
+    rfft_lanczos_split<float_type, true>(num_points, data, tw, static_cast<std::uint32_t>(UINT8_C(1)), static_cast<std::uint32_t>(num_points >> 2U));
+
+    const auto f0_tmp = data[0U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    data[0U] = f0_tmp + data[1U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    data[1U] = f0_tmp - data[1U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
+  template<typename float_type,
+           const bool IsForwardFft>
+  auto rfft_lanczos_rfft(std::uint32_t num_points, float_type* data, const float_type* tw) -> typename std::enable_if<(!IsForwardFft), void>::type
+  {
+    rfft_lanczos_split<float_type, false>(num_points, data, tw, static_cast<std::uint32_t>(UINT8_C(1)), static_cast<std::uint32_t>(num_points >> 2U));
 
     const auto f0_tmp = data[0U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
     data[0U] = template_fast_div_by_two(f0_tmp + data[1U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     data[1U] = template_fast_div_by_two(f0_tmp - data[1U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-    fft_lanczos_fft<float_type, false>(num_points / 2U, data);
+    fft_lanczos_fft<float_type, false>(num_points / 2U, data, tw);
+  }
+
+  #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+  template<typename float_type>
+  class fft_plan
+  {
+  public:
+    // The FFT plan holds the twiddle table and the scratch buffers
+    // for FFT multiplication. Since the twiddle table of a transform
+    // contains the tables of all smaller transforms (see fft_make_twiddles),
+    // a plan prepared for a given size also serves all smaller sizes.
+    // The plan is only regenerated when a larger transform is needed.
+
+    fft_plan() = default;
+
+    fft_plan(const fft_plan&) = delete;
+    fft_plan(fft_plan&&) noexcept = default;
+
+    ~fft_plan() = default;
+
+    auto operator=(const fft_plan&) -> fft_plan& = delete;
+    auto operator=(fft_plan&&) noexcept -> fft_plan& = default;
+
+    auto prepare(const std::uint32_t num_points) -> void
+    {
+      if(num_points > my_size)
+      {
+        my_twiddles = storage_type(static_cast<typename storage_type::size_type>(num_points * 2U));
+        my_af       = storage_type(static_cast<typename storage_type::size_type>(num_points));
+        my_bf       = storage_type(static_cast<typename storage_type::size_type>(num_points));
+
+        fft_make_twiddles(num_points, my_twiddles.data());
+
+        my_size = num_points;
+      }
+    }
+
+    auto release() -> void
+    {
+      my_twiddles = storage_type();
+      my_af       = storage_type();
+      my_bf       = storage_type();
+
+      my_size = static_cast<std::uint32_t>(UINT8_C(0));
+    }
+
+    auto size() const noexcept -> std::uint32_t { return my_size; }
+
+    auto twiddles() const noexcept -> const float_type* { return my_twiddles.data(); }
+
+    auto af() noexcept -> float_type* { return my_af.data(); }
+    auto bf() noexcept -> float_type* { return my_bf.data(); }
+
+  private:
+    using storage_type = util::dynamic_array<float_type>;
+
+    std::uint32_t my_size     { };
+    storage_type  my_twiddles { };
+    storage_type  my_af       { };
+    storage_type  my_bf       { };
+  };
+
+  template<typename float_type>
+  auto fft_plan_cache_instance() -> fft_plan<float_type>&
+  {
+    // The plans are cached per float type and per thread,
+    // so that concurrent multiplications do not share scratch buffers.
+    static thread_local fft_plan<float_type> my_plan { };
+
+    return my_plan;
   }
 
+  template<typename float_type>
+  auto fft_plan_cache(const std::uint32_t num_points) -> fft_plan<float_type>&
+  {
+    auto& my_plan = fft_plan_cache_instance<float_type>();
+
+    my_plan.prepare(num_points);
+
+    return my_plan;
+  }
+
+  template<typename float_type>
+  auto fft_plan_cache_release() -> void
+  {
+    // Free the cached plan of the calling thread.
+    fft_plan_cache_instance<float_type>().release();
+  }
+  #endif
+
   #if(__cplusplus >= 201703L)
   } // namespace math::wide_decimal::detail::fft
   #else
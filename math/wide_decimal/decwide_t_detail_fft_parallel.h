@@ -0,0 +1,394 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright The wide-decimal contributors 2025.                //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+// This file implements the optional multithreaded FFT, which is
+// enabled by defining WIDE_DECIMAL_FFT_THREADS to the maximum number
+// of threads (including the calling thread) used for one transform.
+// The value 0 selects std::thread::hardware_concurrency(). The work
+// of each step of the transform is split into independent tasks
+// which are carried out by a bounded pool of persistent workers.
+// The pool is also used for the top levels of the Karatsuba
+// multiplication. Multithreading is not available if dynamic
+// memory allocation is disabled.
+
+#ifndef DECWIDE_T_DETAIL_FFT_PARALLEL_2025_02_10_H // NOLINT(llvm-header-guard)
+  #define DECWIDE_T_DETAIL_FFT_PARALLEL_2025_02_10_H
+
+  #if (defined(WIDE_DECIMAL_FFT_THREADS) && !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION))
+  #define WIDE_DECIMAL_MUL_PARALLEL // NOLINT(cppcoreguidelines-macro-usage)
+
+  #include <math/wide_decimal/decwide_t_detail_fft.h>
+
+  #include <algorithm>
+  #include <atomic>
+  #include <condition_variable>
+  #include <cstdint>
+  #include <mutex>
+  #include <thread>
+  #include <vector>
+
+  WIDE_DECIMAL_NAMESPACE_BEGIN
+
+  #if(__cplusplus >= 201703L)
+  namespace math::wide_decimal::detail::fft {
+  #else
+  namespace math { namespace wide_decimal { namespace detail { namespace fft { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  // The smallest number of real points for which the
+  // multiplication uses the multithreaded FFT.
+  constexpr auto fft_parallel_min_points() -> std::uint32_t { return static_cast<std::uint32_t>(UINT32_C(1) << 16U); }
+
+  class fft_thread_pool
+  {
+  public:
+    using task_function_type = void(*)(void*, std::uint32_t);
+
+    explicit fft_thread_pool(const std::uint32_t thread_count)
+    {
+      // The calling thread takes part in each job,
+      // so one worker less than thread_count is started.
+      for(auto i = static_cast<std::uint32_t>(UINT8_C(1)); i < thread_count; ++i)
+      {
+        my_workers.emplace_back([this]() { worker_loop(); });
+      }
+    }
+
+    fft_thread_pool() = delete;
+
+    fft_thread_pool(const fft_thread_pool&) = delete;
+    fft_thread_pool(fft_thread_pool&&) noexcept = delete;
+
+    ~fft_thread_pool()
+    {
+      {
+        const std::lock_guard<std::mutex> lock(my_mutex);
+
+        my_stop = true;
+      }
+
+      my_start_condition.notify_all();
+
+      for(auto& worker : my_workers)
+      {
+        worker.join();
+      }
+    }
+
+    auto operator=(const fft_thread_pool&) -> fft_thread_pool& = delete;
+    auto operator=(fft_thread_pool&&) noexcept -> fft_thread_pool& = delete;
+
+    auto thread_count() const -> std::uint32_t { return static_cast<std::uint32_t>(my_workers.size() + 1U); }
+
+    auto run(const std::uint32_t task_count, task_function_type task_function, void* task_context) -> void
+    {
+      // Carry out the tasks [0, task_count) with the calling thread
+      // and the workers. Only one job runs on the pool at a time.
+      // If the pool is busy with the job of another thread,
+      // the tasks are carried out by the calling thread alone.
+      // The task function must not call run() itself.
+
+      std::unique_lock<std::mutex> job_lock(my_job_mutex, std::try_to_lock);
+
+      if((!job_lock.owns_lock()) || my_workers.empty() || (task_count < static_cast<std::uint32_t>(UINT8_C(2))))
+      {
+        for(auto task = static_cast<std::uint32_t>(UINT8_C(0)); task < task_count; ++task)
+        {
+          task_function(task_context, task);
+        }
+
+        return;
+      }
+
+      {
+        const std::lock_guard<std::mutex> lock(my_mutex);
+
+        my_task_function = task_function;
+        my_task_context  = task_context;
+        my_task_count    = task_count;
+        my_task_pending  = static_cast<std::uint32_t>(my_workers.size());
+
+        my_task_next.store(static_cast<std::uint32_t>(UINT8_C(0)));
+
+        ++my_generation;
+      }
+
+      my_start_condition.notify_all();
+
+      work();
+
+      std::unique_lock<std::mutex> lock(my_mutex);
+
+      my_done_condition.wait(lock, [this]() { return (my_task_pending == static_cast<std::uint32_t>(UINT8_C(0))); });
+    }
+
+  private:
+    std::vector<std::thread>   my_workers         { };
+    std::mutex                 my_job_mutex       { };
+    std::mutex                 my_mutex           { };
+    std::condition_variable    my_start_condition { };
+    std::condition_variable    my_done_condition  { };
+    task_function_type         my_task_function   { nullptr };
+    void*                      my_task_context    { nullptr };
+    std::uint32_t              my_task_count      { };
+    std::uint32_t              my_task_pending    { };
+    std::atomic<std::uint32_t> my_task_next       { };
+    std::uint64_t              my_generation      { };
+    bool                       my_stop            { false };
+
+    auto work() -> void
+    {
+      for(;;)
+      {
+        const auto task = my_task_next.fetch_add(static_cast<std::uint32_t>(UINT8_C(1)));
+
+        if(task >= my_task_count)
+        {
+          break;
+        }
+
+        my_task_function(my_task_context, task);
+      }
+    }
+
+    auto worker_loop() -> void
+    {
+      auto generation_seen = static_cast<std::uint64_t>(UINT8_C(0));
+
+      for(;;)
+      {
+        {
+          std::unique_lock<std::mutex> lock(my_mutex);
+
+          my_start_condition.wait(lock, [this, &generation_seen]() { return (my_stop || (my_generation != generation_seen)); });
+
+          if(my_stop)
+          {
+            return;
+          }
+
+          generation_seen = my_generation;
+        }
+
+        work();
+
+        const std::lock_guard<std::mutex> lock(my_mutex);
+
+        --my_task_pending;
+
+        if(my_task_pending == static_cast<std::uint32_t>(UINT8_C(0)))
+        {
+          my_done_condition.notify_one();
+        }
+      }
+    }
+  };
+
+  inline auto fft_thread_pool_instance() -> fft_thread_pool&
+  {
+    static fft_thread_pool pool
+    {
+      ((static_cast<std::uint32_t>(WIDE_DECIMAL_FFT_THREADS) != static_cast<std::uint32_t>(UINT8_C(0)))
+        ? static_cast<std::uint32_t>(WIDE_DECIMAL_FFT_THREADS)
+        : (std::max)(static_cast<std::uint32_t>(std::thread::hardware_concurrency()), static_cast<std::uint32_t>(UINT8_C(1))))
+    };
+
+    return pool;
+  }
+
+  template<typename FunctionType>
+  auto fft_parallel_for(const std::uint32_t task_count, FunctionType& task_function) -> void
+  {
+    fft_thread_pool_instance().run
+    (
+      task_count,
+      [](void* task_context, std::uint32_t task) { (*static_cast<FunctionType*>(task_context))(task); },
+      &task_function
+    );
+  }
+
+  inline auto fft_parallel_chunk_count() -> std::uint32_t
+  {
+    // Split each step into a few more chunks than threads,
+    // so that the load is balanced among the threads.
+    return static_cast<std::uint32_t>(fft_thread_pool_instance().thread_count() * 4U);
+  }
+
+  inline auto fft_parallel_chunk_first(const std::uint32_t count, const std::uint32_t chunk_count, const std::uint32_t chunk) -> std::uint32_t
+  {
+    // The chunk boundaries of the range [0, count) are multiples of 8,
+    // so that the chunks consist of whole SIMD vectors of points.
+    return
+      ((chunk == chunk_count)
+        ? count
+        : static_cast<std::uint32_t>(static_cast<std::uint32_t>((static_cast<std::uint64_t>(count) * chunk) / chunk_count) & static_cast<std::uint32_t>(~UINT32_C(7))));
+  }
+
+  template<typename float_type,
+           const bool IsForwardFft>
+  auto fft_lanczos_fft_parallel(const std::uint32_t num_points, float_type* const* data, const std::uint32_t data_count, const float_type* tw) -> void
+  {
+    // Carry out the complex transforms of the data_count arrays in data
+    // with num_points complex points each, as in fft_lanczos_fft.
+    // The arrays are transformed concurrently, step by step,
+    // where num_points is at least fft_bit_reverse_blocked_min_points().
+
+    const auto chunk_count = fft_parallel_chunk_count();
+    const auto task_count  = static_cast<std::uint32_t>(data_count * chunk_count);
+
+    const auto mid_count = fft_bit_reverse_blocked_mid_count(num_points);
+
+    auto bit_reverse =
+      [&](const std::uint32_t task)
+      {
+        const auto chunk = static_cast<std::uint32_t>(task % chunk_count);
+
+        fft_bit_reverse_blocked(num_points,
+                                data[task / chunk_count], // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                                fft_parallel_chunk_first(mid_count, chunk_count, chunk),
+                                fft_parallel_chunk_first(mid_count, chunk_count, chunk + 1U));
+      };
+
+    fft_parallel_for(task_count, bit_reverse);
+
+    const auto len_first = fft_radix4_len_first(num_points);
+
+    if(len_first != static_cast<std::uint32_t>(UINT8_C(4)))
+    {
+      auto radix2 =
+        [&](const std::uint32_t task)
+        {
+          const auto chunk = static_cast<std::uint32_t>(task % chunk_count);
+          const auto first = fft_parallel_chunk_first(num_points, chunk_count, chunk);
+          const auto last  = fft_parallel_chunk_first(num_points, chunk_count, chunk + 1U);
+
+          fft_radix2_pass(data[task / chunk_count] + (first * 2U), static_cast<std::uint32_t>(last - first)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        };
+
+      fft_parallel_for(task_count, radix2);
+    }
+
+    // The passes up to the block size are carried out
+    // block by block, one task per block.
+    const auto block_points = (std::min)(num_points, fft_radix4_block_points());
+    const auto block_count  = static_cast<std::uint32_t>(num_points / block_points);
+
+    auto blocks =
+      [&](const std::uint32_t task)
+      {
+        const auto block = static_cast<std::uint32_t>(task % block_count);
+
+        fft_radix4_apply_block<float_type, IsForwardFft>(len_first, block_points, data[task / block_count] + (block * block_points * 2U), tw); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      };
+
+    fft_parallel_for(static_cast<std::uint32_t>(data_count * block_count), blocks);
+
+    // The remaining passes are split along the points of the quarters.
+    for(auto len = len_first; len <= num_points; len *= 4U)
+    {
+      if(len > block_points)
+      {
+        const auto quarter = static_cast<std::uint32_t>(len / 4U);
+
+        auto pass =
+          [&](const std::uint32_t task)
+          {
+            const auto chunk = static_cast<std::uint32_t>(task % chunk_count);
+
+            fft_radix4_pass_any<float_type, IsForwardFft>(len,
+                                                          data[task / chunk_count], // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                                                          num_points,
+                                                          tw,
+                                                          fft_parallel_chunk_first(quarter, chunk_count, chunk),
+                                                          fft_parallel_chunk_first(quarter, chunk_count, chunk + 1U));
+          };
+
+        fft_parallel_for(task_count, pass);
+      }
+    }
+  }
+
+  template<typename float_type,
+           const bool IsForwardFft>
+  auto rfft_lanczos_split_parallel(const std::uint32_t num_points, float_type* const* data, const std::uint32_t data_count, const float_type* tw) -> void
+  {
+    // Carry out rfft_lanczos_split for the data_count arrays in data.
+    const auto chunk_count = fft_parallel_chunk_count();
+
+    const auto split_count = static_cast<std::uint32_t>(num_points >> 2U);
+
+    auto split =
+      [&](const std::uint32_t task)
+      {
+        const auto chunk = static_cast<std::uint32_t>(task % chunk_count);
+
+        rfft_lanczos_split<float_type, IsForwardFft>(num_points,
+                                                     data[task / chunk_count], // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                                                     tw,
+                                                     (std::max)(fft_parallel_chunk_first(split_count, chunk_count, chunk), static_cast<std::uint32_t>(UINT8_C(1))),
+                                                     (std::max)(fft_parallel_chunk_first(split_count, chunk_count, chunk + 1U), static_cast<std::uint32_t>(UINT8_C(1))));
+      };
+
+    fft_parallel_for(static_cast<std::uint32_t>(data_count * chunk_count), split);
+  }
+
+  template<typename float_type,
+           const bool IsForwardFft>
+  auto rfft_lanczos_rfft_parallel(const std::uint32_t num_points, float_type* const* data, const std::uint32_t data_count, const float_type* tw) -> typename std::enable_if<IsForwardFft, void>::type
+  {
+    // Carry out the forward real transforms of the data_count arrays
+    // in data concurrently. The results are identical to those
+    // of rfft_lanczos_rfft.
+
+    fft_lanczos_fft_parallel<float_type, true>(num_points / 2U, data, data_count, tw);
+
+    rfft_lanczos_split_parallel<float_type, true>(num_points, data, data_count, tw);
+
+    for(auto i = static_cast<std::uint32_t>(UINT8_C(0)); i < data_count; ++i)
+    {
+      float_type* data_i = data[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      const auto f0_tmp = data_i[0U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      data_i[0U] = f0_tmp + data_i[1U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      data_i[1U] = f0_tmp - data_i[1U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
+
+  template<typename float_type,
+           const bool IsForwardFft>
+  auto rfft_lanczos_rfft_parallel(const std::uint32_t num_points, float_type* const* data, const std::uint32_t data_count, const float_type* tw) -> typename std::enable_if<(!IsForwardFft), void>::type
+  {
+    rfft_lanczos_split_parallel<float_type, false>(num_points, data, data_count, tw);
+
+    for(auto i = static_cast<std::uint32_t>(UINT8_C(0)); i < data_count; ++i)
+    {
+      float_type* data_i = data[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      const auto f0_tmp = data_i[0U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      data_i[0U] = template_fast_div_by_two(f0_tmp + data_i[1U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      data_i[1U] = template_fast_div_by_two(f0_tmp - data_i[1U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    fft_lanczos_fft_parallel<float_type, false>(num_points / 2U, data, data_count, tw);
+  }
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::wide_decimal::detail::fft
+  #else
+  } // namespace fft
+  } // namespace detail
+  } // namespace wide_decimal
+  } // namespace math
+  #endif
+
+  WIDE_DECIMAL_NAMESPACE_END
+
+  #endif // WIDE_DECIMAL_MUL_PARALLEL
+
+#endif // DECWIDE_T_DETAIL_FFT_PARALLEL_2025_02_10_H
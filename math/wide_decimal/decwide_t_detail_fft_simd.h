@@ -0,0 +1,378 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright The wide-decimal contributors 2025.                //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+// This file implements vectorized (AVX2/FMA and AVX-512F) radix-4
+// FFT passes for float and double. The instruction set is selected
+// at runtime based on the features of the CPU, so that a single binary
+// can be run on different x86-64 hosts. If no suitable instruction set
+// is available (or the compiler is not supported), the scalar radix-4
+// pass is used.
+
+#ifndef DECWIDE_T_DETAIL_FFT_SIMD_2025_02_03_H // NOLINT(llvm-header-guard)
+  #define DECWIDE_T_DETAIL_FFT_SIMD_2025_02_03_H
+
+  #include <math/wide_decimal/decwide_t_detail_namespace.h>
+
+  #if (!defined(WIDE_DECIMAL_DISABLE_FFT_SIMD) && (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__))
+  #define WIDE_DECIMAL_FFT_SIMD_X86_64 // NOLINT(cppcoreguidelines-macro-usage)
+  #include <immintrin.h>
+  #endif
+
+  #include <cstdint>
+  #include <type_traits>
+
+  WIDE_DECIMAL_NAMESPACE_BEGIN
+
+  #if(__cplusplus >= 201703L)
+  namespace math::wide_decimal::detail::fft {
+  #else
+  namespace math { namespace wide_decimal { namespace detail { namespace fft { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  enum class fft_simd_level_type
+  {
+    fft_simd_level_none,
+    fft_simd_level_avx2,
+    fft_simd_level_avx512
+  };
+
+  inline auto fft_simd_level_detect() -> fft_simd_level_type
+  {
+    #if defined(WIDE_DECIMAL_FFT_SIMD_X86_64)
+    __builtin_cpu_init();
+
+    if(__builtin_cpu_supports("avx512f") != 0)
+    {
+      return fft_simd_level_type::fft_simd_level_avx512;
+    }
+
+    if((__builtin_cpu_supports("avx2") != 0) && (__builtin_cpu_supports("fma") != 0))
+    {
+      return fft_simd_level_type::fft_simd_level_avx2;
+    }
+    #endif
+
+    return fft_simd_level_type::fft_simd_level_none;
+  }
+
+  inline auto fft_simd_level() -> fft_simd_level_type
+  {
+    // The CPU features are queried only once.
+    static const fft_simd_level_type my_level = fft_simd_level_detect();
+
+    return my_level;
+  }
+
+  #if defined(WIDE_DECIMAL_FFT_SIMD_X86_64)
+
+  // The vector operations work on interleaved complex data (real, imag, real, imag, ...).
+  // The member points is the number of complex points per vector.
+  // The complex multiplication cmul multiplies by the conjugate
+  // of the twiddle factor w when Conjugate is true.
+  // The function mul_i multiplies by +i when IsForwardFft
+  // is true, and by -i otherwise.
+
+  template<typename float_type>
+  struct fft_simd_avx2;
+
+  template<typename float_type>
+  struct fft_simd_avx512;
+
+  template<>
+  struct fft_simd_avx2<double>
+  {
+    using vector_type = __m256d;
+
+    static constexpr auto points = static_cast<std::uint32_t>(UINT8_C(2));
+
+    __attribute__((target("avx2,fma"), always_inline)) static inline auto load (const double* p) -> vector_type { return _mm256_loadu_pd(p); }
+    __attribute__((target("avx2,fma"), always_inline)) static inline auto store(double* p, vector_type x) -> void { _mm256_storeu_pd(p, x); }
+
+    __attribute__((target("avx2,fma"), always_inline)) static inline auto add(vector_type a, vector_type b) -> vector_type { return _mm256_add_pd(a, b); }
+    __attribute__((target("avx2,fma"), always_inline)) static inline auto sub(vector_type a, vector_type b) -> vector_type { return _mm256_sub_pd(a, b); }
+
+    template<const bool Conjugate>
+    __attribute__((target("avx2,fma"), always_inline)) static inline auto cmul(vector_type x, vector_type w) -> vector_type
+    {
+      const vector_type w_real = _mm256_movedup_pd(w);
+      const vector_type w_imag = _mm256_permute_pd(w, 0xF);                   // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      const vector_type x_swap = _mm256_mul_pd(_mm256_permute_pd(x, 0x5), w_imag); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+      return (Conjugate ? _mm256_fmsubadd_pd(x, w_real, x_swap) : _mm256_fmaddsub_pd(x, w_real, x_swap));
+    }
+
+    template<const bool IsForwardFft>
+    __attribute__((target("avx2,fma"), always_inline)) static inline auto mul_i(vector_type x) -> vector_type
+    {
+      const vector_type sign = (IsForwardFft ? _mm256_set_pd(0.0, -0.0, 0.0, -0.0) : _mm256_set_pd(-0.0, 0.0, -0.0, 0.0));
+
+      return _mm256_xor_pd(_mm256_permute_pd(x, 0x5), sign); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    }
+  };
+
+  template<>
+  struct fft_simd_avx2<float>
+  {
+    using vector_type = __m256;
+
+    static constexpr auto points = static_cast<std::uint32_t>(UINT8_C(4));
+
+    __attribute__((target("avx2,fma"), always_inline)) static inline auto load (const float* p) -> vector_type { return _mm256_loadu_ps(p); }
+    __attribute__((target("avx2,fma"), always_inline)) static inline auto store(float* p, vector_type x) -> void { _mm256_storeu_ps(p, x); }
+
+    __attribute__((target("avx2,fma"), always_inline)) static inline auto add(vector_type a, vector_type b) -> vector_type { return _mm256_add_ps(a, b); }
+    __attribute__((target("avx2,fma"), always_inline)) static inline auto sub(vector_type a, vector_type b) -> vector_type { return _mm256_sub_ps(a, b); }
+
+    template<const bool Conjugate>
+    __attribute__((target("avx2,fma"), always_inline)) static inline auto cmul(vector_type x, vector_type w) -> vector_type
+    {
+      const vector_type w_real = _mm256_moveldup_ps(w);
+      const vector_type w_imag = _mm256_movehdup_ps(w);
+      const vector_type x_swap = _mm256_mul_ps(_mm256_permute_ps(x, 0xB1), w_imag); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+      return (Conjugate ? _mm256_fmsubadd_ps(x, w_real, x_swap) : _mm256_fmaddsub_ps(x, w_real, x_swap));
+    }
+
+    template<const bool IsForwardFft>
+    __attribute__((target("avx2,fma"), always_inline)) static inline auto mul_i(vector_type x) -> vector_type
+    {
+      const vector_type sign = (IsForwardFft ? _mm256_set_ps(0.0F, -0.0F, 0.0F, -0.0F, 0.0F, -0.0F, 0.0F, -0.0F)
+                                             : _mm256_set_ps(-0.0F, 0.0F, -0.0F, 0.0F, -0.0F, 0.0F, -0.0F, 0.0F));
+
+      return _mm256_xor_ps(_mm256_permute_ps(x, 0xB1), sign); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    }
+  };
+
+  template<>
+  struct fft_simd_avx512<double>
+  {
+    using vector_type = __m512d;
+
+    static constexpr auto points = static_cast<std::uint32_t>(UINT8_C(4));
+
+    __attribute__((target("avx512f"), always_inline)) static inline auto load (const double* p) -> vector_type { return _mm512_loadu_pd(p); }
+    __attribute__((target("avx512f"), always_inline)) static inline auto store(double* p, vector_type x) -> void { _mm512_storeu_pd(p, x); }
+
+    __attribute__((target("avx512f"), always_inline)) static inline auto add(vector_type a, vector_type b) -> vector_type { return _mm512_add_pd(a, b); }
+    __attribute__((target("avx512f"), always_inline)) static inline auto sub(vector_type a, vector_type b) -> vector_type { return _mm512_sub_pd(a, b); }
+
+    template<const bool Conjugate>
+    __attribute__((target("avx512f"), always_inline)) static inline auto cmul(vector_type x, vector_type w) -> vector_type
+    {
+      // The masked forms (with all elements selected) are used,
+      // since some compilers warn about the undefined source
+      // operand of the unmasked forms.
+      const vector_type w_real = _mm512_mask_movedup_pd(w, static_cast<__mmask8>(0xFF), w);                                           // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      const vector_type w_imag = _mm512_mask_permute_pd(w, static_cast<__mmask8>(0xFF), w, 0xFF);                                     // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      const vector_type x_swap = _mm512_mul_pd(_mm512_mask_permute_pd(x, static_cast<__mmask8>(0xFF), x, 0x55), w_imag); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+      return (Conjugate ? _mm512_fmsubadd_pd(x, w_real, x_swap) : _mm512_fmaddsub_pd(x, w_real, x_swap));
+    }
+
+    template<const bool IsForwardFft>
+    __attribute__((target("avx512f"), always_inline)) static inline auto mul_i(vector_type x) -> vector_type
+    {
+      // Negate the real parts (forward) or the imaginary parts (inverse)
+      // of the swapped points by subtracting them from zero.
+      const vector_type x_swap = _mm512_mask_permute_pd(x, static_cast<__mmask8>(0xFF), x, 0x55); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+      return _mm512_mask_sub_pd(x_swap, static_cast<__mmask8>(IsForwardFft ? 0x55 : 0xAA), _mm512_setzero_pd(), x_swap); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    }
+  };
+
+  template<>
+  struct fft_simd_avx512<float>
+  {
+    using vector_type = __m512;
+
+    static constexpr auto points = static_cast<std::uint32_t>(UINT8_C(8));
+
+    __attribute__((target("avx512f"), always_inline)) static inline auto load (const float* p) -> vector_type { return _mm512_loadu_ps(p); }
+    __attribute__((target("avx512f"), always_inline)) static inline auto store(float* p, vector_type x) -> void { _mm512_storeu_ps(p, x); }
+
+    __attribute__((target("avx512f"), always_inline)) static inline auto add(vector_type a, vector_type b) -> vector_type { return _mm512_add_ps(a, b); }
+    __attribute__((target("avx512f"), always_inline)) static inline auto sub(vector_type a, vector_type b) -> vector_type { return _mm512_sub_ps(a, b); }
+
+    template<const bool Conjugate>
+    __attribute__((target("avx512f"), always_inline)) static inline auto cmul(vector_type x, vector_type w) -> vector_type
+    {
+      const vector_type w_real = _mm512_mask_moveldup_ps(w, static_cast<__mmask16>(0xFFFF), w);                                            // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      const vector_type w_imag = _mm512_mask_movehdup_ps(w, static_cast<__mmask16>(0xFFFF), w);                                            // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      const vector_type x_swap = _mm512_mul_ps(_mm512_mask_permute_ps(x, static_cast<__mmask16>(0xFFFF), x, 0xB1), w_imag); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+      return (Conjugate ? _mm512_fmsubadd_ps(x, w_real, x_swap) : _mm512_fmaddsub_ps(x, w_real, x_swap));
+    }
+
+    template<const bool IsForwardFft>
+    __attribute__((target("avx512f"), always_inline)) static inline auto mul_i(vector_type x) -> vector_type
+    {
+      const vector_type x_swap = _mm512_mask_permute_ps(x, static_cast<__mmask16>(0xFFFF), x, 0xB1); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+      return _mm512_mask_sub_ps(x_swap, static_cast<__mmask16>(IsForwardFft ? 0x5555 : 0xAAAA), _mm512_setzero_ps(), x_swap); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    }
+  };
+
+  // The vectorized passes follow fft_radix4_pass, see there.
+  // The two passes are identical except for the instruction set
+  // for which they are compiled.
+
+  template<typename float_type,
+           const bool IsForwardFft>
+  __attribute__((target("avx2,fma")))
+  auto fft_radix4_pass_avx2(const std::uint32_t len, float_type* data, const std::uint32_t num_points, const float_type* tw, const std::uint32_t quarter_first, const std::uint32_t quarter_last) -> void
+  {
+    using simd_type   = fft_simd_avx2<float_type>;
+    using vector_type = typename simd_type::vector_type;
+
+    const auto quarter = static_cast<std::uint32_t>(len / 4U);
+
+    const float_type* tw1 = tw + len;                 // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const float_type* tw2 = tw + (len / 2U);          // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    for(auto block = static_cast<std::uint32_t>(UINT8_C(0)); block < num_points; block += len)
+    {
+      float_type* x0 = data + (block * 2U);           // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      float_type* x1 = x0   + (quarter * 2U);         // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      float_type* x2 = x1   + (quarter * 2U);         // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      float_type* x3 = x2   + (quarter * 2U);         // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      for(auto k = static_cast<std::uint32_t>(quarter_first * 2U); k < (quarter_last * 2U); k += (simd_type::points * 2U))
+      {
+        const vector_type w1 = simd_type::load(tw1 + k); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const vector_type w2 = simd_type::load(tw2 + k); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const vector_type w3 = simd_type::template cmul<false>(w1, w2);
+
+        const vector_type a0 = simd_type::load(x0 + k);                                        // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const vector_type t1 = simd_type::template cmul<(!IsForwardFft)>(simd_type::load(x1 + k), w2); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const vector_type t2 = simd_type::template cmul<(!IsForwardFft)>(simd_type::load(x2 + k), w1); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const vector_type t3 = simd_type::template cmul<(!IsForwardFft)>(simd_type::load(x3 + k), w3); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        const vector_type s0 = simd_type::add(a0, t1);
+        const vector_type d0 = simd_type::sub(a0, t1);
+        const vector_type s1 = simd_type::add(t2, t3);
+        const vector_type d1 = simd_type::template mul_i<IsForwardFft>(simd_type::sub(t2, t3));
+
+        simd_type::store(x0 + k, simd_type::add(s0, s1)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        simd_type::store(x1 + k, simd_type::add(d0, d1)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        simd_type::store(x2 + k, simd_type::sub(s0, s1)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        simd_type::store(x3 + k, simd_type::sub(d0, d1)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
+  }
+
+  template<typename float_type,
+           const bool IsForwardFft>
+  __attribute__((target("avx512f")))
+  auto fft_radix4_pass_avx512(const std::uint32_t len, float_type* data, const std::uint32_t num_points, const float_type* tw, const std::uint32_t quarter_first, const std::uint32_t quarter_last) -> void
+  {
+    using simd_type   = fft_simd_avx512<float_type>;
+    using vector_type = typename simd_type::vector_type;
+
+    const auto quarter = static_cast<std::uint32_t>(len / 4U);
+
+    const float_type* tw1 = tw + len;                 // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const float_type* tw2 = tw + (len / 2U);          // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    for(auto block = static_cast<std::uint32_t>(UINT8_C(0)); block < num_points; block += len)
+    {
+      float_type* x0 = data + (block * 2U);           // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      float_type* x1 = x0   + (quarter * 2U);         // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      float_type* x2 = x1   + (quarter * 2U);         // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      float_type* x3 = x2   + (quarter * 2U);         // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      for(auto k = static_cast<std::uint32_t>(quarter_first * 2U); k < (quarter_last * 2U); k += (simd_type::points * 2U))
+      {
+        const vector_type w1 = simd_type::load(tw1 + k); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const vector_type w2 = simd_type::load(tw2 + k); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const vector_type w3 = simd_type::template cmul<false>(w1, w2);
+
+        const vector_type a0 = simd_type::load(x0 + k);                                        // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const vector_type t1 = simd_type::template cmul<(!IsForwardFft)>(simd_type::load(x1 + k), w2); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const vector_type t2 = simd_type::template cmul<(!IsForwardFft)>(simd_type::load(x2 + k), w1); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const vector_type t3 = simd_type::template cmul<(!IsForwardFft)>(simd_type::load(x3 + k), w3); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        const vector_type s0 = simd_type::add(a0, t1);
+        const vector_type d0 = simd_type::sub(a0, t1);
+        const vector_type s1 = simd_type::add(t2, t3);
+        const vector_type d1 = simd_type::template mul_i<IsForwardFft>(simd_type::sub(t2, t3));
+
+        simd_type::store(x0 + k, simd_type::add(s0, s1)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        simd_type::store(x1 + k, simd_type::add(d0, d1)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        simd_type::store(x2 + k, simd_type::sub(s0, s1)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        simd_type::store(x3 + k, simd_type::sub(d0, d1)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
+  }
+
+  #endif // WIDE_DECIMAL_FFT_SIMD_X86_64
+
+  template<typename float_type,
+           const bool IsForwardFft>
+  auto fft_radix4_pass_simd(const std::uint32_t len, float_type* data, const std::uint32_t num_points, const float_type* tw, const std::uint32_t quarter_first, const std::uint32_t quarter_last) -> typename std::enable_if<(!(std::is_same<float_type, float>::value || std::is_same<float_type, double>::value)), bool>::type
+  {
+    // There are no vectorized passes for this float type.
+    static_cast<void>(len);
+    static_cast<void>(data);
+    static_cast<void>(num_points);
+    static_cast<void>(tw);
+    static_cast<void>(quarter_first);
+    static_cast<void>(quarter_last);
+
+    return false;
+  }
+
+  template<typename float_type,
+           const bool IsForwardFft>
+  auto fft_radix4_pass_simd(const std::uint32_t len, float_type* data, const std::uint32_t num_points, const float_type* tw, const std::uint32_t quarter_first, const std::uint32_t quarter_last) -> typename std::enable_if<(std::is_same<float_type, float>::value || std::is_same<float_type, double>::value), bool>::type
+  {
+    // Carry out the radix-4 pass of length len with the widest
+    // instruction set supported by the CPU. The vectorized passes
+    // need whole vectors of points in the range of the quarter.
+    // Return false if the pass has not been carried out.
+
+    #if defined(WIDE_DECIMAL_FFT_SIMD_X86_64)
+    const auto count = static_cast<std::uint32_t>(quarter_last - quarter_first);
+
+    const auto level = fft_simd_level();
+
+    if((level == fft_simd_level_type::fft_simd_level_avx512) && ((count % fft_simd_avx512<float_type>::points) == static_cast<std::uint32_t>(UINT8_C(0))))
+    {
+      fft_radix4_pass_avx512<float_type, IsForwardFft>(len, data, num_points, tw, quarter_first, quarter_last);
+
+      return true;
+    }
+
+    if((level != fft_simd_level_type::fft_simd_level_none) && ((count % fft_simd_avx2<float_type>::points) == static_cast<std::uint32_t>(UINT8_C(0))))
+    {
+      fft_radix4_pass_avx2<float_type, IsForwardFft>(len, data, num_points, tw, quarter_first, quarter_last);
+
+      return true;
+    }
+    #else
+    static_cast<void>(len);
+    static_cast<void>(data);
+    static_cast<void>(num_points);
+    static_cast<void>(tw);
+    static_cast<void>(quarter_first);
+    static_cast<void>(quarter_last);
+    #endif
+
+    return false;
+  }
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::wide_decimal::detail::fft
+  #else
+  } // namespace fft
+  } // namespace detail
+  } // namespace wide_decimal
+  } // namespace math
+  #endif
+
+  WIDE_DECIMAL_NAMESPACE_END
+
+#endif // DECWIDE_T_DETAIL_FFT_SIMD_2025_02_03_H
@@ -0,0 +1,383 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright The wide-decimal contributors 2025.                //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+// This file implements a number-theoretic transform (NTT)
+// used for exact large-digit multiplication in decwide_t.
+// The convolution is computed modulo three NTT-friendly primes
+// and subsequently reconstructed with the Chinese remainder theorem.
+
+#ifndef DECWIDE_T_DETAIL_NTT_2025_01_20_H // NOLINT(llvm-header-guard)
+  #define DECWIDE_T_DETAIL_NTT_2025_01_20_H
+
+  #include <math/wide_decimal/decwide_t_detail_namespace.h>
+  #include <util/utility/util_dynamic_array.h>
+
+  #include <algorithm>
+  #include <cstdint>
+
+  WIDE_DECIMAL_NAMESPACE_BEGIN
+
+  #if(__cplusplus >= 201703L)
+  namespace math::wide_decimal::detail::ntt {
+  #else
+  namespace math { namespace wide_decimal { namespace detail { namespace ntt { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  template<const std::uint32_t Modulus,
+           const std::uint32_t PrimitiveRoot>
+  struct ntt_prime
+  {
+    // Arithmetic modulo a prime p < 2^31 using Montgomery multiplication
+    // with R = 2^32. Values are kept in the range [0, p).
+
+    static constexpr std::uint32_t modulus        = Modulus;
+    static constexpr std::uint32_t primitive_root = PrimitiveRoot;
+
+    static_assert(modulus < static_cast<std::uint32_t>(UINT32_C(0x80000000)),
+                  "Error: The NTT modulus must be less than 2^31");
+
+    // Compute -1/p mod 2^32 with Newton iteration.
+    static constexpr auto mont_inv_step(const std::uint32_t x) noexcept -> std::uint32_t
+    {
+      return static_cast<std::uint32_t>(x * static_cast<std::uint32_t>(static_cast<std::uint32_t>(UINT8_C(2)) - static_cast<std::uint32_t>(modulus * x)));
+    }
+
+    static constexpr std::uint32_t mont_inv = static_cast<std::uint32_t>(static_cast<std::uint32_t>(UINT8_C(0)) - mont_inv_step(mont_inv_step(mont_inv_step(mont_inv_step(mont_inv_step(modulus))))));
+
+    // Compute R^2 mod p = 2^64 mod p.
+    static constexpr std::uint32_t mont_r2 = static_cast<std::uint32_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>((UINT64_MAX % modulus) + static_cast<std::uint64_t>(UINT8_C(1))) % modulus));
+
+    static auto reduce(const std::uint64_t t) noexcept -> std::uint32_t
+    {
+      const auto m = static_cast<std::uint32_t>(static_cast<std::uint32_t>(t) * mont_inv);
+
+      const auto u = static_cast<std::uint32_t>(static_cast<std::uint64_t>(t + static_cast<std::uint64_t>(static_cast<std::uint64_t>(m) * modulus)) >> 32U);
+
+      return ((u >= modulus) ? static_cast<std::uint32_t>(u - modulus) : u);
+    }
+
+    static auto mul(const std::uint32_t a, const std::uint32_t b) noexcept -> std::uint32_t
+    {
+      return reduce(static_cast<std::uint64_t>(static_cast<std::uint64_t>(a) * b));
+    }
+
+    static auto add(const std::uint32_t a, const std::uint32_t b) noexcept -> std::uint32_t
+    {
+      const auto s = static_cast<std::uint32_t>(a + b);
+
+      return ((s >= modulus) ? static_cast<std::uint32_t>(s - modulus) : s);
+    }
+
+    static auto sub(const std::uint32_t a, const std::uint32_t b) noexcept -> std::uint32_t
+    {
+      return ((a >= b) ? static_cast<std::uint32_t>(a - b) : static_cast<std::uint32_t>(static_cast<std::uint32_t>(a + modulus) - b));
+    }
+
+    static auto to_mont(const std::uint32_t a) noexcept -> std::uint32_t
+    {
+      return mul(a, mont_r2);
+    }
+
+    static auto pow_mont(std::uint32_t b_mont, std::uint32_t p) noexcept -> std::uint32_t
+    {
+      // Compute b^p, where both b and the result are in Montgomery form.
+      auto result = to_mont(static_cast<std::uint32_t>(UINT8_C(1)));
+
+      while(p != static_cast<std::uint32_t>(UINT8_C(0)))
+      {
+        if(static_cast<std::uint32_t>(p & static_cast<std::uint32_t>(UINT8_C(1))) != static_cast<std::uint32_t>(UINT8_C(0)))
+        {
+          result = mul(result, b_mont);
+        }
+
+        b_mont = mul(b_mont, b_mont);
+
+        p >>= 1U;
+      }
+
+      return result;
+    }
+  };
+
+  template<const std::uint32_t Modulus, const std::uint32_t PrimitiveRoot> constexpr std::uint32_t ntt_prime<Modulus, PrimitiveRoot>::modulus;        // NOLINT(readability-redundant-declaration)
+  template<const std::uint32_t Modulus, const std::uint32_t PrimitiveRoot> constexpr std::uint32_t ntt_prime<Modulus, PrimitiveRoot>::primitive_root; // NOLINT(readability-redundant-declaration)
+  template<const std::uint32_t Modulus, const std::uint32_t PrimitiveRoot> constexpr std::uint32_t ntt_prime<Modulus, PrimitiveRoot>::mont_inv;       // NOLINT(readability-redundant-declaration)
+  template<const std::uint32_t Modulus, const std::uint32_t PrimitiveRoot> constexpr std::uint32_t ntt_prime<Modulus, PrimitiveRoot>::mont_r2;        // NOLINT(readability-redundant-declaration)
+
+  // The three primes have the form k * 2^m + 1 with m >= 24.
+  // So transform lengths up to 2^24 are supported. The product
+  // of the primes (about 7.1E26) bounds the convolution terms
+  // that can be reconstructed exactly.
+  using ntt_prime_0 = ntt_prime<static_cast<std::uint32_t>(UINT32_C(2013265921)), static_cast<std::uint32_t>(UINT8_C(31))>; // 15 * 2^27 + 1
+  using ntt_prime_1 = ntt_prime<static_cast<std::uint32_t>(UINT32_C( 469762049)), static_cast<std::uint32_t>(UINT8_C( 3))>; //  7 * 2^26 + 1
+  using ntt_prime_2 = ntt_prime<static_cast<std::uint32_t>(UINT32_C( 754974721)), static_cast<std::uint32_t>(UINT8_C(11))>; // 45 * 2^24 + 1
+
+  constexpr auto ntt_max_length() noexcept -> std::uint32_t { return static_cast<std::uint32_t>(UINT32_C(1) << 24U); }
+
+  constexpr auto ntt_length_as_constexpr(const std::uint32_t prec_elems, const std::uint32_t n = static_cast<std::uint32_t>(UINT8_C(8))) noexcept -> std::uint32_t // NOLINT(misc-no-recursion)
+  {
+    // Obtain the smallest power of two (at least 8) that contains the (2 * prec)
+    // limbs of the multiplication result, limited to the maximum NTT length.
+    return (((n / 2U) >= prec_elems) || (n >= ntt_max_length())) ? n : ntt_length_as_constexpr(prec_elems, static_cast<std::uint32_t>(n * 2U));
+  }
+
+  template<typename PrimeType>
+  auto ntt_make_twiddles(const std::uint32_t n, std::uint32_t* tw) -> void
+  {
+    // Store the twiddle factors of all stages contiguously (in Montgomery form).
+    // For each stage with half-length h, the powers w_{2h}^j for j = 0...h-1
+    // are located at tw[h + j]. Only the largest stage is computed with
+    // multiplications. The smaller stages use every second power.
+    const auto half_n = static_cast<std::uint32_t>(n / 2U);
+
+    const auto w =
+      PrimeType::pow_mont(PrimeType::to_mont(PrimeType::primitive_root),
+                          static_cast<std::uint32_t>(static_cast<std::uint32_t>(PrimeType::modulus - 1U) / n));
+
+    tw[half_n] = PrimeType::to_mont(static_cast<std::uint32_t>(UINT8_C(1))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    for(auto j = static_cast<std::uint32_t>(UINT8_C(1)); j < half_n; ++j)
+    {
+      tw[half_n + j] = PrimeType::mul(tw[(half_n + j) - 1U], w); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    for(auto h = static_cast<std::uint32_t>(half_n / 2U); h != static_cast<std::uint32_t>(UINT8_C(0)); h /= 2U)
+    {
+      for(auto j = static_cast<std::uint32_t>(UINT8_C(0)); j < h; ++j)
+      {
+        tw[h + j] = tw[(2U * h) + (2U * j)]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
+  }
+
+  #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+  template<typename PrimeType>
+  class ntt_plan
+  {
+  public:
+    // The NTT plan holds the twiddle table of one prime. The entries
+    // tw[h + j] do not depend on the transform length (see ntt_make_twiddles),
+    // so a table prepared for a given length also serves all smaller lengths.
+    // The table is only regenerated when a longer transform is needed.
+
+    ntt_plan() = default;
+
+    ntt_plan(const ntt_plan&) = delete;
+    ntt_plan(ntt_plan&&) noexcept = default;
+
+    ~ntt_plan() = default;
+
+    auto operator=(const ntt_plan&) -> ntt_plan& = delete;
+    auto operator=(ntt_plan&&) noexcept -> ntt_plan& = default;
+
+    auto prepare(const std::uint32_t n) -> void
+    {
+      if(n > my_size)
+      {
+        my_twiddles = storage_type(static_cast<typename storage_type::size_type>(n));
+
+        ntt_make_twiddles<PrimeType>(n, my_twiddles.data());
+
+        my_size = n;
+      }
+    }
+
+    auto release() -> void
+    {
+      my_twiddles = storage_type();
+
+      my_size = static_cast<std::uint32_t>(UINT8_C(0));
+    }
+
+    auto size() const noexcept -> std::uint32_t { return my_size; }
+
+    auto twiddles() const noexcept -> const std::uint32_t* { return my_twiddles.data(); }
+
+  private:
+    using storage_type = util::dynamic_array<std::uint32_t>;
+
+    std::uint32_t my_size     { };
+    storage_type  my_twiddles { };
+  };
+
+  template<typename PrimeType>
+  auto ntt_plan_cache_instance() -> ntt_plan<PrimeType>&
+  {
+    // The plans are cached per prime and per thread, as the FFT plans.
+    static thread_local ntt_plan<PrimeType> my_plan { };
+
+    return my_plan;
+  }
+
+  template<typename PrimeType>
+  auto ntt_plan_cache(const std::uint32_t n) -> const ntt_plan<PrimeType>&
+  {
+    auto& my_plan = ntt_plan_cache_instance<PrimeType>();
+
+    my_plan.prepare(n);
+
+    return my_plan;
+  }
+
+  template<typename PrimeType>
+  auto ntt_plan_cache_release() -> void
+  {
+    // Free the cached plan of the calling thread.
+    ntt_plan_cache_instance<PrimeType>().release();
+  }
+  #endif
+
+  template<typename PrimeType>
+  auto ntt_forward(const std::uint32_t n, std::uint32_t* a, const std::uint32_t* tw) -> void
+  {
+    // Decimation-in-frequency (Gentleman-Sande) transform.
+    // The input is in natural order, the output is in bit-reversed order.
+    for(auto h = static_cast<std::uint32_t>(n / 2U); h != static_cast<std::uint32_t>(UINT8_C(0)); h /= 2U)
+    {
+      for(auto s = static_cast<std::uint32_t>(UINT8_C(0)); s < n; s += static_cast<std::uint32_t>(2U * h))
+      {
+        for(auto j = static_cast<std::uint32_t>(UINT8_C(0)); j < h; ++j)
+        {
+          const auto x = a[s + j];     // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          const auto y = a[s + j + h]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          a[s + j]     = PrimeType::add(x, y);                         // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          a[s + j + h] = PrimeType::mul(PrimeType::sub(x, y), tw[h + j]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+      }
+    }
+  }
+
+  template<typename PrimeType>
+  auto ntt_inverse(const std::uint32_t n, std::uint32_t* a, const std::uint32_t* tw) -> void
+  {
+    // Decimation-in-time (Cooley-Tukey) transform with inverse roots.
+    // The input is in bit-reversed order, the output is in natural order.
+    // The result is not scaled by 1/n. The inverse roots are obtained
+    // from w^(-j) = -w^(h - j), using w^h = -1 for j = 1...h-1.
+    for(auto h = static_cast<std::uint32_t>(UINT8_C(1)); h < n; h *= 2U)
+    {
+      for(auto s = static_cast<std::uint32_t>(UINT8_C(0)); s < n; s += static_cast<std::uint32_t>(2U * h))
+      {
+        {
+          const auto x = a[s];     // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          const auto y = a[s + h]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          a[s]     = PrimeType::add(x, y); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          a[s + h] = PrimeType::sub(x, y); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+
+        for(auto j = static_cast<std::uint32_t>(UINT8_C(1)); j < h; ++j)
+        {
+          const auto x = a[s + j];                                                // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          const auto y = PrimeType::mul(a[s + j + h], tw[h + (h - j)]);            // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          a[s + j]     = PrimeType::sub(x, y); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          a[s + j + h] = PrimeType::add(x, y); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+      }
+    }
+  }
+
+  template<const std::uint32_t PointsPerLimb,
+           typename InputLimbIteratorType>
+  auto ntt_load(      std::uint32_t*        a,
+                      InputLimbIteratorType u,
+                const std::uint32_t         point_count,
+                const std::uint32_t         point_mask,
+                const std::uint32_t         n) -> void
+  {
+    // Load the point_count points of the limbs of u into a and set
+    // the remaining elements of a to zero. Each limb is used directly
+    // as one point, or it is split into its high and low halves
+    // (of point_mask each) for two points per limb.
+    static_assert((PointsPerLimb == 1U) || (PointsPerLimb == 2U),
+                  "Error: Each limb must be split into one or two NTT points");
+
+    for(auto i = static_cast<std::uint32_t>(UINT8_C(0)); i < point_count; ++i)
+    {
+      a[i] = // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        static_cast<std::uint32_t>
+        (
+          (PointsPerLimb == 1U)
+            ? static_cast<std::uint32_t>(u[i])
+            : (((i % 2U) == 0U) ? static_cast<std::uint32_t>(u[i / 2U] / point_mask)  // NOLINT(bugprone-integer-division)
+                                : static_cast<std::uint32_t>(u[i / 2U] % point_mask))
+        );
+    }
+
+    std::fill(a + point_count, a + n, static_cast<std::uint32_t>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
+  template<typename PrimeType,
+           const std::uint32_t PointsPerLimb,
+           typename InputLimbIteratorType>
+  auto ntt_convolve(      std::uint32_t*        a,
+                          std::uint32_t*        b,
+                    const std::uint32_t*        tw,
+                          InputLimbIteratorType u,
+                          InputLimbIteratorType v,
+                    const std::uint32_t         point_count,
+                    const std::uint32_t         point_mask,
+                    const std::uint32_t         n) -> void
+  {
+    // Compute the cyclic convolution of u and v (each having point_count
+    // points, see ntt_load) modulo the prime and store it in a. The points
+    // are used directly as residues, since they are all less than the prime.
+    // For squaring (u == v), b is not used and only one forward
+    // transform is needed. The twiddle table tw of this prime must have
+    // been made for (at least) the length n with ntt_make_twiddles.
+    const auto is_square = (u == v);
+
+    ntt_load<PointsPerLimb>(a, u, point_count, point_mask, n);
+
+    if(!is_square)
+    {
+      ntt_load<PointsPerLimb>(b, v, point_count, point_mask, n);
+    }
+
+    ntt_forward<PrimeType>(n, a, tw);
+
+    if(!is_square)
+    {
+      ntt_forward<PrimeType>(n, b, tw);
+    }
+
+    const std::uint32_t* pb = (is_square ? a : b);
+
+    // The pointwise products carry a factor of 1/R from Montgomery
+    // multiplication. This is compensated in the final scaling,
+    // which multiplies by (R^2 / n) in Montgomery form.
+    for(auto i = static_cast<std::uint32_t>(UINT8_C(0)); i < n; ++i)
+    {
+      a[i] = PrimeType::mul(a[i], pb[i]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    ntt_inverse<PrimeType>(n, a, tw);
+
+    const auto n_mont     = PrimeType::to_mont(n);
+    const auto n_inv_mont = PrimeType::pow_mont(n_mont, static_cast<std::uint32_t>(PrimeType::modulus - 2U));
+    const auto scale      = PrimeType::to_mont(n_inv_mont);
+
+    for(auto i = static_cast<std::uint32_t>(UINT8_C(0)); i < n; ++i)
+    {
+      a[i] = PrimeType::mul(a[i], scale); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::wide_decimal::detail::ntt
+  #else
+  } // namespace ntt
+  } // namespace detail
+  } // namespace wide_decimal
+  } // namespace math
+  #endif
+
+  WIDE_DECIMAL_NAMESPACE_END
+
+#endif // DECWIDE_T_DETAIL_NTT_2025_01_20_H
@@ -11,17 +11,23 @@
 
 // This file implements low-level decwide_t algorithms such as
 // the operations for comparison, addition, subtraction, multiplication
-// (including Karatsuba and FFT loops), and division (but only
-// division by 1 limb).
+// (including Karatsuba, Toom-Cook 3-way, FFT and NTT loops), and division
+// (by 1 limb and long division by n limbs).
 
 #ifndef DECWIDE_T_DETAIL_OPS_2021_04_12_H // NOLINT(llvm-header-guard)
   #define DECWIDE_T_DETAIL_OPS_2021_04_12_H
 
   #include <math/wide_decimal/decwide_t_detail.h>
   #include <math/wide_decimal/decwide_t_detail_fft.h>
+  #include <math/wide_decimal/decwide_t_detail_fft_parallel.h>
+  #include <math/wide_decimal/decwide_t_detail_ntt.h>
 
+  #include <algorithm>
+  #include <array>
+  #include <cmath>
   #include <cstdint>
   #include <iterator>
+  #include <limits>
   #include <type_traits>
 
   WIDE_DECIMAL_NAMESPACE_BEGIN
@@ -165,76 +171,91 @@
   }
 
   template<typename InputLimbIteratorType,
-           typename OutputLimbIteratorType>
-  void eval_multiply_n_by_n_to_2n
-  (
-          OutputLimbIteratorType  r,
-          InputLimbIteratorType   a,
-          InputLimbIteratorType   b,
-    const std::int_fast32_t       count,
-    const typename std::enable_if<std::is_same<typename std::iterator_traits<OutputLimbIteratorType>::value_type, std::uint8_t>::value>::type* p_nullparam = nullptr
-  )
+           typename AccumulatorLimbIteratorType>
+  auto eval_accumulate_n(      AccumulatorLimbIteratorType acc,
+                         const std::int32_t                ofs,
+                               InputLimbIteratorType       v,
+                         const std::int32_t                count,
+                         const bool                        is_subtraction) -> std::int_fast8_t
   {
-    static_cast<void>(p_nullparam);
+    // Add (or subtract) the limbs v[0 ... count - 1] to (or from) the
+    // limbs acc[ofs ... ofs + count - 1] of an accumulator and propagate
+    // the carry (or the borrow) through acc[0 ... ofs - 1]. The limbs
+    // of the accumulator are not normalized otherwise. Return +1 for
+    // a carry and -1 for a borrow out of acc[0], otherwise 0.
 
-    using local_limb_type = typename std::iterator_traits<OutputLimbIteratorType>::value_type;
+    using local_limb_type = typename std::iterator_traits<AccumulatorLimbIteratorType>::value_type;
 
     constexpr auto local_elem_mask =
       static_cast<local_limb_type>(decwide_t_helper_base<local_limb_type>::elem_mask);
 
-    using local_double_limb_type =
-      typename std::conditional<std::is_same<local_limb_type, std::uint32_t>::value,
-                                std::uint64_t,
-                                typename std::conditional<std::is_same<local_limb_type, std::uint16_t>::value,
-                                                          std::uint32_t,
-                                                          std::uint16_t>::type>::type;
-
-    const auto fill_dst =
-      static_cast<std::uint_fast32_t>
-      (
-        count * static_cast<std::int_fast32_t>(INT8_C(2))
-      );
-
-    std::fill(r, r + fill_dst, static_cast<local_limb_type>(UINT8_C(0)));
+    auto carry = static_cast<std::uint_fast8_t>(UINT8_C(0));
 
-    const auto count_minus_one =
-      static_cast<std::int_fast32_t>
-      (
-        count - static_cast<std::int_fast32_t>(INT8_C(1))
-      );
+    auto j = static_cast<std::int32_t>(static_cast<std::int32_t>(ofs + count) - 1);
 
-    for(auto   i  = count_minus_one;
-               i >= static_cast<std::int_fast32_t>(INT8_C(0)); // NOLINT(altera-id-dependent-backward-branch)
-             --i)
+    if(!is_subtraction)
     {
-      auto j = count_minus_one;
-
-      auto carry = static_cast<local_double_limb_type>(UINT8_C(0));
+      for( ; j >= ofs; --j) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto t =
+          static_cast<local_limb_type>
+          (
+            static_cast<local_limb_type>(acc[j] + static_cast<local_limb_type>(v[j - ofs])) + carry
+          );
 
-      auto one_plus_i_plus_j =
-        static_cast<std::int_fast32_t>
-        (
-            static_cast<std::int_fast32_t>(INT8_C(1))
-          + static_cast<std::int_fast32_t>(i + j)
-        );
+        carry  = ((t >= local_elem_mask) ? static_cast<std::uint_fast8_t>(UINT8_C(1)) : static_cast<std::uint_fast8_t>(UINT8_C(0)));
+        acc[j] = static_cast<local_limb_type>(t - ((carry != static_cast<std::uint_fast8_t>(UINT8_C(0))) ? local_elem_mask : static_cast<local_limb_type>(UINT8_C(0))));
+      }
 
-      while(j >= static_cast<std::int_fast32_t>(INT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
+      for( ; (j >= static_cast<std::int32_t>(INT8_C(0))) && (carry != static_cast<std::uint_fast8_t>(UINT8_C(0))); --j) // NOLINT(altera-id-dependent-backward-branch)
       {
-        carry = static_cast<local_double_limb_type>(carry + static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(a[i]) * b[j]));
-        carry = static_cast<local_double_limb_type>(carry + r[one_plus_i_plus_j]);
-
-        r[one_plus_i_plus_j] = static_cast<local_limb_type>       (carry % local_elem_mask);
-        carry                = static_cast<local_double_limb_type>(carry / local_elem_mask);
+        const auto t = static_cast<local_limb_type>(acc[j] + static_cast<local_limb_type>(UINT8_C(1)));
 
-        --j;
+        carry  = ((t >= local_elem_mask) ? static_cast<std::uint_fast8_t>(UINT8_C(1)) : static_cast<std::uint_fast8_t>(UINT8_C(0)));
+        acc[j] = static_cast<local_limb_type>(t - ((carry != static_cast<std::uint_fast8_t>(UINT8_C(0))) ? local_elem_mask : static_cast<local_limb_type>(UINT8_C(0))));
+      }
+    }
+    else
+    {
+      for( ; j >= ofs; --j) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto vj = static_cast<local_limb_type>(static_cast<local_limb_type>(v[j - ofs]) + carry);
 
-        --one_plus_i_plus_j;
+        carry  = ((acc[j] < vj) ? static_cast<std::uint_fast8_t>(UINT8_C(1)) : static_cast<std::uint_fast8_t>(UINT8_C(0)));
+        acc[j] = static_cast<local_limb_type>(static_cast<local_limb_type>(acc[j] + ((carry != static_cast<std::uint_fast8_t>(UINT8_C(0))) ? local_elem_mask : static_cast<local_limb_type>(UINT8_C(0)))) - vj);
       }
 
-      r[one_plus_i_plus_j] = static_cast<local_limb_type>(carry);
+      for( ; (j >= static_cast<std::int32_t>(INT8_C(0))) && (carry != static_cast<std::uint_fast8_t>(UINT8_C(0))); --j) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        carry  = ((acc[j] == static_cast<local_limb_type>(UINT8_C(0))) ? static_cast<std::uint_fast8_t>(UINT8_C(1)) : static_cast<std::uint_fast8_t>(UINT8_C(0)));
+        acc[j] = static_cast<local_limb_type>(((carry != static_cast<std::uint_fast8_t>(UINT8_C(0))) ? local_elem_mask : acc[j]) - static_cast<local_limb_type>(UINT8_C(1)));
+      }
     }
+
+    return
+      static_cast<std::int_fast8_t>
+      (
+        (carry == static_cast<std::uint_fast8_t>(UINT8_C(0)))
+          ? INT8_C(0)
+          : (is_subtraction ? INT8_C(-1) : INT8_C(1))
+      );
   }
 
+  // The schoolbook multiplication kernels below are column-wise
+  // (Comba-style). The products a[i] * b[j] of one column are
+  // accumulated in a wide sum and the carry is normalized only once
+  // per column, which keeps divisions out of the inner loops.
+  // The sums are held in the double-limb type, except for 8-bit limbs,
+  // where a 16-bit sum would overflow after a few products.
+  // For these, a 32-bit sum is used.
+
+  template<typename LimbType>
+  struct column_sum_type_helper
+  {
+    using exact_unsigned_type =
+      typename uint_type_helper<static_cast<std::size_t>((std::numeric_limits<LimbType>::digits < 16) ? 32 : (std::numeric_limits<LimbType>::digits * 2))>::exact_unsigned_type;
+  };
+
   template<typename InputLimbIteratorType,
            typename OutputLimbIteratorType>
   void eval_multiply_n_by_n_to_2n
@@ -242,23 +263,15 @@
           OutputLimbIteratorType r,
           InputLimbIteratorType  a,
           InputLimbIteratorType  b,
-    const std::int_fast32_t      count,
-    const typename std::enable_if<(   std::is_same<typename std::iterator_traits<OutputLimbIteratorType>::value_type, std::uint16_t>::value
-                                   || std::is_same<typename std::iterator_traits<OutputLimbIteratorType>::value_type, std::uint32_t>::value)>::type* p_nullparam = nullptr)
+    const std::int_fast32_t      count
+  )
   {
-    static_cast<void>(p_nullparam);
-
     using local_limb_type = typename std::iterator_traits<OutputLimbIteratorType>::value_type;
 
     constexpr auto local_elem_mask =
       static_cast<local_limb_type>(decwide_t_helper_base<local_limb_type>::elem_mask);
 
-    using local_double_limb_type =
-      typename std::conditional<std::is_same<local_limb_type, std::uint32_t>::value,
-                                std::uint64_t,
-                                typename std::conditional<std::is_same<local_limb_type, std::uint16_t>::value,
-                                                          std::uint32_t,
-                                                          std::uint16_t>::type>::type;
+    using local_sum_type = typename column_sum_type_helper<local_limb_type>::exact_unsigned_type;
 
     using local_reverse_iterator_type = std::reverse_iterator<local_limb_type*>;
 
@@ -270,7 +283,7 @@
 
     auto ir = local_reverse_iterator_type { r + r_range };
 
-    auto carry = static_cast<local_double_limb_type>(0U);
+    auto carry = static_cast<local_sum_type>(0U);
 
     const auto count_minus_one =
       static_cast<std::int_fast32_t>
@@ -287,15 +300,15 @@
       for(auto i = static_cast<std::int32_t>(count_minus_one); i >= j; --i) // NOLINT(altera-id-dependent-backward-branch)
       {
         sum +=
-          static_cast<local_double_limb_type>
+          static_cast<local_sum_type>
           (
-              static_cast<local_double_limb_type>(a[i])
+              static_cast<local_sum_type>(a[i])
             * b[count_minus_one - static_cast<std::int_fast32_t>(i - j)]
           );
       }
 
-      carry = static_cast<local_double_limb_type>(sum / local_elem_mask);
-      *ir++ = static_cast<local_limb_type>       (sum % local_elem_mask);
+      carry = static_cast<local_sum_type> (sum / local_elem_mask);
+      *ir++ = static_cast<local_limb_type>(sum % local_elem_mask);
     }
 
     for(auto   j  = static_cast<std::int32_t>(count_minus_one);
@@ -306,16 +319,210 @@
 
       for(auto i = j; i >= static_cast<std::int32_t>(INT8_C(0)); --i) // NOLINT(altera-id-dependent-backward-branch)
       {
-        sum += static_cast<local_double_limb_type>(a[j - i] * static_cast<local_double_limb_type>(b[i]));
+        sum += static_cast<local_sum_type>(a[j - i] * static_cast<local_sum_type>(b[i]));
       }
 
-      carry = static_cast<local_double_limb_type>(sum / local_elem_mask);
-      *ir++ = static_cast<local_limb_type>       (sum % local_elem_mask);
+      carry = static_cast<local_sum_type> (sum / local_elem_mask);
+      *ir++ = static_cast<local_limb_type>(sum % local_elem_mask);
     }
 
     *ir = static_cast<local_limb_type>(carry);
   }
 
+  template<typename InputLimbIteratorType,
+           typename OutputLimbIteratorType>
+  void eval_square_n_to_2n
+  (
+          OutputLimbIteratorType r,
+          InputLimbIteratorType  a,
+    const std::int_fast32_t      count
+  )
+  {
+    // Square a with column-wise schoolbook multiplication.
+    // Each cross product a[i] * a[j] (with i != j) appears twice
+    // in its column. It is computed once and the sum of the cross
+    // products is doubled, so that only about half of the products
+    // are needed. The column sums are the same as those of the
+    // general multiplication, so they do not overflow either.
+
+    using local_limb_type = typename std::iterator_traits<OutputLimbIteratorType>::value_type;
+
+    constexpr auto local_elem_mask =
+      static_cast<local_limb_type>(decwide_t_helper_base<local_limb_type>::elem_mask);
+
+    using local_sum_type = typename column_sum_type_helper<local_limb_type>::exact_unsigned_type;
+
+    const auto count_minus_one =
+      static_cast<std::int32_t>
+      (
+        count - static_cast<std::int_fast32_t>(INT8_C(1))
+      );
+
+    auto carry = static_cast<local_sum_type>(0U);
+
+    // The column k (with k = i + j) is stored in the result limb k + 1.
+    for(auto   k  = static_cast<std::int32_t>(count_minus_one * 2);
+               k >= static_cast<std::int32_t>(INT8_C(0)); // NOLINT(altera-id-dependent-backward-branch)
+             --k)
+    {
+      auto cross = static_cast<local_sum_type>(0U);
+
+      // Sum the cross products a[i] * a[j] with i < j and i + j = k.
+      for(auto   i  = (std::max)(static_cast<std::int32_t>(INT8_C(0)), static_cast<std::int32_t>(k - count_minus_one)), j = static_cast<std::int32_t>(k - i);
+                 i  < j; // NOLINT(altera-id-dependent-backward-branch)
+               ++i, --j)
+      {
+        cross += static_cast<local_sum_type>(static_cast<local_sum_type>(a[i]) * a[j]);
+      }
+
+      auto sum = static_cast<local_sum_type>(carry + static_cast<local_sum_type>(cross * 2U));
+
+      if(static_cast<std::int32_t>(k % 2) == static_cast<std::int32_t>(INT8_C(0)))
+      {
+        const auto a_k_half = static_cast<local_sum_type>(a[k / 2]);
+
+        sum += static_cast<local_sum_type>(a_k_half * a_k_half);
+      }
+
+      carry    = static_cast<local_sum_type> (sum / local_elem_mask);
+      r[k + 1] = static_cast<local_limb_type>(sum % local_elem_mask);
+    }
+
+    r[0] = static_cast<local_limb_type>(carry);
+  }
+
+  // The short (high-half) products below compute only the high_count
+  // most significant limbs r[0 ... high_count - 1] of the (2 * count)-limb
+  // product. The columns k = i + j of the products a[i] * b[j] are stored
+  // in r[k + 1] (with the final carry in r[0]), and the columns beyond
+  // k = high_count are not summed. For count < elem_mask, the sum of the
+  // omitted columns is less than one unit of r[high_count - 1]. So the
+  // result is either the high part of the exact product or it is one unit
+  // (of r[high_count - 1]) lower than this. The kernels write the limbs
+  // r[0 ... k_last + 1] with k_last = min(2 * count - 2, high_count),
+  // in other words up to r[high_count + 1], so r must have room for
+  // these. The limbs of r beyond r[high_count - 1] are not meaningful.
+
+  inline auto eval_multiply_high_last_column(const std::int_fast32_t count,
+                                             const std::int_fast32_t high_count) -> std::int_fast32_t
+  {
+    // Get the last column to be summed. This includes
+    // two guard columns below the column of r[high_count - 1].
+    return
+      (std::min)
+      (
+        static_cast<std::int_fast32_t>(static_cast<std::int_fast32_t>(count * static_cast<std::int_fast32_t>(INT8_C(2))) - static_cast<std::int_fast32_t>(INT8_C(2))),
+        high_count
+      );
+  }
+
+  template<typename InputLimbIteratorType,
+           typename OutputLimbIteratorType>
+  void eval_multiply_n_by_n_to_high
+  (
+          OutputLimbIteratorType r,
+          InputLimbIteratorType  a,
+          InputLimbIteratorType  b,
+    const std::int_fast32_t      count,
+    const std::int_fast32_t      high_count
+  )
+  {
+    // Column-wise short product. The column sums are the same
+    // as those of the full multiplication, so they do not overflow.
+
+    using local_limb_type = typename std::iterator_traits<OutputLimbIteratorType>::value_type;
+
+    constexpr auto local_elem_mask =
+      static_cast<local_limb_type>(decwide_t_helper_base<local_limb_type>::elem_mask);
+
+    using local_sum_type = typename column_sum_type_helper<local_limb_type>::exact_unsigned_type;
+
+    const auto count_minus_one =
+      static_cast<std::int32_t>
+      (
+        count - static_cast<std::int_fast32_t>(INT8_C(1))
+      );
+
+    auto carry = static_cast<local_sum_type>(0U);
+
+    for(auto   k  = static_cast<std::int32_t>(eval_multiply_high_last_column(count, high_count));
+               k >= static_cast<std::int32_t>(INT8_C(0)); // NOLINT(altera-id-dependent-backward-branch)
+             --k)
+    {
+      auto sum = carry;
+
+      const auto i_last = (std::min)(k, count_minus_one);
+
+      for(auto i = (std::max)(static_cast<std::int32_t>(INT8_C(0)), static_cast<std::int32_t>(k - count_minus_one)); i <= i_last; ++i) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        sum += static_cast<local_sum_type>(static_cast<local_sum_type>(a[i]) * b[k - i]);
+      }
+
+      carry    = static_cast<local_sum_type> (sum / local_elem_mask);
+      r[k + 1] = static_cast<local_limb_type>(sum % local_elem_mask);
+    }
+
+    r[0] = static_cast<local_limb_type>(carry);
+  }
+
+  template<typename InputLimbIteratorType,
+           typename OutputLimbIteratorType>
+  void eval_square_n_to_high
+  (
+          OutputLimbIteratorType r,
+          InputLimbIteratorType  a,
+    const std::int_fast32_t      count,
+    const std::int_fast32_t      high_count
+  )
+  {
+    // Column-wise short squaring, in which the cross
+    // products are computed once and doubled as in
+    // eval_square_n_to_2n.
+
+    using local_limb_type = typename std::iterator_traits<OutputLimbIteratorType>::value_type;
+
+    constexpr auto local_elem_mask =
+      static_cast<local_limb_type>(decwide_t_helper_base<local_limb_type>::elem_mask);
+
+    using local_sum_type = typename column_sum_type_helper<local_limb_type>::exact_unsigned_type;
+
+    const auto count_minus_one =
+      static_cast<std::int32_t>
+      (
+        count - static_cast<std::int_fast32_t>(INT8_C(1))
+      );
+
+    auto carry = static_cast<local_sum_type>(0U);
+
+    for(auto   k  = static_cast<std::int32_t>(eval_multiply_high_last_column(count, high_count));
+               k >= static_cast<std::int32_t>(INT8_C(0)); // NOLINT(altera-id-dependent-backward-branch)
+             --k)
+    {
+      auto cross = static_cast<local_sum_type>(0U);
+
+      for(auto   i  = (std::max)(static_cast<std::int32_t>(INT8_C(0)), static_cast<std::int32_t>(k - count_minus_one)), j = static_cast<std::int32_t>(k - i);
+                 i  < j; // NOLINT(altera-id-dependent-backward-branch)
+               ++i, --j)
+      {
+        cross += static_cast<local_sum_type>(static_cast<local_sum_type>(a[i]) * a[j]);
+      }
+
+      auto sum = static_cast<local_sum_type>(carry + static_cast<local_sum_type>(cross * 2U));
+
+      if(static_cast<std::int32_t>(k % 2) == static_cast<std::int32_t>(INT8_C(0)))
+      {
+        const auto a_k_half = static_cast<local_sum_type>(a[k / 2]);
+
+        sum += static_cast<local_sum_type>(a_k_half * a_k_half);
+      }
+
+      carry    = static_cast<local_sum_type> (sum / local_elem_mask);
+      r[k + 1] = static_cast<local_limb_type>(sum % local_elem_mask);
+    }
+
+    r[0] = static_cast<local_limb_type>(carry);
+  }
+
   template<typename LimbIteratorType>
   auto mul_loop_n(      LimbIteratorType                                            u,
                         typename std::iterator_traits<LimbIteratorType>::value_type n,
@@ -324,11 +531,7 @@
     using local_limb_type = typename std::iterator_traits<LimbIteratorType>::value_type;
 
     using local_double_limb_type =
-      typename std::conditional<std::is_same<local_limb_type, std::uint32_t>::value,
-                                std::uint64_t,
-                                typename std::conditional<std::is_same<local_limb_type, std::uint16_t>::value,
-                                                          std::uint32_t,
-                                                          std::uint16_t>::type>::type;
+      typename uint_type_helper<static_cast<std::size_t>(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
 
     auto carry = static_cast<local_limb_type>(UINT8_C(0));
 
@@ -353,24 +556,71 @@
     return static_cast<local_limb_type>(carry);
   }
 
+  template<typename LimbIteratorType,
+           typename InputLimbIteratorType>
+  auto mul_loop_n_by_m(      LimbIteratorType      u,
+                             InputLimbIteratorType v,
+                       const std::int32_t          m,
+                       const std::int32_t          p) -> typename std::iterator_traits<LimbIteratorType>::value_type
+  {
+    // Multiply the p limbs of u by the m limbs of v (with m <= p) in place.
+    // The columns k = i + j of the products u[i] * v[j] are summed from
+    // the least significant column k = p + m - 2 on. The columns k < p
+    // are stored in u[k], which is not needed by the remaining columns.
+    // The columns k >= p only contribute their carry. The final carry
+    // (the most significant limb of the product) is returned.
+    // The column sums have at most m terms. So they do not overflow
+    // if m does not exceed the count of the n-by-n multiplication.
+
+    using local_limb_type = typename std::iterator_traits<LimbIteratorType>::value_type;
+
+    constexpr auto local_elem_mask =
+      static_cast<local_limb_type>(decwide_t_helper_base<local_limb_type>::elem_mask);
+
+    using local_sum_type = typename column_sum_type_helper<local_limb_type>::exact_unsigned_type;
+
+    auto carry = static_cast<local_sum_type>(0U);
+
+    for(auto   k  = static_cast<std::int32_t>(static_cast<std::int32_t>(p + m) - static_cast<std::int32_t>(INT8_C(2)));
+               k >= static_cast<std::int32_t>(INT8_C(0)); // NOLINT(altera-id-dependent-backward-branch)
+             --k)
+    {
+      auto sum = carry;
+
+      const auto j_last = (std::min)(k, static_cast<std::int32_t>(m - static_cast<std::int32_t>(INT8_C(1))));
+
+      for(auto j = (std::max)(static_cast<std::int32_t>(INT8_C(0)), static_cast<std::int32_t>(static_cast<std::int32_t>(k - p) + static_cast<std::int32_t>(INT8_C(1)))); j <= j_last; ++j) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        sum += static_cast<local_sum_type>(static_cast<local_sum_type>(u[k - j]) * v[j]);
+      }
+
+      carry = static_cast<local_sum_type>(sum / local_elem_mask);
+
+      if(k < p)
+      {
+        u[k] = static_cast<local_limb_type>(sum % local_elem_mask);
+      }
+    }
+
+    return static_cast<local_limb_type>(carry);
+  }
+
   template<typename LimbIteratorType>
   auto div_loop_n(      LimbIteratorType                                            u,
                         typename std::iterator_traits<LimbIteratorType>::value_type n,
-                  const std::int32_t                                                p) -> typename std::iterator_traits<LimbIteratorType>::value_type
+                  const std::int32_t                                                p,
+                        typename std::iterator_traits<LimbIteratorType>::value_type prev) -> typename std::iterator_traits<LimbIteratorType>::value_type
   {
+    // Divide the p limbs of u by n, where prev is the remainder
+    // of the more significant limbs. Return the remainder.
+
     using local_limb_type = typename std::iterator_traits<LimbIteratorType>::value_type;
 
     constexpr auto local_elem_mask =
       static_cast<local_limb_type>(decwide_t_helper_base<local_limb_type>::elem_mask);
 
     using local_double_limb_type =
-      typename std::conditional<std::is_same<local_limb_type, std::uint32_t>::value,
-                                std::uint64_t,
-                                typename std::conditional<std::is_same<local_limb_type, std::uint16_t>::value,
-                                                          std::uint32_t,
-                                                          std::uint16_t>::type>::type;
-
-    auto prev = static_cast<local_limb_type>(UINT8_C(0));
+      typename uint_type_helper<static_cast<std::size_t>(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
 
     for(auto j = static_cast<std::int32_t>(INT8_C(0)); j < p; ++j)
     {
@@ -388,71 +638,466 @@
     return prev;
   }
 
+  // The division by a wide (multi-limb) integer below handles divisors
+  // up to this limit. Its remainders are evaluated modulo 2^64 and
+  // need one extra bit besides the sign.
+  constexpr auto div_loop_n_wide_max() -> std::uint64_t { return static_cast<std::uint64_t>(UINT64_C(1) << 62U); }
+
   template<typename LimbIteratorType>
-  auto eval_multiply_kara_propagate_carry(      LimbIteratorType                                            t,
-                                          const std::uint_fast32_t                                          n,
-                                          const typename std::iterator_traits<LimbIteratorType>::value_type carry) -> void
+  auto div_loop_n_wide(      LimbIteratorType u,
+                       const std::uint64_t    n,
+                       const std::int32_t     p,
+                             std::uint64_t    prev) -> std::uint64_t
   {
+    // Divide the p limbs of u by the integer n (less than
+    // div_loop_n_wide_max()), where prev is the remainder of the more
+    // significant limbs. Return the remainder. The limbs are divided
+    // in points (as in the NTT), which are one limb for limbs up to
+    // 32 bits and half a limb for 64-bit limbs. Each quotient point is
+    // estimated with the reciprocal of n in double precision. Its error
+    // is at most one, and it is corrected with the remainder, which is
+    // evaluated modulo 2^64. No double-width division is needed.
+
     using local_limb_type = typename std::iterator_traits<LimbIteratorType>::value_type;
 
-    constexpr auto local_elem_mask =
-      static_cast<local_limb_type>(decwide_t_helper_base<local_limb_type>::elem_mask);
+    constexpr auto local_points_per_limb = decwide_t_helper_base<local_limb_type>::ntt_points_per_limb;
 
-    auto carry_out =
-      static_cast<std::uint_fast8_t>
-      (
-        (carry != static_cast<local_limb_type>(UINT8_C(0)))
-          ? static_cast<std::uint_fast8_t>(UINT8_C(1))
-          : static_cast<std::uint_fast8_t>(UINT8_C(0))
-      );
+    constexpr auto local_point_mask = static_cast<std::uint64_t>(decwide_t_helper_base<local_limb_type>::ntt_point_mask);
 
-    using local_reverse_iterator_type = std::reverse_iterator<LimbIteratorType>;
+    constexpr auto f_point_mask = static_cast<double>(local_point_mask);
 
-    auto ri_t   = local_reverse_iterator_type { t + n };
-    auto rend_t = local_reverse_iterator_type { t };
+    const auto inv_n = static_cast<double>(static_cast<double>(1.0F) / static_cast<double>(n));
 
-    while((carry_out != static_cast<std::uint_fast8_t>(UINT8_C(0))) && (ri_t != rend_t)) // NOLINT(altera-id-dependent-backward-branch)
+    for(auto j = static_cast<std::int32_t>(INT8_C(0)); j < p; ++j)
     {
-      const auto tt = static_cast<local_limb_type>(*ri_t + static_cast<local_limb_type>(carry_out));
+      auto x = static_cast<std::uint64_t>(u[j]);
 
-      carry_out = ((tt >= local_elem_mask) ? static_cast<std::uint_fast8_t>(UINT8_C(1))
-                                           : static_cast<std::uint_fast8_t>(UINT8_C(0)));
+      auto q_limb = static_cast<std::uint64_t>(UINT8_C(0));
 
-      const auto has_carry = (carry_out != static_cast<std::uint_fast8_t>(UINT8_C(0)));
+      for(auto k = static_cast<std::uint32_t>(UINT8_C(0)); k < local_points_per_limb; ++k)
+      {
+        auto xk = x;
 
-      *ri_t++ =
-        static_cast<local_limb_type>
-        (
-            tt
-          - static_cast<local_limb_type>
-            (
-              has_carry ? local_elem_mask : static_cast<local_limb_type>(UINT8_C(0))
-            )
-        );
+        if(local_points_per_limb > static_cast<std::uint32_t>(UINT8_C(1)))
+        {
+          xk = static_cast<std::uint64_t>((k == static_cast<std::uint32_t>(UINT8_C(0))) ? (x / local_point_mask) : (x % local_point_mask));
+        }
+
+        auto q =
+          static_cast<std::uint64_t>
+          (
+              static_cast<double>(static_cast<double>(static_cast<double>(prev) * f_point_mask) + static_cast<double>(xk))
+            * inv_n
+          );
+
+        // The remainder is (prev * point_mask + xk - q * n) with -n <= r < 2n,
+        // which is unambiguous modulo 2^64 for n < div_loop_n_wide_max().
+        auto r =
+          static_cast<std::uint64_t>
+          (
+              static_cast<std::uint64_t>(static_cast<std::uint64_t>(prev * local_point_mask) + xk)
+            - static_cast<std::uint64_t>(q * n)
+          );
+
+        if(r >= static_cast<std::uint64_t>(UINT64_C(1) << 63U))
+        {
+          // The estimate was too large by one.
+          --q;
+
+          r = static_cast<std::uint64_t>(r + n);
+        }
+        else if(r >= n)
+        {
+          // The estimate was too small by one.
+          ++q;
+
+          r = static_cast<std::uint64_t>(r - n);
+        }
+
+        prev = r;
+
+        q_limb = static_cast<std::uint64_t>(static_cast<std::uint64_t>(q_limb * local_point_mask) + q);
+      }
+
+      u[j] = static_cast<local_limb_type>(q_limb);
     }
+
+    return prev;
   }
 
-  template<typename LimbIteratorType>
-  auto eval_multiply_kara_propagate_borrow(      LimbIteratorType   t,
-                                           const std::uint_fast32_t n,
-                                           const bool               has_borrow) -> void
+  // The long division below works on points of 8 decimal digits
+  // (as signed 64-bit integers), which hold 4 limbs of 8 bits, 2 limbs
+  // of 16 bits, 1 limb of 32 bits or half of a limb of 64 bits. The carries
+  // of the remainder are not released during the division. Each point
+  // of the remainder receives at most (n + 1) products of a quotient point
+  // and a divisor point (with n points), each less than about 10^16. This
+  // limits n to eval_divide_max_points(), keeping the remainder well within
+  // the range of std::int64_t.
+  constexpr auto eval_divide_point_digits10() -> std::int32_t { return static_cast<std::int32_t>(INT8_C(8)); }
+  constexpr auto eval_divide_point_mask    () -> std::int64_t { return static_cast<std::int64_t>(INT32_C(100000000)); }
+  constexpr auto eval_divide_max_points    () -> std::int32_t { return static_cast<std::int32_t>(INT16_C(128)); }
+
+  template<typename LimbType>
+  constexpr auto eval_divide_points(const std::int32_t limb_count) -> std::int32_t
   {
-    using local_limb_type = typename std::iterator_traits<LimbIteratorType>::value_type;
-
-    constexpr auto local_elem_mask =
-      static_cast<local_limb_type>(decwide_t_helper_base<local_limb_type>::elem_mask);
-
-    auto borrow =
-      static_cast<std::int_fast8_t>
+    // Get the number of points needed for limb_count limbs.
+    return
+      static_cast<std::int32_t>
       (
-        (has_borrow ? static_cast<std::int_fast8_t>(INT8_C(1))
-                    : static_cast<std::int_fast8_t>(INT8_C(0)))
+          static_cast<std::int32_t>
+          (
+              static_cast<std::int32_t>(limb_count * decwide_t_helper_base<LimbType>::elem_digits10)
+            + static_cast<std::int32_t>(eval_divide_point_digits10() - 1)
+          )
+        / eval_divide_point_digits10()
       );
+  }
 
-    using local_reverse_iterator_type = std::reverse_iterator<LimbIteratorType>;
+  template<typename InputLimbIteratorType>
+  auto eval_divide_load_points(      std::int64_t*         p,
+                                     InputLimbIteratorType u,
+                               const std::int32_t          count,
+                               const std::int32_t          point_count) -> void
+  {
+    // Load the count limbs of u into the point_count points of p.
+    // The points beyond the limbs of u are zero.
 
-    auto ri_t   = local_reverse_iterator_type { t + n };
-    auto rend_t = local_reverse_iterator_type { t };
+    using local_limb_type = typename std::iterator_traits<InputLimbIteratorType>::value_type;
+
+    constexpr auto local_elem_digits10 = decwide_t_helper_base<local_limb_type>::elem_digits10;
+
+    constexpr auto local_elem_mask = static_cast<std::int64_t>(decwide_t_helper_base<local_limb_type>::elem_mask);
+
+    if(local_elem_digits10 > eval_divide_point_digits10())
+    {
+      // Split each limb into two points.
+      for(auto i = static_cast<std::int32_t>(INT8_C(0)); i < point_count; ++i)
+      {
+        const auto limb_index = static_cast<std::int32_t>(i / 2);
+
+        const auto limb =
+          static_cast<std::int64_t>
+          (
+            (limb_index < count) ? static_cast<std::int64_t>(u[limb_index]) : static_cast<std::int64_t>(INT8_C(0))
+          );
+
+        p[i] = (((i % 2) == 0) ? static_cast<std::int64_t>(limb / eval_divide_point_mask())
+                               : static_cast<std::int64_t>(limb % eval_divide_point_mask()));
+      }
+    }
+    else
+    {
+      // Combine (one or) several limbs into one point.
+      constexpr auto limbs_per_point = static_cast<std::int32_t>(eval_divide_point_digits10() / local_elem_digits10);
+
+      for(auto i = static_cast<std::int32_t>(INT8_C(0)); i < point_count; ++i)
+      {
+        auto point = static_cast<std::int64_t>(INT8_C(0));
+
+        for(auto k = static_cast<std::int32_t>(INT8_C(0)); k < limbs_per_point; ++k)
+        {
+          const auto limb_index = static_cast<std::int32_t>(static_cast<std::int32_t>(i * limbs_per_point) + k);
+
+          point = static_cast<std::int64_t>(point * local_elem_mask);
+
+          point = static_cast<std::int64_t>(point + ((limb_index < count) ? static_cast<std::int64_t>(u[limb_index]) : static_cast<std::int64_t>(INT8_C(0))));
+        }
+
+        p[i] = point;
+      }
+    }
+  }
+
+  template<typename LimbType>
+  constexpr auto eval_divide_quotient_offset() -> std::int32_t
+  {
+    // Get the number of (zero) limbs that precede the quotient
+    // in its points (see eval_divide_n_by_n).
+    return
+      static_cast<std::int32_t>
+      (
+        (decwide_t_helper_base<LimbType>::elem_digits10 > eval_divide_point_digits10())
+          ? static_cast<std::int32_t>(INT8_C(0))
+          : static_cast<std::int32_t>(static_cast<std::int32_t>(eval_divide_point_digits10() / decwide_t_helper_base<LimbType>::elem_digits10) - 1)
+      );
+  }
+
+  template<typename LimbType>
+  constexpr auto eval_divide_quotient_points(const std::int32_t q_count) -> std::int32_t
+  {
+    return static_cast<std::int32_t>(eval_divide_points<LimbType>(static_cast<std::int32_t>(q_count + eval_divide_quotient_offset<LimbType>())) + 1);
+  }
+
+  template<typename LimbType>
+  constexpr auto eval_divide_workspace(const std::int32_t count, const std::int32_t q_count) -> std::int32_t
+  {
+    // Get the number of points of the temporary storage of
+    // eval_divide_n_by_n, which holds the running remainder
+    // (n + qn + 4 points) and the normalized divisor (n + 1 points).
+    return
+      static_cast<std::int32_t>
+      (
+          static_cast<std::int32_t>(eval_divide_points<LimbType>(count) * 2)
+        + static_cast<std::int32_t>(eval_divide_quotient_points<LimbType>(q_count) + 5)
+      );
+  }
+
+  template<typename OutputLimbIteratorType>
+  auto eval_divide_store_points(      OutputLimbIteratorType r,
+                                const std::int64_t*          p,
+                                const std::int32_t           count) -> void
+  {
+    // Store the points of p (each between 0 and point_mask - 1) into
+    // the count limbs of r, skipping the leading quotient offset limbs.
+
+    using local_limb_type = typename std::iterator_traits<OutputLimbIteratorType>::value_type;
+
+    constexpr auto local_elem_digits10 = decwide_t_helper_base<local_limb_type>::elem_digits10;
+
+    constexpr auto local_elem_mask = static_cast<std::int64_t>(decwide_t_helper_base<local_limb_type>::elem_mask);
+
+    if(local_elem_digits10 > eval_divide_point_digits10())
+    {
+      for(auto i = static_cast<std::int32_t>(INT8_C(0)); i < count; ++i)
+      {
+        r[i] = static_cast<local_limb_type>(static_cast<std::int64_t>(p[i * 2] * eval_divide_point_mask()) + p[(i * 2) + 1]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
+    else
+    {
+      constexpr auto limbs_per_point = static_cast<std::int32_t>(eval_divide_point_digits10() / local_elem_digits10);
+
+      for(auto i = static_cast<std::int32_t>(INT8_C(0)); i < count; ++i)
+      {
+        const auto limb_index = static_cast<std::int32_t>(i + eval_divide_quotient_offset<local_limb_type>());
+
+        auto point = p[limb_index / limbs_per_point]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        for(auto k = static_cast<std::int32_t>(static_cast<std::int32_t>(limbs_per_point - 1) - static_cast<std::int32_t>(limb_index % limbs_per_point)); k > static_cast<std::int32_t>(INT8_C(0)); --k)
+        {
+          point = static_cast<std::int64_t>(point / local_elem_mask);
+        }
+
+        r[i] = static_cast<local_limb_type>(point % local_elem_mask);
+      }
+    }
+  }
+
+  template<typename OutputLimbIteratorType,
+           typename InputLimbIteratorType>
+  auto eval_divide_n_by_n(      OutputLimbIteratorType q,
+                                std::int64_t*          w,
+                                InputLimbIteratorType  u,
+                                InputLimbIteratorType  v,
+                          const std::int32_t           count,
+                          const std::int32_t           q_count) -> void
+  {
+    // Divide u by v (each having count limbs, with nonzero leading limbs)
+    // with long division and store the q_count most significant limbs of
+    // the quotient in q. The quotient is aligned to the limbs, such that
+    // the value of u[0].u[1]... / v[0].v[1]... is q[0].q[1]...
+    // Its leading limb q[0] is zero if u[0].u[1]... < v[0].v[1]...
+
+    // The divisor and the dividend are multiplied by d, such that the
+    // leading point of the divisor is at least point_mask / 2, as in
+    // Knuth's Algorithm D (TAOCP Vol. 2, Section 4.3.1). Each quotient
+    // point is then estimated from the three leading points of the
+    // (scaled) remainder and divisor in double precision. The estimate is
+    // at most one too small or too large. The carries of the remainder
+    // are not released. Instead, the leading point of the remainder
+    // is folded into the next point after each step. The quotient points
+    // are normalized at the end, which corrects the inexact estimates.
+    //
+    // See also D. H. Bailey, "A Portable High Performance Multiprecision
+    // Package", RNR Technical Report RNR-90-022, NASA Ames, 1993.
+
+    // The temporary storage w has eval_divide_workspace(count, q_count)
+    // elements. The n points of u and v must not exceed the value of
+    // eval_divide_max_points().
+
+    using local_limb_type = typename std::iterator_traits<OutputLimbIteratorType>::value_type;
+
+    constexpr auto local_point_mask = eval_divide_point_mask();
+
+    const auto n  = eval_divide_points<local_limb_type>(count);
+    const auto qn = eval_divide_quotient_points<local_limb_type>(q_count);
+
+    // The quotient of the limbs of u and v is less than elem_mask. This is
+    // one point for limbs up to 32 bits. It is two points for limbs of 64
+    // bits, in which case the dividend is shifted by one (zero) point.
+    const auto un =
+      static_cast<std::int32_t>
+      (
+        (decwide_t_helper_base<local_limb_type>::elem_digits10 > eval_divide_point_digits10())
+          ? static_cast<std::int32_t>(n + 1)
+          : n
+      );
+
+    std::int64_t* t = w + static_cast<std::ptrdiff_t>(n + qn + 4); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    // Load the points of v into t[1 ... n] and of u into w[1 ... un].
+    std::fill(w, w + static_cast<std::ptrdiff_t>(n + qn + 4), static_cast<std::int64_t>(INT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    eval_divide_load_points(t + 1, v, count, n); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    eval_divide_load_points(w + static_cast<std::ptrdiff_t>(static_cast<std::int32_t>(un - n) + 1), u, count, n); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    // Scale the points with d and release the carries into t[0] and w[0].
+    const auto d = static_cast<std::int64_t>(local_point_mask / static_cast<std::int64_t>(t[1] + 1)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    auto carry_t = static_cast<std::int64_t>(INT8_C(0));
+    auto carry_w = static_cast<std::int64_t>(INT8_C(0));
+
+    for(auto i = n; i >= static_cast<std::int32_t>(INT8_C(1)); --i)
+    {
+      const auto xt = static_cast<std::int64_t>(static_cast<std::int64_t>(t[i] * d) + carry_t); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      carry_t = static_cast<std::int64_t>(xt / local_point_mask);
+
+      t[i] = static_cast<std::int64_t>(xt % local_point_mask); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    for(auto i = un; i >= static_cast<std::int32_t>(INT8_C(1)); --i)
+    {
+      const auto xw = static_cast<std::int64_t>(static_cast<std::int64_t>(w[i] * d) + carry_w); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      carry_w = static_cast<std::int64_t>(xw / local_point_mask);
+
+      w[i] = static_cast<std::int64_t>(xw % local_point_mask); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    t[0] = carry_t; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    w[0] = carry_w; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    constexpr auto f_point_mask = static_cast<double>(local_point_mask);
+
+    const auto t2 = static_cast<double>((n > static_cast<std::int32_t>(INT8_C(1))) ? t[2] : static_cast<std::int64_t>(INT8_C(0)));
+
+    const auto inv_t =
+      static_cast<double>
+      (
+          static_cast<double>(1.0F)
+        / static_cast<double>(static_cast<double>(static_cast<double>(t[0]) * f_point_mask) + static_cast<double>(static_cast<double>(t[1]) + static_cast<double>(t2 / f_point_mask)))
+      );
+
+    // The quotient points are stored in the (free) leading points of w.
+    for(auto j = static_cast<std::int32_t>(INT8_C(0)); j < qn; ++j)
+    {
+      std::int64_t* wj = w + j; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      const auto num =
+        static_cast<double>
+        (
+            static_cast<double>(static_cast<double>(wj[0]) * f_point_mask) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          + static_cast<double>(static_cast<double>(wj[1]) + static_cast<double>(static_cast<double>(wj[2]) / f_point_mask)) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        );
+
+      using std::floor;
+
+      const auto qj = static_cast<std::int64_t>(floor(num * inv_t));
+
+      if(qj != static_cast<std::int64_t>(INT8_C(0)))
+      {
+        for(auto i = static_cast<std::int32_t>(INT8_C(0)); i <= n; ++i)
+        {
+          wj[i] -= static_cast<std::int64_t>(qj * t[i]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+      }
+
+      // Fold the leading point of the remainder into the next point.
+      wj[1] += static_cast<std::int64_t>(wj[0] * local_point_mask); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      wj[0] = qj; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    // Normalize the quotient points.
+    auto carry = static_cast<std::int64_t>(INT8_C(0));
+
+    for(auto j = static_cast<std::int32_t>(qn - 1); j >= static_cast<std::int32_t>(INT8_C(0)); --j)
+    {
+      const auto x = static_cast<std::int64_t>(w[j] + carry);
+
+      carry = static_cast<std::int64_t>(x / local_point_mask);
+
+      auto xj = static_cast<std::int64_t>(x % local_point_mask);
+
+      if(xj < static_cast<std::int64_t>(INT8_C(0)))
+      {
+        xj = static_cast<std::int64_t>(xj + local_point_mask);
+
+        --carry;
+      }
+
+      w[j] = xj;
+    }
+
+    eval_divide_store_points(q, static_cast<const std::int64_t*>(w), q_count);
+  }
+
+  template<typename LimbIteratorType>
+  auto eval_multiply_kara_propagate_carry(      LimbIteratorType                                            t,
+                                          const std::uint_fast32_t                                          n,
+                                          const typename std::iterator_traits<LimbIteratorType>::value_type carry) -> void
+  {
+    using local_limb_type = typename std::iterator_traits<LimbIteratorType>::value_type;
+
+    constexpr auto local_elem_mask =
+      static_cast<local_limb_type>(decwide_t_helper_base<local_limb_type>::elem_mask);
+
+    auto carry_out =
+      static_cast<std::uint_fast8_t>
+      (
+        (carry != static_cast<local_limb_type>(UINT8_C(0)))
+          ? static_cast<std::uint_fast8_t>(UINT8_C(1))
+          : static_cast<std::uint_fast8_t>(UINT8_C(0))
+      );
+
+    using local_reverse_iterator_type = std::reverse_iterator<LimbIteratorType>;
+
+    auto ri_t   = local_reverse_iterator_type { t + n };
+    auto rend_t = local_reverse_iterator_type { t };
+
+    while((carry_out != static_cast<std::uint_fast8_t>(UINT8_C(0))) && (ri_t != rend_t)) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      const auto tt = static_cast<local_limb_type>(*ri_t + static_cast<local_limb_type>(carry_out));
+
+      carry_out = ((tt >= local_elem_mask) ? static_cast<std::uint_fast8_t>(UINT8_C(1))
+                                           : static_cast<std::uint_fast8_t>(UINT8_C(0)));
+
+      const auto has_carry = (carry_out != static_cast<std::uint_fast8_t>(UINT8_C(0)));
+
+      *ri_t++ =
+        static_cast<local_limb_type>
+        (
+            tt
+          - static_cast<local_limb_type>
+            (
+              has_carry ? local_elem_mask : static_cast<local_limb_type>(UINT8_C(0))
+            )
+        );
+    }
+  }
+
+  template<typename LimbIteratorType>
+  auto eval_multiply_kara_propagate_borrow(      LimbIteratorType   t,
+                                           const std::uint_fast32_t n,
+                                           const bool               has_borrow) -> void
+  {
+    using local_limb_type = typename std::iterator_traits<LimbIteratorType>::value_type;
+
+    constexpr auto local_elem_mask =
+      static_cast<local_limb_type>(decwide_t_helper_base<local_limb_type>::elem_mask);
+
+    auto borrow =
+      static_cast<std::int_fast8_t>
+      (
+        (has_borrow ? static_cast<std::int_fast8_t>(INT8_C(1))
+                    : static_cast<std::int_fast8_t>(INT8_C(0)))
+      );
+
+    using local_reverse_iterator_type = std::reverse_iterator<LimbIteratorType>;
+
+    auto ri_t   = local_reverse_iterator_type { t + n };
+    auto rend_t = local_reverse_iterator_type { t };
 
     while((borrow != static_cast<std::int_fast8_t>(INT8_C(0))) && (ri_t != rend_t)) // NOLINT(altera-id-dependent-backward-branch)
     {
@@ -476,6 +1121,60 @@
     }
   }
 
+  template<typename LimbIteratorType,
+           typename TempLimbIteratorType>
+  auto eval_multiply_kara_add_outer(      LimbIteratorType     r,
+                                    const std::uint_fast32_t   n,
+                                          TempLimbIteratorType t) -> void
+  {
+    // Add the products a1*b1 and a0*b0, which are stored in the
+    // upper-order and lower-order parts of r (2n limbs), to the middle
+    // two-quarters of r. The products are copied to t for this.
+    using local_limb_type = typename std::iterator_traits<LimbIteratorType>::value_type;
+
+    const auto nh = static_cast<std::uint_fast32_t>(n / static_cast<std::uint_fast32_t>(UINT8_C(2)));
+
+    LimbIteratorType r0 = r + 0U;
+    LimbIteratorType r1 = r + nh;
+
+    std::copy(r0, r0 + static_cast<std::size_t>(static_cast<std::size_t>(n) * static_cast<std::size_t>(UINT8_C(2))), t);
+
+    local_limb_type carry;
+    carry = detail::eval_add_n(r1, r1, t, static_cast<std::int32_t>(n));
+    eval_multiply_kara_propagate_carry(r0, nh, carry);
+    carry = detail::eval_add_n(r1, r1, t + n, static_cast<std::int32_t>(n));
+    eval_multiply_kara_propagate_carry(r0, nh, carry);
+  }
+
+  template<typename LimbIteratorType,
+           typename TempLimbIteratorType>
+  auto eval_multiply_kara_add_middle(      LimbIteratorType     r,
+                                     const std::uint_fast32_t   n,
+                                           TempLimbIteratorType t2,
+                                     const std::int_fast8_t     cmp_result_ab) -> void
+  {
+    // Add the product |a1-a0|*|b0-b1| (stored in t2) to the middle
+    // two-quarters of r if a1-a0 and b0-b1 have the same signs,
+    // and subtract it otherwise. Zero differences contribute nothing.
+    const auto nh = static_cast<std::uint_fast32_t>(n / static_cast<std::uint_fast32_t>(UINT8_C(2)));
+
+    LimbIteratorType r0 = r + 0U;
+    LimbIteratorType r1 = r + nh;
+
+    if(cmp_result_ab == static_cast<std::int_fast8_t>(INT8_C(1)))
+    {
+      const auto carry = detail::eval_add_n(r1, r1, t2, static_cast<std::int32_t>(n));
+
+      eval_multiply_kara_propagate_carry(r0, nh, carry);
+    }
+    else if(cmp_result_ab == static_cast<std::int_fast8_t>(static_cast<std::int_fast8_t>(INT8_C(-1))))
+    {
+      const auto has_borrow = detail::eval_subtract_n(r1, r1, t2, static_cast<std::int32_t>(n));
+
+      eval_multiply_kara_propagate_borrow(r0, nh, has_borrow);
+    }
+  }
+
   template<typename InputLimbIteratorType,
            typename OutputLimbIteratorType,
            typename TempLimbIteratorType>
@@ -489,7 +1188,14 @@
     {
       static_cast<void>(t);
 
-      detail::eval_multiply_n_by_n_to_2n(r, a, b, static_cast<std::int32_t>(n));
+      if(a == b)
+      {
+        detail::eval_square_n_to_2n(r, a, static_cast<std::int32_t>(n));
+      }
+      else
+      {
+        detail::eval_multiply_n_by_n_to_2n(r, a, b, static_cast<std::int32_t>(n));
+      }
     }
     else
     {
@@ -526,7 +1232,9 @@
       // Check the borrow signs. If a1-a0 and b0-b1 have the same signs,
       // then add |a1-a0|*|b0-b1| to r1, otherwise subtract it from r1.
 
-      using local_limb_type = typename std::iterator_traits<InputLimbIteratorType>::value_type;
+      // For squaring (a == b), the products in steps 1 and 5 are
+      // squares themselves. Step 4 is not needed, since b0-b1 is
+      // the negative of a1-a0, and (a1-a0)^2 is always subtracted.
 
       const auto nh = static_cast<std::uint_fast32_t>(n / static_cast<std::uint_fast32_t>(UINT8_C(2)));
 
@@ -537,7 +1245,6 @@
       InputLimbIteratorType b1 = b + 0U;
 
       OutputLimbIteratorType r0 = r + 0U;
-      OutputLimbIteratorType r1 = r + nh;
       OutputLimbIteratorType r2 = r + n;
 
       TempLimbIteratorType t0 = t + 0U;
@@ -548,14 +1255,9 @@
       // Step 1
       eval_multiply_kara_n_by_n_to_2n(r0, a1, b1, nh, t);
       eval_multiply_kara_n_by_n_to_2n(r2, a0, b0, nh, t);
-      std::copy(r0, r0 + static_cast<std::size_t>(static_cast<std::size_t>(n) * static_cast<std::size_t>(UINT8_C(2))), t0);
 
       // Step 2
-      local_limb_type carry;
-      carry = detail::eval_add_n(r1, r1, t0, static_cast<std::int32_t>(n));
-      eval_multiply_kara_propagate_carry(r0, nh, carry);
-      carry = detail::eval_add_n(r1, r1, t2, static_cast<std::int32_t>(n));
-      eval_multiply_kara_propagate_carry(r0, nh, carry);
+      eval_multiply_kara_add_outer(r, n, t0);
 
       // Step 3
       const std::int_fast8_t cmp_result_a1a0 = detail::compare_ranges(a1, a0, nh);
@@ -570,205 +1272,1380 @@
       }
 
       // Step 4
-      const std::int_fast8_t cmp_result_b0b1 = detail::compare_ranges(b0, b1, nh);
+      const auto is_square = (a == b);
 
-      if(cmp_result_b0b1 == static_cast<std::int_fast8_t>(INT8_C(1)))
-      {
-        static_cast<void>(detail::eval_subtract_n(t1, b0, b1, static_cast<std::int32_t>(nh)));
-      }
-      else if(cmp_result_b0b1 == static_cast<std::int_fast8_t>(INT8_C(-1)))
+      const std::int_fast8_t cmp_result_b0b1 =
+        (is_square ? static_cast<std::int_fast8_t>(-cmp_result_a1a0) : detail::compare_ranges(b0, b1, nh));
+
+      if(is_square)
       {
-        static_cast<void>(detail::eval_subtract_n(t1, b1, b0, static_cast<std::int32_t>(nh)));
+        // Step 5 (squaring)
+        eval_multiply_kara_n_by_n_to_2n(t2, t0, t0, nh, t4);
       }
-
-      // Step 5
-      eval_multiply_kara_n_by_n_to_2n(t2, t0, t1, nh, t4);
-
-      // Step 6
+      else
       {
-        const auto cmp_result_ab = static_cast<std::int_fast8_t>(cmp_result_a1a0 * cmp_result_b0b1);
-
-        if(cmp_result_ab == static_cast<std::int_fast8_t>(INT8_C(1)))
+        if(cmp_result_b0b1 == static_cast<std::int_fast8_t>(INT8_C(1)))
         {
-          carry = detail::eval_add_n(r1, r1, t2, static_cast<std::int32_t>(n));
-
-          eval_multiply_kara_propagate_carry(r0, nh, carry);
+          static_cast<void>(detail::eval_subtract_n(t1, b0, b1, static_cast<std::int32_t>(nh)));
         }
-        else if(cmp_result_ab == static_cast<std::int_fast8_t>(static_cast<std::int_fast8_t>(INT8_C(-1))))
+        else if(cmp_result_b0b1 == static_cast<std::int_fast8_t>(INT8_C(-1)))
         {
-          const auto has_borrow = detail::eval_subtract_n(r1, r1, t2, static_cast<std::int32_t>(n));
-
-          eval_multiply_kara_propagate_borrow(r0, nh, has_borrow);
+          static_cast<void>(detail::eval_subtract_n(t1, b1, b0, static_cast<std::int32_t>(nh)));
         }
+
+        // Step 5
+        eval_multiply_kara_n_by_n_to_2n(t2, t0, t1, nh, t4);
       }
+
+      // Step 6
+      eval_multiply_kara_add_middle(r, n, t2, static_cast<std::int_fast8_t>(cmp_result_a1a0 * cmp_result_b0b1));
     }
   }
 
-  #if 0 // NOLINT(readability-avoid-unconditional-preprocessor-if)
-  template<typename InputLimbIteratorType,
-           typename OutputLimbIteratorType,
+  constexpr auto eval_multiply_kara_high_school_elems() -> std::uint_fast32_t { return static_cast<std::uint_fast32_t>(UINT8_C(32)); }
+
+  constexpr auto eval_multiply_kara_high_error_units(const std::uint_fast32_t n) -> std::uintmax_t // NOLINT(misc-no-recursion)
+  {
+    // Get the upper bound E(n) of the deficit of the short product
+    // eval_multiply_kara_n_by_n_to_high in units of r[high_count - 1],
+    // see the derivation there. E = 1 for the schoolbook short product
+    // and E(n) = 3 * E(n/2) + 3 for each Karatsuba level above it,
+    // giving E = (5 * 3^d - 3) / 2 for d levels.
+    return
+      static_cast<std::uintmax_t>
+      (
+        (n <= eval_multiply_kara_high_school_elems())
+          ? static_cast<std::uintmax_t>(UINT8_C(1))
+          : static_cast<std::uintmax_t>(static_cast<std::uintmax_t>(static_cast<std::uintmax_t>(UINT8_C(3)) * eval_multiply_kara_high_error_units(static_cast<std::uint_fast32_t>(n / 2U))) + static_cast<std::uintmax_t>(UINT8_C(3)))
+      );
+  }
+
+  template<typename LimbType>
+  constexpr auto eval_multiply_kara_high_guard_elems(const std::uint_fast32_t n,
+                                                     const std::uintmax_t     unit_scale  = static_cast<std::uintmax_t>(decwide_t_helper_base<LimbType>::elem_mask),
+                                                     const std::uint_fast32_t guard_elems = static_cast<std::uint_fast32_t>(UINT8_C(1))) -> std::uint_fast32_t // NOLINT(misc-no-recursion)
+  {
+    // Get the smallest number of guard limbs g with elem_mask^g > E(n).
+    // With high_count exceeding the number of needed limbs by g, the
+    // deficit is less than one unit of the last needed limb.
+    return
+      (unit_scale > eval_multiply_kara_high_error_units(n))
+        ? guard_elems
+        : eval_multiply_kara_high_guard_elems<LimbType>(n,
+                                                        static_cast<std::uintmax_t>(unit_scale * static_cast<std::uintmax_t>(decwide_t_helper_base<LimbType>::elem_mask)),
+                                                        static_cast<std::uint_fast32_t>(guard_elems + 1U));
+  }
+
+  template<typename LimbIteratorType,
            typename TempLimbIteratorType>
-  auto eval_multiply_toom3_n_by_n_to_2n(      OutputLimbIteratorType r, // NOLINT(misc-no-recursion)
-                                              InputLimbIteratorType  a,
-                                              InputLimbIteratorType  b,
-                                        const std::uint_fast32_t     n,
-                                              TempLimbIteratorType   t) -> void
+  auto eval_multiply_kara_add_high(      LimbIteratorType     r,
+                                   const std::uint_fast32_t   offset,
+                                         TempLimbIteratorType t,
+                                   const std::uint_fast32_t   count) -> void
   {
-    // TBD: Implement Toom-Cook 3-way multiplication.
-    // See: https://github.com/ckormanyos/wide-decimal/issues/24
-
-    // See also: http://www.bodrato.it/toom-cook/
-
-    // (C) 2007-2011 Marco Bodrato <http://marco.bodrato.it/>
-    // This code is released under GNU-GPL 3.0+ licence.
-
-    // U = U2*x^2 + U1*x*y + U0*y^2
-    // V = V2*x^2 + V1*x*y + V0*y^2
-
-    // P(x,y)[3]: P0=(0,1); P1=(-2,1); P2=(1,1); P3=(-1,1); P4=(1,0)
-    // Evaluation[1]: 5*2 add/sub, 2 shift; 5mul (n)
-    // W3 = U0 + U2         ; W2 = V0 + V2
-    // W0 = W3 - U1         ; W4 = W2 - V1
-    // W3 = W3 + U1         ; W2 = W2 + V1
-
-    // W1 = W3 * W2         ; W2 = W0 * W4
-
-    // W0 =(W0 + U2)<<1 - U0; W4 =(W4 + V2)<<1 - V0
-
-    // W3 = W0 * W4
-    // W0 = U0 * V0         ; W4 = U2 * V2
-    // Interpolation[2]: 8 add/sub, 3 shift, 1 Sdiv (2n)
-    // W3 =(W3 - W1)/3
-    // W1 =(W1 - W2)>>1
-    // W2 = W2 - W0
-    // W3 =(W2 - W3)>>1 + W4<<1
-    // W2 = W2 + W1
-    // Early recomposition[3]:
-    // W3 = W4*x + W3*y
-    // W1 = W2*x + W1*y
-    // W1 = W1 - W3
-    // Final recomposition:
-    // W  = W3*x^3+ W1*x*y^2 + W0*y^4
-    // W == U*V
-
-    // References: http://bodrato.it/papers/#Toom-Cook
-    // [1] Marco BODRATO, "Towards Optimal Toom-Cook Multiplication
-    // for Univariate and Multivariate Polynomials in Characteristic
-    // 2 and 0"; "WAIFI'07 proceedings" (C.Carlet and B.Sunar, eds.)
-    // LNCS#4547, Springer, Madrid, Spain, June 2007, pp. 116-133.
-
-    // [2] M. BODRATO, A. ZANONI, "Integer and Polynomial
-    // Multiplication: Towards Optimal Toom-Cook Matrices";
-    // "Proceedings of the ISSAC 2007 conference", pp. 17-24
-    // ACM press, Waterloo, Ontario, Canada, July 29-August 1, 2007
-
-    // [3] Marco BODRATO, "High degree Toom'n'half for balanced and
-    // unbalanced multiplication"; "Proceedings of the 20th IEEE symposium
-    // on Computer Arithmetic", pp 15-22, Tuebingen, Germany, 2011
+    // Add the count limbs of t to r[offset ... offset + count - 1]
+    // and propagate the carry into r[0 ... offset - 1].
+    const auto carry = detail::eval_add_n(r + offset, r + offset, t, static_cast<std::int32_t>(count));
+
+    eval_multiply_kara_propagate_carry(r, offset, carry);
   }
-  #endif
 
   template<typename InputLimbIteratorType,
            typename OutputLimbIteratorType,
-           typename FftFloatIteratorType>
-  auto mul_loop_fft(      OutputLimbIteratorType r,
-                          InputLimbIteratorType  u,                       // NOLINT(bugprone-easily-swappable-parameters)
-                          InputLimbIteratorType  v,
-                          FftFloatIteratorType   af,
-                          FftFloatIteratorType   bf,
-                    const std::int32_t           prec_elems_for_multiply, // NOLINT(bugprone-easily-swappable-parameters)
-                    const std::uint32_t          n_fft) -> void           // NOLINT(bugprone-easily-swappable-parameters)
+           typename TempLimbIteratorType>
+  auto eval_multiply_kara_n_by_n_to_high(      OutputLimbIteratorType r, // NOLINT(misc-no-recursion)
+                                               InputLimbIteratorType  a,
+                                               InputLimbIteratorType  b,
+                                         const std::uint_fast32_t     n,
+                                         const std::uint_fast32_t     high_count,
+                                               TempLimbIteratorType   t) -> void
   {
-    using local_limb_type = typename std::iterator_traits<OutputLimbIteratorType>::value_type;
+    // Compute the high_count most significant limbs of the (2n)-limb
+    // product of a and b in r[0 ... high_count - 1] (short product).
+    // This is based on the short product of T. Mulders, see also
+    // "Algorithm 3.3 ShortProduct", Sect. 3.3.2 of R.P. Brent and
+    // P. Zimmermann, "Modern Computer Arithmetic" (2011), with the
+    // split at n/2. The product a1*b1 of the high halves is computed
+    // fully with Karatsuba multiplication (if needed). Only the high
+    // parts of the products a1*b0, a0*b1 and a0*b0, which reach into
+    // r[0 ... high_count - 1], are computed recursively.
+
+    // Let the deficit of a short product be the high part of the exact
+    // product minus the computed r[0 ... high_count - 1], in units of
+    // r[high_count - 1]. For the schoolbook short product (n <= 32),
+    // the deficit is at most E = 1 (see above). At a Karatsuba level,
+    // the high part of the exact product is the floor of the sum of the
+    // four (shifted) products a1*b1, a1*b0, a0*b1 and a0*b0, each in
+    // units of r[high_count - 1]. The computed result is the sum of the
+    // short products of the first three, each of which has a deficit of
+    // at most E(n/2) with respect to the floor of its exact value, and
+    // the short product of a0*b0 (or zero if a0*b0 lies entirely below
+    // r[high_count - 1]). Taking the floors of the four parts separately
+    // loses at most 3 units. So E(n) <= 3 * E(n/2) + 3, in other words
+    // E = (5 * 3^d - 3) / 2 for d Karatsuba levels above the schoolbook
+    // short product. With high_count exceeding the number of needed limbs
+    // by eval_multiply_kara_high_guard_elems<limb_type>(n) limbs (which
+    // is 1 or 2 for the Karatsuba range), the needed limbs are at most one
+    // unit of their last limb lower than those of the exact product.
+    // The temporary storage t has 4n limbs.
+
+    if(high_count >= static_cast<std::uint_fast32_t>(n * 2U))
+    {
+      eval_multiply_kara_n_by_n_to_2n(r, a, b, n, t);
+    }
+    else if(n <= eval_multiply_kara_high_school_elems())
+    {
+      if(a == b)
+      {
+        detail::eval_square_n_to_high(r, a, static_cast<std::int32_t>(n), static_cast<std::int32_t>(high_count));
+      }
+      else
+      {
+        detail::eval_multiply_n_by_n_to_high(r, a, b, static_cast<std::int32_t>(n), static_cast<std::int32_t>(high_count));
+      }
+    }
+    else
+    {
+      const auto nh = static_cast<std::uint_fast32_t>(n / static_cast<std::uint_fast32_t>(UINT8_C(2)));
+
+      InputLimbIteratorType a0 = a + nh;
+      InputLimbIteratorType a1 = a + 0U;
+
+      InputLimbIteratorType b0 = b + nh;
+      InputLimbIteratorType b1 = b + 0U;
+
+      const auto is_square = (a == b);
+
+      // The product a1*b1 is located at r[0 ... n - 1].
+      if(high_count >= n)
+      {
+        eval_multiply_kara_n_by_n_to_2n(r, a1, b1, nh, t);
+
+        std::fill(r + n, r + high_count, static_cast<typename std::iterator_traits<OutputLimbIteratorType>::value_type>(UINT8_C(0)));
+      }
+      else
+      {
+        eval_multiply_kara_n_by_n_to_high(r, a1, b1, nh, high_count, t);
+      }
+
+      // The products a1*b0 and a0*b1 are located at r[nh ... nh + n - 1].
+      if(high_count > nh)
+      {
+        const auto hx = (std::min)(static_cast<std::uint_fast32_t>(high_count - nh), n);
+
+        eval_multiply_kara_n_by_n_to_high(t, a1, b0, nh, hx, t + n);
+        eval_multiply_kara_add_high(r, nh, t, hx);
+
+        if(!is_square)
+        {
+          eval_multiply_kara_n_by_n_to_high(t, a0, b1, nh, hx, t + n);
+        }
+
+        eval_multiply_kara_add_high(r, nh, t, hx);
+      }
+
+      // The product a0*b0 is located at r[n ... 2n - 1].
+      if(high_count > n)
+      {
+        const auto hz = static_cast<std::uint_fast32_t>(high_count - n);
+
+        eval_multiply_kara_n_by_n_to_high(t, a0, b0, nh, hz, t + n);
+        eval_multiply_kara_add_high(r, n, t, hz);
+      }
+    }
+  }
+
+  #if defined(WIDE_DECIMAL_MUL_PARALLEL)
+  constexpr auto eval_multiply_kara_parallel_min_elems() -> std::uint_fast32_t { return static_cast<std::uint_fast32_t>(UINT16_C(256)); }
+
+  inline auto eval_multiply_kara_parallel_levels(const std::uint_fast32_t n) -> std::uint_fast32_t
+  {
+    // Get the number of top recursion levels whose sub-products
+    // are carried out as tasks: one level from the size
+    // eval_multiply_kara_parallel_min_elems() on (3 tasks)
+    // and two levels from twice that size on (9 tasks).
+    return
+      static_cast<std::uint_fast32_t>
+      (
+        ((n < eval_multiply_kara_parallel_min_elems()) || ((n % 2U) != static_cast<std::uint_fast32_t>(UINT8_C(0))))
+          ? UINT8_C(0)
+          : (((n < (eval_multiply_kara_parallel_min_elems() * 2U)) || ((n % 4U) != static_cast<std::uint_fast32_t>(UINT8_C(0))))
+              ? UINT8_C(1)
+              : UINT8_C(2))
+      );
+  }
+
+  inline auto eval_multiply_kara_parallel_temp_elems(const std::uint_fast32_t n, const std::uint_fast32_t levels) -> std::size_t // NOLINT(misc-no-recursion)
+  {
+    // Each parallel level of size n uses 4n limbs for the copy of the
+    // outer products, the differences and the middle product, followed
+    // by the temporary storage of its three sub-products. The serial
+    // Karatsuba multiplication of size n uses less than 4n limbs.
+    return
+      static_cast<std::size_t>
+      (
+          static_cast<std::size_t>(static_cast<std::size_t>(n) * static_cast<std::size_t>(UINT8_C(4)))
+        + ((levels == static_cast<std::uint_fast32_t>(UINT8_C(0)))
+            ? static_cast<std::size_t>(UINT8_C(0))
+            : static_cast<std::size_t>(static_cast<std::size_t>(UINT8_C(3)) * eval_multiply_kara_parallel_temp_elems(static_cast<std::uint_fast32_t>(n / 2U), static_cast<std::uint_fast32_t>(levels - 1U))))
+      );
+  }
+
+  inline auto eval_multiply_kara_parallel_temp_elems(const std::uint_fast32_t n) -> std::size_t
+  {
+    // Get the size of the temporary storage t
+    // for eval_multiply_kara_n_by_n_to_2n_parallel.
+    const auto levels = eval_multiply_kara_parallel_levels(n);
+
+    return
+      ((levels == static_cast<std::uint_fast32_t>(UINT8_C(0)))
+        ? static_cast<std::size_t>(static_cast<std::size_t>(n) * static_cast<std::size_t>(UINT8_C(4)))
+        : eval_multiply_kara_parallel_temp_elems(n, levels));
+  }
+
+  template<typename LimbType>
+  struct eval_multiply_kara_task
+  {
+          LimbType*          r;
+    const LimbType*          a;
+    const LimbType*          b;
+          std::uint_fast32_t n;
+          std::uint_fast32_t high_count; // Zero for the full product.
+          LimbType*          t;
+  };
+
+  template<typename LimbType,
+           typename TaskArrayType>
+  auto eval_multiply_kara_parallel_split(      LimbType*          r, // NOLINT(misc-no-recursion)
+                                         const LimbType*          a,
+                                         const LimbType*          b,
+                                         const std::uint_fast32_t n,
+                                               LimbType*          t,
+                                         const std::uint_fast32_t levels,
+                                               TaskArrayType&     tasks,
+                                               std::size_t&       task_count) -> void
+  {
+    // Compute the differences |a1-a0| and |b0-b1| of the parallel
+    // levels and collect the sub-products of the lowest parallel
+    // level as tasks. The layout of t at each parallel level is
+    // [copy of r (2n), |a1-a0| (n/2), |b0-b1| (n/2), middle product (n),
+    // temporary storage of the three sub-products].
+
+    if(levels == static_cast<std::uint_fast32_t>(UINT8_C(0)))
+    {
+      tasks[task_count] = { r, a, b, n, static_cast<std::uint_fast32_t>(UINT8_C(0)), t };
+
+      ++task_count;
+
+      return;
+    }
+
+    const auto nh = static_cast<std::uint_fast32_t>(n / static_cast<std::uint_fast32_t>(UINT8_C(2)));
+
+    const LimbType* a0 = a + nh; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const LimbType* a1 = a;
+    const LimbType* b0 = b + nh; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const LimbType* b1 = b;
+
+    LimbType* d_a   = t + static_cast<std::size_t>(static_cast<std::size_t>(n) * static_cast<std::size_t>(UINT8_C(2))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    LimbType* d_b   = d_a + nh;                                                                                         // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    LimbType* t_mid = d_b + nh;                                                                                         // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    LimbType* t_sub = t_mid + n;                                                                                        // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    const auto t_sub_size = eval_multiply_kara_parallel_temp_elems(nh, static_cast<std::uint_fast32_t>(levels - 1U));
+
+    const auto is_square = (a == b);
+
+    // The differences are set to zero for equal halves, since
+    // their (unused) middle product is computed nonetheless.
+    const auto subtract_abs =
+      [&nh](LimbType* d, const LimbType* u, const LimbType* v, const std::int_fast8_t cmp_result_uv)
+      {
+        if(cmp_result_uv == static_cast<std::int_fast8_t>(INT8_C(1)))
+        {
+          static_cast<void>(detail::eval_subtract_n(d, u, v, static_cast<std::int32_t>(nh)));
+        }
+        else if(cmp_result_uv == static_cast<std::int_fast8_t>(INT8_C(-1)))
+        {
+          static_cast<void>(detail::eval_subtract_n(d, v, u, static_cast<std::int32_t>(nh)));
+        }
+        else
+        {
+          std::fill(d, d + nh, static_cast<LimbType>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+      };
+
+    subtract_abs(d_a, a1, a0, detail::compare_ranges(a1, a0, nh));
+
+    if(!is_square)
+    {
+      subtract_abs(d_b, b0, b1, detail::compare_ranges(b0, b1, nh));
+    }
+
+    eval_multiply_kara_parallel_split(r,     a1,  b1,                      nh, t_sub,                   static_cast<std::uint_fast32_t>(levels - 1U), tasks, task_count);
+    eval_multiply_kara_parallel_split(r + n, a0,  b0,                      nh, t_sub + t_sub_size,      static_cast<std::uint_fast32_t>(levels - 1U), tasks, task_count); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    eval_multiply_kara_parallel_split(t_mid, d_a, (is_square ? d_a : d_b), nh, t_sub + (t_sub_size * 2U), static_cast<std::uint_fast32_t>(levels - 1U), tasks, task_count); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
+  template<typename LimbType>
+  auto eval_multiply_kara_parallel_join(      LimbType*          r, // NOLINT(misc-no-recursion)
+                                        const LimbType*          a,
+                                        const LimbType*          b,
+                                        const std::uint_fast32_t n,
+                                              LimbType*          t,
+                                        const std::uint_fast32_t levels) -> void
+  {
+    // Combine the sub-products of the parallel levels
+    // from the lowest level upward (see Steps 2 and 6
+    // of eval_multiply_kara_n_by_n_to_2n).
+
+    if(levels == static_cast<std::uint_fast32_t>(UINT8_C(0)))
+    {
+      return;
+    }
+
+    const auto nh = static_cast<std::uint_fast32_t>(n / static_cast<std::uint_fast32_t>(UINT8_C(2)));
+
+    const LimbType* a0 = a + nh; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const LimbType* a1 = a;
+    const LimbType* b0 = b + nh; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const LimbType* b1 = b;
+
+    LimbType* d_a   = t + static_cast<std::size_t>(static_cast<std::size_t>(n) * static_cast<std::size_t>(UINT8_C(2))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    LimbType* d_b   = d_a + nh;                                                                                         // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    LimbType* t_mid = d_b + nh;                                                                                         // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    LimbType* t_sub = t_mid + n;                                                                                        // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    const auto t_sub_size = eval_multiply_kara_parallel_temp_elems(nh, static_cast<std::uint_fast32_t>(levels - 1U));
+
+    const auto is_square = (a == b);
+
+    eval_multiply_kara_parallel_join(r,     a1,  b1,                      nh, t_sub,                     static_cast<std::uint_fast32_t>(levels - 1U));
+    eval_multiply_kara_parallel_join(r + n, a0,  b0,                      nh, t_sub + t_sub_size,        static_cast<std::uint_fast32_t>(levels - 1U)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    eval_multiply_kara_parallel_join(t_mid, d_a, (is_square ? d_a : d_b), nh, t_sub + (t_sub_size * 2U), static_cast<std::uint_fast32_t>(levels - 1U)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    const auto cmp_result_a1a0 = detail::compare_ranges(a1, a0, nh);
+
+    const auto cmp_result_b0b1 =
+      (is_square ? static_cast<std::int_fast8_t>(-cmp_result_a1a0) : detail::compare_ranges(b0, b1, nh));
+
+    eval_multiply_kara_add_outer(r, n, t);
+
+    eval_multiply_kara_add_middle(r, n, t_mid, static_cast<std::int_fast8_t>(cmp_result_a1a0 * cmp_result_b0b1));
+  }
+
+  template<typename LimbType>
+  auto eval_multiply_kara_n_by_n_to_2n_parallel(      LimbType*          r,
+                                                const LimbType*          a,
+                                                const LimbType*          b,
+                                                const std::uint_fast32_t n,
+                                                      LimbType*          t) -> void
+  {
+    // This is the multithreaded version of eval_multiply_kara_n_by_n_to_2n,
+    // which gives identical results. The sub-products of the top one or two
+    // recursion levels are carried out concurrently on the thread pool
+    // of the multithreaded FFT, each with its own temporary storage.
+    // The temporary storage t has eval_multiply_kara_parallel_temp_elems(n)
+    // elements.
+
+    const auto levels = eval_multiply_kara_parallel_levels(n);
+
+    if(levels == static_cast<std::uint_fast32_t>(UINT8_C(0)))
+    {
+      eval_multiply_kara_n_by_n_to_2n(r, a, b, n, t);
+
+      return;
+    }
+
+    using task_array_type = std::array<eval_multiply_kara_task<LimbType>, static_cast<std::size_t>(UINT8_C(9))>;
+
+    task_array_type tasks { };
+
+    auto task_count = static_cast<std::size_t>(UINT8_C(0));
+
+    eval_multiply_kara_parallel_split(r, a, b, n, t, levels, tasks, task_count);
+
+    auto multiply =
+      [&tasks](const std::uint32_t task_index)
+      {
+        const auto& task = tasks[static_cast<std::size_t>(task_index)];
+
+        eval_multiply_kara_n_by_n_to_2n(task.r, task.a, task.b, task.n, task.t);
+      };
+
+    detail::fft::fft_parallel_for(static_cast<std::uint32_t>(task_count), multiply);
+
+    eval_multiply_kara_parallel_join(r, a, b, n, t, levels);
+  }
 
-    constexpr auto local_elem_mask_half =
-      static_cast<local_limb_type>(decwide_t_helper_base<local_limb_type>::elem_mask_half);
+  inline auto eval_multiply_kara_high_parallel_temp_elems(const std::uint_fast32_t n) -> std::size_t
+  {
+    // Get the size of the temporary storage t
+    // for eval_multiply_kara_n_by_n_to_high_parallel.
+    // The layout of t is [a1*b0 (n), a0*b1 (n), temporary
+    // storage of a1*b0 (2n), temporary storage of a0*b1 (2n),
+    // temporary storage of a1*b1].
+    const auto nh = static_cast<std::uint_fast32_t>(n / static_cast<std::uint_fast32_t>(UINT8_C(2)));
+
+    return
+      ((eval_multiply_kara_parallel_levels(n) == static_cast<std::uint_fast32_t>(UINT8_C(0)))
+        ? static_cast<std::size_t>(static_cast<std::size_t>(n) * static_cast<std::size_t>(UINT8_C(4)))
+        : (std::max)(static_cast<std::size_t>(static_cast<std::size_t>(static_cast<std::size_t>(n) * static_cast<std::size_t>(UINT8_C(6))) + eval_multiply_kara_parallel_temp_elems(nh)),
+                     eval_multiply_kara_parallel_temp_elems(n)));
+  }
+
+  template<typename LimbType>
+  auto eval_multiply_kara_n_by_n_to_high_parallel(      LimbType*          r,
+                                                  const LimbType*          a,
+                                                  const LimbType*          b,
+                                                  const std::uint_fast32_t n,
+                                                  const std::uint_fast32_t high_count,
+                                                        LimbType*          t) -> void
+  {
+    // This is the multithreaded version of eval_multiply_kara_n_by_n_to_high,
+    // which gives identical results. The products a1*b1 (possibly split
+    // into the sub-products of its top Karatsuba level), a1*b0 and a0*b1
+    // of the top recursion level are carried out concurrently. The short
+    // product a0*b0, which has only a few limbs, is computed afterwards.
+    // The temporary storage t has eval_multiply_kara_high_parallel_temp_elems(n)
+    // elements.
+
+    if(high_count >= static_cast<std::uint_fast32_t>(n * 2U))
+    {
+      eval_multiply_kara_n_by_n_to_2n_parallel(r, a, b, n, t);
+
+      return;
+    }
+
+    if((eval_multiply_kara_parallel_levels(n) == static_cast<std::uint_fast32_t>(UINT8_C(0))) || (high_count <= n / 2U))
+    {
+      eval_multiply_kara_n_by_n_to_high(r, a, b, n, high_count, t);
+
+      return;
+    }
+
+    const auto nh = static_cast<std::uint_fast32_t>(n / static_cast<std::uint_fast32_t>(UINT8_C(2)));
+
+    const LimbType* a0 = a + nh; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const LimbType* a1 = a;
+    const LimbType* b0 = b + nh; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const LimbType* b1 = b;
+
+    LimbType* tx     = t;                                                                                                    // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    LimbType* ty     = tx + n;                                                                                               // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    LimbType* tx_sub = ty + n;                                                                                               // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    LimbType* ty_sub = tx_sub + static_cast<std::size_t>(static_cast<std::size_t>(n) * static_cast<std::size_t>(UINT8_C(2))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    LimbType* t_a1b1 = ty_sub + static_cast<std::size_t>(static_cast<std::size_t>(n) * static_cast<std::size_t>(UINT8_C(2))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    const auto is_square = (a == b);
+
+    const auto a1b1_is_full = (high_count >= n);
+
+    const auto a1b1_levels =
+      (a1b1_is_full ? eval_multiply_kara_parallel_levels(nh) : static_cast<std::uint_fast32_t>(UINT8_C(0)));
+
+    const auto hx = (std::min)(static_cast<std::uint_fast32_t>(high_count - nh), n);
+
+    using task_array_type = std::array<eval_multiply_kara_task<LimbType>, static_cast<std::size_t>(UINT8_C(11))>;
+
+    task_array_type tasks { };
+
+    auto task_count = static_cast<std::size_t>(UINT8_C(0));
+
+    if(a1b1_levels != static_cast<std::uint_fast32_t>(UINT8_C(0)))
+    {
+      eval_multiply_kara_parallel_split(r, a1, b1, nh, t_a1b1, a1b1_levels, tasks, task_count);
+    }
+    else
+    {
+      tasks[task_count] = { r, a1, b1, nh, (a1b1_is_full ? static_cast<std::uint_fast32_t>(UINT8_C(0)) : high_count), t_a1b1 };
+
+      ++task_count;
+    }
+
+    tasks[task_count] = { tx, a1, b0, nh, hx, tx_sub };
+
+    ++task_count;
+
+    if(!is_square)
+    {
+      tasks[task_count] = { ty, a0, b1, nh, hx, ty_sub };
+
+      ++task_count;
+    }
+
+    auto multiply =
+      [&tasks](const std::uint32_t task_index)
+      {
+        const auto& task = tasks[static_cast<std::size_t>(task_index)];
+
+        if(task.high_count == static_cast<std::uint_fast32_t>(UINT8_C(0)))
+        {
+          eval_multiply_kara_n_by_n_to_2n(task.r, task.a, task.b, task.n, task.t);
+        }
+        else
+        {
+          eval_multiply_kara_n_by_n_to_high(task.r, task.a, task.b, task.n, task.high_count, task.t);
+        }
+      };
+
+    detail::fft::fft_parallel_for(static_cast<std::uint32_t>(task_count), multiply);
+
+    eval_multiply_kara_parallel_join(r, a1, b1, nh, t_a1b1, a1b1_levels);
+
+    if(a1b1_is_full)
+    {
+      std::fill(r + n, r + high_count, static_cast<LimbType>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    eval_multiply_kara_add_high(r, nh, tx, hx);
+    eval_multiply_kara_add_high(r, nh, (is_square ? tx : ty), hx);
+
+    if(high_count > n)
+    {
+      const auto hz = static_cast<std::uint_fast32_t>(high_count - n);
+
+      eval_multiply_kara_n_by_n_to_high(tx, a0, b0, nh, hz, tx_sub);
+      eval_multiply_kara_add_high(r, n, tx, hz);
+    }
+  }
+  #endif
+
+  template<typename LimbIteratorType>
+  auto eval_multiply_toom3_signed_add(      LimbIteratorType   r,
+                                            LimbIteratorType   u,
+                                      const bool               u_is_neg,
+                                            LimbIteratorType   v,
+                                      const bool               v_is_neg,
+                                      const std::uint_fast32_t count) -> bool
+  {
+    // Compute the signed sum r = u + v, where the operands u and v
+    // are given in sign-magnitude form. The sign of the result is
+    // returned. The result r may be aliased with either u or v.
+
+    auto r_is_neg = u_is_neg;
+
+    if(u_is_neg == v_is_neg)
+    {
+      static_cast<void>(detail::eval_add_n(r, u, v, static_cast<std::int32_t>(count)));
+    }
+    else
+    {
+      const std::int_fast8_t cmp_result_uv = detail::compare_ranges(u, v, count);
+
+      if(cmp_result_uv == static_cast<std::int_fast8_t>(INT8_C(-1)))
+      {
+        static_cast<void>(detail::eval_subtract_n(r, v, u, static_cast<std::int32_t>(count)));
+
+        r_is_neg = v_is_neg;
+      }
+      else
+      {
+        static_cast<void>(detail::eval_subtract_n(r, u, v, static_cast<std::int32_t>(count)));
+      }
+    }
+
+    return r_is_neg;
+  }
+
+  template<typename InputLimbIteratorType,
+           typename TempLimbIteratorType>
+  auto eval_multiply_toom3_evaluate(      TempLimbIteratorType  p1,
+                                          TempLimbIteratorType  pm1,
+                                          TempLimbIteratorType  pm2,
+                                          TempLimbIteratorType  x,
+                                          InputLimbIteratorType a,
+                                    const std::uint_fast32_t    k,
+                                          bool&                 pm1_is_neg,  // NOLINT(google-runtime-references)
+                                          bool&                 pm2_is_neg) -> void // NOLINT(google-runtime-references)
+  {
+    // Evaluate the polynomial a(x) = a2*x^2 + a1*x + a0 at the points
+    // x = 1, x = -1 and x = -2. Each of the results has (k + 1) limbs,
+    // the uppermost of which is small. The values at x = -1 and x = -2
+    // can be negative and are returned in sign-magnitude form.
+
+    using local_limb_type = typename std::iterator_traits<TempLimbIteratorType>::value_type;
+
+    const auto kp = static_cast<std::uint_fast32_t>(k + static_cast<std::uint_fast32_t>(UINT8_C(1)));
+
+    InputLimbIteratorType a2 = a + 0U;
+    InputLimbIteratorType a1 = a + k;
+    InputLimbIteratorType a0 = a + static_cast<std::size_t>(static_cast<std::size_t>(k) * static_cast<std::size_t>(UINT8_C(2)));
+
+    // p1 = a0 + a2
+    p1[0U] = detail::eval_add_n(p1 + 1U, a0, a2, static_cast<std::int32_t>(k));
+
+    // pm1 = (a0 + a2) - a1 = a(-1)
+    x[0U] = static_cast<local_limb_type>(UINT8_C(0));
+    std::copy(a1, a1 + k, x + 1U);
+
+    pm1_is_neg = eval_multiply_toom3_signed_add(pm1, p1, false, x, true, kp);
+
+    // p1 = (a0 + a2) + a1 = a(1)
+    static_cast<void>(detail::eval_add_n(p1, p1, x, static_cast<std::int32_t>(kp)));
+
+    // pm2 = 2 * (a(-1) + a2) - a0 = a(-2)
+    std::copy(a2, a2 + k, x + 1U);
+
+    pm2_is_neg = eval_multiply_toom3_signed_add(pm2, pm1, pm1_is_neg, x, false, kp);
+
+    static_cast<void>(detail::mul_loop_n(pm2, static_cast<local_limb_type>(UINT8_C(2)), static_cast<std::int32_t>(kp)));
+
+    std::copy(a0, a0 + k, x + 1U);
+
+    pm2_is_neg = eval_multiply_toom3_signed_add(pm2, pm2, pm2_is_neg, x, true, kp);
+  }
+
+  template<typename TempLimbIteratorType>
+  auto eval_multiply_toom3_point_fixup(      TempLimbIteratorType w,
+                                             TempLimbIteratorType pa,
+                                             TempLimbIteratorType pb,
+                                       const std::uint_fast32_t   k,
+                                             TempLimbIteratorType s) -> void
+  {
+    // Complete the (k + 1)-by-(k + 1) point-product w = pa * pb,
+    // having 2 * (k + 1) limbs, for which the k-by-k product of the
+    // lower limbs of pa and pb has already been stored in w + 2.
+    // The uppermost limbs of pa and pb are small, so that the
+    // missing cross terms are handled with scalar multiplication.
+
+    using local_limb_type = typename std::iterator_traits<TempLimbIteratorType>::value_type;
+
+    const auto kp = static_cast<std::uint_fast32_t>(k + static_cast<std::uint_fast32_t>(UINT8_C(1)));
+
+    w[0U] = static_cast<local_limb_type>(UINT8_C(0));
+    w[1U] = static_cast<local_limb_type>(pa[0U] * pb[0U]);
+
+    if(pa[0U] != static_cast<local_limb_type>(UINT8_C(0)))
+    {
+      s[0U] = static_cast<local_limb_type>(UINT8_C(0));
+      std::copy(pb + 1U, pb + kp, s + 1U);
+
+      static_cast<void>(detail::mul_loop_n(s, pa[0U], static_cast<std::int32_t>(kp)));
+
+      w[0U] = static_cast<local_limb_type>(w[0U] + detail::eval_add_n(w + 1U, w + 1U, s, static_cast<std::int32_t>(kp)));
+    }
+
+    if(pb[0U] != static_cast<local_limb_type>(UINT8_C(0)))
+    {
+      s[0U] = static_cast<local_limb_type>(UINT8_C(0));
+      std::copy(pa + 1U, pa + kp, s + 1U);
+
+      static_cast<void>(detail::mul_loop_n(s, pb[0U], static_cast<std::int32_t>(kp)));
+
+      w[0U] = static_cast<local_limb_type>(w[0U] + detail::eval_add_n(w + 1U, w + 1U, s, static_cast<std::int32_t>(kp)));
+    }
+  }
+
+  template<typename InputLimbIteratorType,
+           typename OutputLimbIteratorType,
+           typename TempLimbIteratorType>
+  auto eval_multiply_toom3_n_by_n_to_2n(      OutputLimbIteratorType r, // NOLINT(misc-no-recursion,readability-function-cognitive-complexity)
+                                              InputLimbIteratorType  a,
+                                              InputLimbIteratorType  b,
+                                        const std::uint_fast32_t     n,
+                                              TempLimbIteratorType   t) -> void
+  {
+    if(   (static_cast<std::uint_fast32_t>(n % static_cast<std::uint_fast32_t>(UINT8_C(3))) != static_cast<std::uint_fast32_t>(UINT8_C(0)))
+       || (n < static_cast<std::uint_fast32_t>(UINT16_C(384))))
+    {
+      detail::eval_multiply_kara_n_by_n_to_2n(r, a, b, n, t);
+    }
+    else
+    {
+      // Toom-Cook 3-way multiplication. The evaluation sequence
+      // and the interpolation sequence are based on the work of
+      // M. Bodrato, "Towards Optimal Toom-Cook Multiplication
+      // for Univariate and Multivariate Polynomials in Characteristic
+      // 2 and 0", in: "WAIFI'07 proceedings" (C. Carlet and B. Sunar, eds.),
+      // LNCS#4547, Springer, Madrid, Spain, June 2007, pp. 116-133.
+
+      // Here we visualize a and b in three components 2,1,0 corresponding
+      // to the high, middle and low order parts, respectively. With X being
+      // the limb base raised to the power of k = n/3, we have
+      //   a = a2*X^2 + a1*X + a0 and b = b2*X^2 + b1*X + b0.
+
+      // Step 1
+      // Evaluate a and b at the points 1, -1 and -2.
+      // The values at -1 and -2 are kept in sign-magnitude form.
+
+      // Step 2
+      // Calculate the five point-products w(0) = a0*b0, w(1), w(-1),
+      // w(-2) and w(inf) = a2*b2 recursively. Each point-product
+      // has 2k + 2 limbs.
+
+      // For squaring (a == b), b is not evaluated in step 1 and the
+      // point-products in step 2 are squares of the values of a.
+
+      // Step 3
+      // Interpolate the coefficients c0...c4 of the product
+      // polynomial w(x) = c4*x^4 + c3*x^3 + c2*x^2 + c1*x + c0.
+      //   c3 = (w(-2) - w(1)) / 3
+      //   c1 = (w(1) - w(-1)) / 2
+      //   c2 = w(-1) - w(0)
+      //   c3 = (c2 - c3) / 2 + 2*w(inf)
+      //   c2 = c2 + c1 - w(inf)
+      //   c1 = c1 - c3
+      // All of the divisions are exact.
+
+      // Step 4
+      // Recompose the result r = w(X) from the coefficients.
+
+      // The temporary storage t requires 17*(k + 1) limbs for this
+      // level plus the storage needed for the recursive point-products.
+      // A total of 10n limbs is sufficient for all levels.
+
+      using local_limb_type = typename std::iterator_traits<InputLimbIteratorType>::value_type;
+
+      const auto k  = static_cast<std::uint_fast32_t>(n / static_cast<std::uint_fast32_t>(UINT8_C(3)));
+      const auto kp = static_cast<std::uint_fast32_t>(k + static_cast<std::uint_fast32_t>(UINT8_C(1)));
+      const auto wl = static_cast<std::uint_fast32_t>(kp * static_cast<std::uint_fast32_t>(UINT8_C(2)));
+
+      InputLimbIteratorType a2 = a + 0U;
+      InputLimbIteratorType a0 = a + static_cast<std::size_t>(static_cast<std::size_t>(k) * static_cast<std::size_t>(UINT8_C(2)));
+
+      InputLimbIteratorType b2 = b + 0U;
+      InputLimbIteratorType b0 = b + static_cast<std::size_t>(static_cast<std::size_t>(k) * static_cast<std::size_t>(UINT8_C(2)));
+
+      TempLimbIteratorType pa1  = t   + 0U;
+      TempLimbIteratorType pam1 = pa1  + kp;
+      TempLimbIteratorType pam2 = pam1 + kp;
+      TempLimbIteratorType pb1  = pam2 + kp;
+      TempLimbIteratorType pbm1 = pb1  + kp;
+      TempLimbIteratorType pbm2 = pbm1 + kp;
+      TempLimbIteratorType x    = pbm2 + kp;
+      TempLimbIteratorType w0   = x    + kp;
+      TempLimbIteratorType w1   = w0   + wl;
+      TempLimbIteratorType wm1  = w1   + wl;
+      TempLimbIteratorType wm2  = wm1  + wl;
+      TempLimbIteratorType w4   = wm2  + wl;
+      TempLimbIteratorType tr   = w4   + wl;
+
+      // Step 1
+      auto pam1_is_neg = false;
+      auto pam2_is_neg = false;
+      auto pbm1_is_neg = false;
+      auto pbm2_is_neg = false;
+
+      eval_multiply_toom3_evaluate(pa1, pam1, pam2, x, a, k, pam1_is_neg, pam2_is_neg);
+
+      if(a == b)
+      {
+        pb1  = pa1;
+        pbm1 = pam1;
+        pbm2 = pam2;
+
+        pbm1_is_neg = pam1_is_neg;
+        pbm2_is_neg = pam2_is_neg;
+      }
+      else
+      {
+        eval_multiply_toom3_evaluate(pb1, pbm1, pbm2, x, b, k, pbm1_is_neg, pbm2_is_neg);
+      }
+
+      // Step 2
+      w0[0U] = static_cast<local_limb_type>(UINT8_C(0));
+      w0[1U] = static_cast<local_limb_type>(UINT8_C(0));
+      eval_multiply_toom3_n_by_n_to_2n(w0 + 2U, a0, b0, k, tr);
+
+      w4[0U] = static_cast<local_limb_type>(UINT8_C(0));
+      w4[1U] = static_cast<local_limb_type>(UINT8_C(0));
+      eval_multiply_toom3_n_by_n_to_2n(w4 + 2U, a2, b2, k, tr);
+
+      eval_multiply_toom3_n_by_n_to_2n(w1 + 2U, pa1 + 1U, pb1 + 1U, k, tr);
+      eval_multiply_toom3_point_fixup (w1, pa1, pb1, k, x);
+
+      eval_multiply_toom3_n_by_n_to_2n(wm1 + 2U, pam1 + 1U, pbm1 + 1U, k, tr);
+      eval_multiply_toom3_point_fixup (wm1, pam1, pbm1, k, x);
+
+      eval_multiply_toom3_n_by_n_to_2n(wm2 + 2U, pam2 + 1U, pbm2 + 1U, k, tr);
+      eval_multiply_toom3_point_fixup (wm2, pam2, pbm2, k, x);
+
+      auto w1_is_neg  = false;
+      auto wm1_is_neg = (pam1_is_neg != pbm1_is_neg);
+      auto wm2_is_neg = (pam2_is_neg != pbm2_is_neg);
+
+      // Step 3
+      wm2_is_neg = eval_multiply_toom3_signed_add(wm2, wm2, wm2_is_neg, w1, true, wl);
+      static_cast<void>(detail::div_loop_n(wm2, static_cast<local_limb_type>(UINT8_C(3)), static_cast<std::int32_t>(wl), static_cast<local_limb_type>(UINT8_C(0))));
+
+      w1_is_neg = eval_multiply_toom3_signed_add(w1, w1, w1_is_neg, wm1, (!wm1_is_neg), wl);
+      static_cast<void>(detail::div_loop_n(w1, static_cast<local_limb_type>(UINT8_C(2)), static_cast<std::int32_t>(wl), static_cast<local_limb_type>(UINT8_C(0))));
+
+      wm1_is_neg = eval_multiply_toom3_signed_add(wm1, wm1, wm1_is_neg, w0, true, wl);
+
+      wm2_is_neg = eval_multiply_toom3_signed_add(wm2, wm1, wm1_is_neg, wm2, (!wm2_is_neg), wl);
+      static_cast<void>(detail::div_loop_n(wm2, static_cast<local_limb_type>(UINT8_C(2)), static_cast<std::int32_t>(wl), static_cast<local_limb_type>(UINT8_C(0))));
+      wm2_is_neg = eval_multiply_toom3_signed_add(wm2, wm2, wm2_is_neg, w4, false, wl);
+      wm2_is_neg = eval_multiply_toom3_signed_add(wm2, wm2, wm2_is_neg, w4, false, wl);
+
+      wm1_is_neg = eval_multiply_toom3_signed_add(wm1, wm1, wm1_is_neg, w1, w1_is_neg, wl);
+      static_cast<void>(eval_multiply_toom3_signed_add(wm1, wm1, wm1_is_neg, w4, true, wl));
+
+      static_cast<void>(eval_multiply_toom3_signed_add(w1, w1, w1_is_neg, wm2, (!wm2_is_neg), wl));
+
+      // Step 4
+      const auto n2 = static_cast<std::uint_fast32_t>(k * static_cast<std::uint_fast32_t>(UINT8_C(2)));
+      const auto n4 = static_cast<std::uint_fast32_t>(k * static_cast<std::uint_fast32_t>(UINT8_C(4)));
+
+      std::copy(w4 + 2U, w4 + wl, r);
+      std::fill(r + n2, r + n4, static_cast<local_limb_type>(UINT8_C(0)));
+      std::copy(w0 + 2U, w0 + wl, r + n4);
+
+      // The coefficient c_j has 2k + 2 limbs and is added to r
+      // at the offset ((4 - j) * k) - 2, for j = 3, 2, 1.
+      const auto r_offset_c3 = static_cast<std::uint_fast32_t>(k  - static_cast<std::uint_fast32_t>(UINT8_C(2)));
+      const auto r_offset_c2 = static_cast<std::uint_fast32_t>(n2 - static_cast<std::uint_fast32_t>(UINT8_C(2)));
+      const auto r_offset_c1 = static_cast<std::uint_fast32_t>(n2 + r_offset_c3);
+
+      local_limb_type carry;
+      carry = detail::eval_add_n(r + r_offset_c3, r + r_offset_c3, wm2, static_cast<std::int32_t>(wl));
+      eval_multiply_kara_propagate_carry(r, r_offset_c3, carry);
+      carry = detail::eval_add_n(r + r_offset_c2, r + r_offset_c2, wm1, static_cast<std::int32_t>(wl));
+      eval_multiply_kara_propagate_carry(r, r_offset_c2, carry);
+      carry = detail::eval_add_n(r + r_offset_c1, r + r_offset_c1, w1, static_cast<std::int32_t>(wl));
+      eval_multiply_kara_propagate_carry(r, r_offset_c1, carry);
+    }
+  }
+
+  template<typename InputLimbIteratorType,
+           typename FftFloatIteratorType>
+  auto mul_loop_fft_load(      FftFloatIteratorType  af,
+                               InputLimbIteratorType u,
+                         const std::int32_t          prec_elems_for_multiply,
+                         const std::uint32_t         pair_first,
+                         const std::uint32_t         pair_last) -> void
+  {
+    // Load the pairs of real points [pair_first, pair_last) of af.
+    // Each limb of u is split into its high and low halves (one pair),
+    // or into four quarters (two pairs) for 64-bit limbs. The pairs
+    // beyond the limbs of u are set to zero.
+
+    using local_limb_type = typename std::iterator_traits<InputLimbIteratorType>::value_type;
+
+    constexpr auto local_pairs_per_limb =
+      static_cast<std::uint32_t>(decwide_t_helper_base<local_limb_type>::fft_points_per_limb / 2U);
+
+    static_assert((local_pairs_per_limb == 1U) || (local_pairs_per_limb == 2U),
+                  "Error: Each limb must be split into one or two pairs of FFT points");
+
+    constexpr auto local_point_mask =
+      static_cast<local_limb_type>(decwide_t_helper_base<local_limb_type>::fft_point_mask);
+
+    constexpr auto local_pair_mask =
+      static_cast<local_limb_type>(local_point_mask * local_point_mask);
 
     using local_fft_float_type = typename std::iterator_traits<FftFloatIteratorType>::value_type;
 
-    for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
-               i < static_cast<std::uint32_t>(prec_elems_for_multiply);
+    const auto prec_pairs = static_cast<std::uint32_t>(static_cast<std::uint32_t>(prec_elems_for_multiply) * local_pairs_per_limb);
+
+    for(auto   i = pair_first;
+               i < (std::min)(pair_last, prec_pairs);
              ++i)
     {
-      af[ i * 2U]       = static_cast<local_fft_float_type>(u[i] / local_elem_mask_half); // NOLINT(bugprone-integer-division)
-      af[(i * 2U) + 1U] = static_cast<local_fft_float_type>(u[i] % local_elem_mask_half);
+      // For two pairs per limb, the even pair is the more significant one.
+      const auto pair_value =
+        static_cast<local_limb_type>
+        (
+          (local_pairs_per_limb == 1U)
+            ? u[i]
+            : (((i % 2U) == 0U) ? static_cast<local_limb_type>(u[i / 2U] / local_pair_mask) // NOLINT(bugprone-integer-division)
+                                : static_cast<local_limb_type>(u[i / 2U] % local_pair_mask))
+        );
 
-      bf[ i * 2U]       = static_cast<local_fft_float_type>(v[i] / local_elem_mask_half); // NOLINT(bugprone-integer-division)
-      bf[(i * 2U) + 1U] = static_cast<local_fft_float_type>(v[i] % local_elem_mask_half);
+      af[ i * 2U]       = static_cast<local_fft_float_type>(pair_value / local_point_mask); // NOLINT(bugprone-integer-division)
+      af[(i * 2U) + 1U] = static_cast<local_fft_float_type>(pair_value % local_point_mask);
     }
 
-    const auto fill_distance =
-      static_cast<std::size_t>
+    const auto zero_first = (std::max)(pair_first, prec_pairs);
+
+    if(zero_first < pair_last)
+    {
+      std::fill(af + (zero_first * 2U), af + (pair_last * 2U), static_cast<local_fft_float_type>(0));
+    }
+  }
+
+  template<typename FftFloatIteratorType,
+           typename FftFloatInputIteratorType>
+  auto mul_loop_fft_convolve(      FftFloatIteratorType      af,
+                                   FftFloatInputIteratorType bf,
+                             const bool                      is_square,
+                             const std::uint32_t             pair_first,
+                             const std::uint32_t             pair_last) -> void
+  {
+    // Multiply the pairs of points [pair_first, pair_last) of af
+    // by those of bf (or by themselves for squaring) in the
+    // transform space, where pair_first is at least 1. The pair 0
+    // holds two real points and is multiplied separately.
+
+    using local_fft_float_type = typename std::iterator_traits<FftFloatIteratorType>::value_type;
+
+    if(is_square)
+    {
+      for(auto j  = static_cast<std::uint32_t>(pair_first * 2U);
+               j  < static_cast<std::uint32_t>(pair_last  * 2U);
+               j += static_cast<std::uint32_t>(UINT8_C(2)))
+      {
+        const local_fft_float_type tmp_aj = af[j];
+
+        af[j + 0U] = (tmp_aj * tmp_aj) - (af[j + 1U] * af[j + 1U]);
+        af[j + 1U] = (tmp_aj * af[j + 1U]) * static_cast<local_fft_float_type>(2);
+      }
+    }
+    else
+    {
+      for(auto j  = static_cast<std::uint32_t>(pair_first * 2U);
+               j  < static_cast<std::uint32_t>(pair_last  * 2U);
+               j += static_cast<std::uint32_t>(UINT8_C(2)))
+      {
+        const local_fft_float_type tmp_aj = af[j];
+
+        af[j + 0U] = (tmp_aj * bf[j + 0U]) - (af[j + 1U] * bf[j + 1U]);
+        af[j + 1U] = (tmp_aj * bf[j + 1U]) + (af[j + 1U] * bf[j + 0U]);
+      }
+    }
+  }
+
+  template<typename OutputLimbIteratorType,
+           typename FftFloatIteratorType>
+  auto mul_loop_fft_release_carries(      OutputLimbIteratorType r,
+                                          FftFloatIteratorType   af,
+                                    const std::uint32_t          limb_first,
+                                    const std::uint32_t          limb_last,
+                                    const std::uint32_t          n_fft) -> std::uint_fast64_t
+  {
+    // Release the carries and re-combine the points (half-limbs or
+    // quarter-limbs) of the limbs [limb_first, limb_last) of r,
+    // starting with a carry of zero at the least significant limb.
+    // Return the carry out of the most significant limb (at limb_first).
+
+    using local_limb_type = typename std::iterator_traits<OutputLimbIteratorType>::value_type;
+
+    constexpr auto local_points_per_limb = decwide_t_helper_base<local_limb_type>::fft_points_per_limb;
+
+    constexpr auto local_point_mask =
+      static_cast<local_limb_type>(decwide_t_helper_base<local_limb_type>::fft_point_mask);
+
+    using local_fft_float_type = typename std::iterator_traits<FftFloatIteratorType>::value_type;
+
+    using fft_carry_type = std::uint_fast64_t;
+
+    auto carry = static_cast<fft_carry_type>(UINT8_C(0));
+
+    const auto n_fft_half =
+      static_cast<local_fft_float_type>
       (
-        static_cast<std::size_t>(prec_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(2))
+        static_cast<std::uint32_t>
+        (
+          n_fft >> static_cast<unsigned>(UINT8_C(1))
+        )
       );
 
-    std::fill(af + fill_distance, af + n_fft, static_cast<local_fft_float_type>(0));
-    std::fill(bf + fill_distance, bf + n_fft, static_cast<local_fft_float_type>(0));
+    for(auto limb = limb_last; limb > limb_first; --limb) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      // The convolution term j belongs to the least significant point
+      // of the limb. The more significant points precede it, where the
+      // term (j - k) is taken as zero for k > j.
+      const auto j = static_cast<std::uint32_t>(static_cast<std::uint32_t>(limb * local_points_per_limb) - 2U);
 
-    // Perform forward FFTs on the data arrays a and b.
-    detail::fft::rfft_lanczos_rfft<local_fft_float_type, true>(n_fft, af);
-    detail::fft::rfft_lanczos_rfft<local_fft_float_type, true>(n_fft, bf);
+      auto limb_value = static_cast<local_limb_type>(UINT8_C(0));
+      auto point_unit = static_cast<local_limb_type>(UINT8_C(1));
 
-    // Perform the convolution of a and b in the transform space.
-    // This does, in fact, execute the actual multiplication of (a * b).
-    af[0U] *= bf[0U];
-    af[1U] *= bf[1U];
+      for(auto k = static_cast<std::uint32_t>(UINT8_C(0)); k < local_points_per_limb; ++k)
+      {
+        const auto xaj   = ((k <= j) ? static_cast<local_fft_float_type>(af[j - k] / n_fft_half) : static_cast<local_fft_float_type>(0));
+        const auto x     = static_cast<fft_carry_type> (xaj + detail::fft::template_half<local_fft_float_type>()) + carry;
+                   carry = static_cast<fft_carry_type> (x / local_point_mask);
+        const auto point = static_cast<local_limb_type>(x - static_cast<fft_carry_type>(carry * local_point_mask));
+
+        limb_value = static_cast<local_limb_type>(limb_value + static_cast<local_limb_type>(point * point_unit));
+        point_unit = static_cast<local_limb_type>(point_unit * local_point_mask);
+      }
+
+      r[limb - 1U] = limb_value;
+    }
+
+    return carry;
+  }
+
+  #if (defined(WIDE_DECIMAL_MUL_PARALLEL) && !defined(WIDE_DECIMAL_DISABLE_FFT_RADIX4))
+  template<typename OutputLimbIteratorType,
+           typename FftFloatIteratorType,
+           typename FftFloatInputIteratorType>
+  auto mul_loop_fft_finish_parallel(      OutputLimbIteratorType    r,
+                                          FftFloatIteratorType      af,
+                                          FftFloatInputIteratorType bf,
+                                    const bool                      is_square,
+                                    const typename std::iterator_traits<FftFloatIteratorType>::value_type* tw,
+                                    const std::int32_t              prec_elems_for_multiply,
+                                    const std::uint32_t             n_fft) -> void
+  {
+    // This is the multithreaded version of mul_loop_fft_finish,
+    // which gives identical results. The carries are released
+    // in blocks of limbs which start with a carry of zero.
+    // The carry out of each block is then added to the next
+    // more significant block in a sequential fix-up pass.
+
+    using local_limb_type = typename std::iterator_traits<OutputLimbIteratorType>::value_type;
+
+    constexpr auto local_elem_mask = static_cast<std::uint_fast64_t>(decwide_t_helper_base<local_limb_type>::elem_mask);
+
+    using local_fft_float_type = typename std::iterator_traits<FftFloatIteratorType>::value_type;
+
+    local_fft_float_type* data[1U] = { &af[0U] }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+    const auto chunk_count = detail::fft::fft_parallel_chunk_count();
+    const auto pair_count  = static_cast<std::uint32_t>(n_fft / 2U);
+
+    // Perform the convolution in the transform space.
+    af[0U] *= (is_square ? af[0U] : bf[0U]);
+    af[1U] *= (is_square ? af[1U] : bf[1U]);
+
+    auto convolve =
+      [&](const std::uint32_t chunk)
+      {
+        mul_loop_fft_convolve(af,
+                              bf,
+                              is_square,
+                              (std::max)(detail::fft::fft_parallel_chunk_first(pair_count, chunk_count, chunk),      static_cast<std::uint32_t>(UINT8_C(1))),
+                              (std::max)(detail::fft::fft_parallel_chunk_first(pair_count, chunk_count, chunk + 1U), static_cast<std::uint32_t>(UINT8_C(1))));
+      };
+
+    detail::fft::fft_parallel_for(chunk_count, convolve);
+
+    // Perform the reverse FFT on the result of the convolution.
+    detail::fft::rfft_lanczos_rfft_parallel<local_fft_float_type, false>(n_fft, data, static_cast<std::uint32_t>(UINT8_C(1)), tw);
+
+    // Release the carries block by block.
+    const auto limb_count = static_cast<std::uint32_t>(prec_elems_for_multiply);
 
-    for(auto j  = static_cast<std::uint32_t>(UINT8_C(2));
-             j  < n_fft;
-             j += static_cast<std::uint32_t>(UINT8_C(2)))
+    std::vector<std::uint_fast64_t> carries(static_cast<std::size_t>(chunk_count));
+
+    auto release =
+      [&](const std::uint32_t chunk)
+      {
+        carries[static_cast<std::size_t>(chunk)] =
+          mul_loop_fft_release_carries(r,
+                                       af,
+                                       detail::fft::fft_parallel_chunk_first(limb_count, chunk_count, chunk),
+                                       detail::fft::fft_parallel_chunk_first(limb_count, chunk_count, chunk + 1U),
+                                       n_fft);
+      };
+
+    detail::fft::fft_parallel_for(chunk_count, release);
+
+    // Propagate the carry out of each block into the next more
+    // significant block. A carry propagating through an entire
+    // block is added to the carry out of that block. The carry
+    // out of the most significant block is discarded.
+    for(auto chunk = static_cast<std::uint32_t>(chunk_count - 1U); chunk > static_cast<std::uint32_t>(UINT8_C(0)); --chunk)
     {
-      const local_fft_float_type tmp_aj = af[j];
+      auto carry = carries[static_cast<std::size_t>(chunk)];
+
+      const auto limb_first = detail::fft::fft_parallel_chunk_first(limb_count, chunk_count, chunk - 1U);
+
+      for(auto limb = detail::fft::fft_parallel_chunk_first(limb_count, chunk_count, chunk); ((carry != static_cast<std::uint_fast64_t>(UINT8_C(0))) && (limb > limb_first)); --limb) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto sum = static_cast<std::uint_fast64_t>(static_cast<std::uint_fast64_t>(r[limb - 1U]) + carry);
+
+        carry        = static_cast<std::uint_fast64_t>(sum / local_elem_mask);
+        r[limb - 1U] = static_cast<local_limb_type>(sum - static_cast<std::uint_fast64_t>(carry * local_elem_mask));
+      }
 
-      af[j + 0U] = (tmp_aj * bf[j + 0U]) - (af[j + 1U] * bf[j + 1U]);
-      af[j + 1U] = (tmp_aj * bf[j + 1U]) + (af[j + 1U] * bf[j + 0U]);
+      carries[static_cast<std::size_t>(chunk - 1U)] += carry;
     }
+  }
+
+  template<typename InputLimbIteratorType,
+           typename FftFloatIteratorType>
+  auto mul_loop_fft_transform_parallel(      FftFloatIteratorType* data,
+                                             InputLimbIteratorType* u,
+                                       const std::uint32_t          data_count,
+                                       const typename std::iterator_traits<FftFloatIteratorType>::value_type* tw,
+                                       const std::int32_t           prec_elems_for_multiply,
+                                       const std::uint32_t          n_fft) -> void
+  {
+    // This is the multithreaded version of mul_loop_fft_transform.
+    // The data_count forward transforms of the limbs u[k] into
+    // the arrays data[k] run concurrently.
+
+    using local_fft_float_type = typename std::iterator_traits<FftFloatIteratorType>::value_type;
+
+    const auto chunk_count = detail::fft::fft_parallel_chunk_count();
+    const auto pair_count  = static_cast<std::uint32_t>(n_fft / 2U);
+
+    auto load =
+      [&](const std::uint32_t task)
+      {
+        const auto chunk = static_cast<std::uint32_t>(task % chunk_count);
+        const auto k     = static_cast<std::uint32_t>(task / chunk_count);
+
+        mul_loop_fft_load(data[k],
+                          u[k],
+                          prec_elems_for_multiply,
+                          detail::fft::fft_parallel_chunk_first(pair_count, chunk_count, chunk),
+                          detail::fft::fft_parallel_chunk_first(pair_count, chunk_count, chunk + 1U));
+      };
+
+    detail::fft::fft_parallel_for(static_cast<std::uint32_t>(data_count * chunk_count), load);
+
+    detail::fft::rfft_lanczos_rfft_parallel<local_fft_float_type, true>(n_fft, data, data_count, tw);
+  }
+  #endif
+
+  template<typename InputLimbIteratorType,
+           typename FftFloatIteratorType>
+  auto mul_loop_fft_transform(      FftFloatIteratorType  af,
+                                    InputLimbIteratorType u,
+                              const typename std::iterator_traits<FftFloatIteratorType>::value_type* tw,
+                              const std::int32_t          prec_elems_for_multiply,
+                              const std::uint32_t         n_fft) -> void
+  {
+    // Load the limbs of u (split into half-limbs) into af
+    // and perform the forward FFT on af. The transformed
+    // array can be kept and used in several products.
+
+    #if (defined(WIDE_DECIMAL_MUL_PARALLEL) && !defined(WIDE_DECIMAL_DISABLE_FFT_RADIX4))
+    if(n_fft >= detail::fft::fft_parallel_min_points())
+    {
+      FftFloatIteratorType  data[1U] = { af }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+      InputLimbIteratorType limbs[1U] = { u }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+      mul_loop_fft_transform_parallel(data, limbs, static_cast<std::uint32_t>(UINT8_C(1)), tw, prec_elems_for_multiply, n_fft);
+
+      return;
+    }
+    #endif
+
+    using local_fft_float_type = typename std::iterator_traits<FftFloatIteratorType>::value_type;
+
+    mul_loop_fft_load(af, u, prec_elems_for_multiply, static_cast<std::uint32_t>(UINT8_C(0)), static_cast<std::uint32_t>(n_fft / 2U));
+
+    detail::fft::rfft_lanczos_rfft<local_fft_float_type, true>(n_fft, af, tw);
+  }
+
+  template<typename OutputLimbIteratorType,
+           typename FftFloatIteratorType,
+           typename FftFloatInputIteratorType>
+  auto mul_loop_fft_finish(      OutputLimbIteratorType    r,
+                                 FftFloatIteratorType      af,
+                                 FftFloatInputIteratorType bf,
+                           const bool                      is_square,
+                           const typename std::iterator_traits<FftFloatIteratorType>::value_type* tw,
+                           const std::int32_t              prec_elems_for_multiply,
+                           const std::uint32_t             n_fft) -> void
+  {
+    // Multiply the transformed array af by the transformed array bf
+    // (or by itself for squaring), perform the reverse FFT and store
+    // the prec_elems_for_multiply most significant limbs in r.
+
+    #if (defined(WIDE_DECIMAL_MUL_PARALLEL) && !defined(WIDE_DECIMAL_DISABLE_FFT_RADIX4))
+    if(n_fft >= detail::fft::fft_parallel_min_points())
+    {
+      mul_loop_fft_finish_parallel(r, af, bf, is_square, tw, prec_elems_for_multiply, n_fft);
+
+      return;
+    }
+    #endif
+
+    using local_fft_float_type = typename std::iterator_traits<FftFloatIteratorType>::value_type;
+
+    // Perform the convolution in the transform space.
+    // This does, in fact, execute the actual multiplication of (a * b).
+    af[0U] *= (is_square ? af[0U] : bf[0U]);
+    af[1U] *= (is_square ? af[1U] : bf[1U]);
+
+    mul_loop_fft_convolve(af, bf, is_square, static_cast<std::uint32_t>(UINT8_C(1)), static_cast<std::uint32_t>(n_fft / 2U));
 
     // Perform the reverse FFT on the result of the convolution.
-    detail::fft::rfft_lanczos_rfft<local_fft_float_type, false>(n_fft, af);
+    detail::fft::rfft_lanczos_rfft<local_fft_float_type, false>(n_fft, af, tw);
 
     // Release the carries and re-combine the low and high parts.
     // This sets the integral data elements in the big number
     // to the result of multiplication.
-    using fft_carry_type = std::uint_fast64_t;
+    static_cast<void>(mul_loop_fft_release_carries(r, af, static_cast<std::uint32_t>(UINT8_C(0)), static_cast<std::uint32_t>(prec_elems_for_multiply), n_fft));
+  }
 
-    auto carry = static_cast<fft_carry_type>(UINT8_C(0));
+  template<typename InputLimbIteratorType,
+           typename OutputLimbIteratorType,
+           typename FftFloatIteratorType>
+  auto mul_loop_fft(      OutputLimbIteratorType r,
+                          InputLimbIteratorType  u,                       // NOLINT(bugprone-easily-swappable-parameters)
+                          InputLimbIteratorType  v,
+                          FftFloatIteratorType   af,
+                          FftFloatIteratorType   bf,
+                    const typename std::iterator_traits<FftFloatIteratorType>::value_type* tw,
+                    const std::int32_t           prec_elems_for_multiply, // NOLINT(bugprone-easily-swappable-parameters)
+                    const std::uint32_t          n_fft) -> void           // NOLINT(bugprone-easily-swappable-parameters)
+  {
+    // The twiddle table tw has (2 * n_fft) elements
+    // and is generated with detail::fft::fft_make_twiddles.
 
-    const auto recombine_size =
-      static_cast<std::int32_t>
-      (
-          static_cast<std::int32_t>(prec_elems_for_multiply * static_cast<std::int32_t>(INT8_C(2)))
-        - static_cast<std::int32_t>(INT8_C(2))
-      );
+    // For squaring (u == v), the array b is not used and
+    // only one forward FFT is needed.
+    const auto is_square = (u == v);
 
-    for(auto                           j   = static_cast<std::uint32_t>(recombine_size);
-             static_cast<std::int32_t>(j) >= static_cast<std::int32_t>(INT8_C(0)); // NOLINT(altera-id-dependent-backward-branch)
-                                       j  -= static_cast<std::uint32_t>(UINT8_C(2)))
+    #if (defined(WIDE_DECIMAL_MUL_PARALLEL) && !defined(WIDE_DECIMAL_DISABLE_FFT_RADIX4))
+    if(n_fft >= detail::fft::fft_parallel_min_points())
     {
-      const auto n_fft_half =
-        static_cast<local_fft_float_type>
+      // The two forward transforms run concurrently.
+      FftFloatIteratorType  data[2U]  = { af, bf }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+      InputLimbIteratorType limbs[2U] = { u,  v  }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+      mul_loop_fft_transform_parallel(data, limbs, static_cast<std::uint32_t>(is_square ? UINT8_C(1) : UINT8_C(2)), tw, prec_elems_for_multiply, n_fft);
+
+      mul_loop_fft_finish_parallel(r, af, bf, is_square, tw, prec_elems_for_multiply, n_fft);
+
+      return;
+    }
+    #endif
+
+    // Perform the forward FFT on the data arrays a (and b).
+    mul_loop_fft_transform(af, u, tw, prec_elems_for_multiply, n_fft);
+
+    if(!is_square)
+    {
+      mul_loop_fft_transform(bf, v, tw, prec_elems_for_multiply, n_fft);
+    }
+
+    mul_loop_fft_finish(r, af, bf, is_square, tw, prec_elems_for_multiply, n_fft);
+  }
+
+  template<typename InputLimbIteratorType,
+           typename OutputLimbIteratorType,
+           typename FftFloatIteratorType,
+           typename FftFloatInputIteratorType>
+  auto mul_loop_fft_transformed(      OutputLimbIteratorType    r,
+                                      InputLimbIteratorType     u,
+                                      FftFloatIteratorType      af,
+                                      FftFloatInputIteratorType bf,
+                                const typename std::iterator_traits<FftFloatIteratorType>::value_type* tw,
+                                const std::int32_t              prec_elems_for_multiply,
+                                const std::uint32_t             n_fft) -> void
+  {
+    // Multiply u by an operand whose forward FFT of length n_fft
+    // has already been made with mul_loop_fft_transform and is
+    // stored in bf. This saves one of the three FFTs per product.
+    // The result is identical to that of mul_loop_fft.
+
+    mul_loop_fft_transform(af, u, tw, prec_elems_for_multiply, n_fft);
+
+    mul_loop_fft_finish(r, af, bf, false, tw, prec_elems_for_multiply, n_fft);
+  }
+
+  template<typename InputLimbIteratorType,
+           typename OutputLimbIteratorType>
+  auto mul_loop_ntt(      OutputLimbIteratorType r,
+                          InputLimbIteratorType  u,                       // NOLINT(bugprone-easily-swappable-parameters)
+                          InputLimbIteratorType  v,
+                          std::uint32_t*         t,
+                    const std::uint32_t*         tw0,
+                    const std::uint32_t*         tw1,
+                    const std::uint32_t*         tw2,
+                    const std::int32_t           prec_elems_for_multiply,
+                    const std::uint32_t          n_ntt) -> void
+  {
+    // Multiply u and v (each having prec_elems_for_multiply limbs)
+    // exactly with number-theoretic transforms modulo three primes.
+    // Full limbs are transformed (half-limbs for 64-bit limbs), since
+    // the largest convolution term (prec * (ntt_point_mask - 1)^2) is
+    // well below the product of the primes for all supported transform
+    // lengths. The upper prec limbs of the (2 * prec)-limb result are
+    // stored in r, as in mul_loop_fft.
+    // The temporary storage t has (4 * n_ntt) elements. The twiddle
+    // tables tw0, tw1 and tw2 of the three primes must have been made
+    // for (at least) the length n_ntt (see ntt_make_twiddles).
+
+    using local_limb_type = typename std::iterator_traits<OutputLimbIteratorType>::value_type;
+
+    constexpr auto local_points_per_limb = decwide_t_helper_base<local_limb_type>::ntt_points_per_limb;
+
+    constexpr auto local_point_mask = static_cast<std::uint64_t>(decwide_t_helper_base<local_limb_type>::ntt_point_mask);
+
+    std::uint32_t* r0 = t;                                                               // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::uint32_t* r1 = t + static_cast<std::size_t>(n_ntt * static_cast<std::uint32_t>(UINT8_C(1))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::uint32_t* r2 = t + static_cast<std::size_t>(n_ntt * static_cast<std::uint32_t>(UINT8_C(2))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::uint32_t* b  = t + static_cast<std::size_t>(n_ntt * static_cast<std::uint32_t>(UINT8_C(3))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    const auto count = static_cast<std::uint32_t>(static_cast<std::uint32_t>(prec_elems_for_multiply) * local_points_per_limb);
+
+    detail::ntt::ntt_convolve<detail::ntt::ntt_prime_0, local_points_per_limb>(r0, b, tw0, u, v, count, static_cast<std::uint32_t>(local_point_mask), n_ntt);
+    detail::ntt::ntt_convolve<detail::ntt::ntt_prime_1, local_points_per_limb>(r1, b, tw1, u, v, count, static_cast<std::uint32_t>(local_point_mask), n_ntt);
+    detail::ntt::ntt_convolve<detail::ntt::ntt_prime_2, local_points_per_limb>(r2, b, tw2, u, v, count, static_cast<std::uint32_t>(local_point_mask), n_ntt);
+
+    // Reconstruct each convolution term x from its residues with Garner's
+    // algorithm in the form x = x0 + p0 * (x1 + p1 * x2), release the carries
+    // from the least significant term upward and store the upper limbs.
+    // The convolution term k belongs to the result point k + 1. For two
+    // points per limb, the result point m is the high (even m) or the low
+    // (odd m) half of the result limb m / 2.
+    constexpr auto p0 = static_cast<std::uint64_t>(detail::ntt::ntt_prime_0::modulus);
+    constexpr auto p1 = static_cast<std::uint64_t>(detail::ntt::ntt_prime_1::modulus);
+    constexpr auto p2 = static_cast<std::uint64_t>(detail::ntt::ntt_prime_2::modulus);
+
+    // Precompute the inverses of p0 mod p1 and (p0 * p1) mod p2
+    // (in Montgomery form for the respective primes).
+    const auto inv_p0_mod_p1 =
+      detail::ntt::ntt_prime_1::pow_mont(detail::ntt::ntt_prime_1::to_mont(static_cast<std::uint32_t>(p0 % p1)),
+                                         static_cast<std::uint32_t>(p1 - 2U));
+
+    const auto inv_p0p1_mod_p2 =
+      detail::ntt::ntt_prime_2::pow_mont(detail::ntt::ntt_prime_2::to_mont(static_cast<std::uint32_t>((p0 * p1) % p2)),
+                                         static_cast<std::uint32_t>(p2 - 2U));
+
+    auto carry = static_cast<std::uint64_t>(UINT8_C(0));
+
+    for(auto k = static_cast<std::int32_t>(static_cast<std::int32_t>(count * 2U) - 2); k >= static_cast<std::int32_t>(INT8_C(0)); --k)
+    {
+      const auto x0 = static_cast<std::uint64_t>(r0[k]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      const auto x1 =
+        static_cast<std::uint64_t>
         (
-          static_cast<std::uint32_t>
-          (
-            n_fft >> static_cast<unsigned>(UINT8_C(1))
-          )
+          detail::ntt::ntt_prime_1::mul(detail::ntt::ntt_prime_1::sub(r1[k], static_cast<std::uint32_t>(x0 % p1)), inv_p0_mod_p1) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
         );
 
-            auto xaj   = static_cast<local_fft_float_type>(af[j] / n_fft_half);
-      const auto xlo   = static_cast<fft_carry_type> (xaj + detail::fft::template_half<local_fft_float_type>()) + carry;
-                 carry = static_cast<fft_carry_type> (xlo / local_elem_mask_half);
-      const auto nlo   = static_cast<local_limb_type>(xlo - static_cast<fft_carry_type>(carry * local_elem_mask_half));
+      const auto x2 =
+        static_cast<std::uint64_t>
+        (
+          detail::ntt::ntt_prime_2::mul(detail::ntt::ntt_prime_2::sub(r2[k], static_cast<std::uint32_t>(static_cast<std::uint64_t>(x0 + (p0 * x1)) % p2)), inv_p0p1_mod_p2) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        );
+
+      // The term x = x0 + p0 * xh can exceed 64 bits, so the multiplication
+      // by p0 is split according to xh = (xh_hi * point_mask) + xh_lo.
+      const auto xh = static_cast<std::uint64_t>(x1 + (p1 * x2));
+
+      const auto xh_hi = static_cast<std::uint64_t>(xh / local_point_mask);
+      const auto xh_lo = static_cast<std::uint64_t>(xh % local_point_mask);
+
+      const auto sum = static_cast<std::uint64_t>(static_cast<std::uint64_t>(x0 + (p0 * xh_lo)) + carry);
 
-      const auto j_is_non_zero = (j != static_cast<std::uint32_t>(UINT8_C(0)));
+      carry = static_cast<std::uint64_t>(static_cast<std::uint64_t>(sum / local_point_mask) + (p0 * xh_hi));
 
-                 xaj   = (j_is_non_zero ? static_cast<local_fft_float_type>(af[j - 1U] / n_fft_half) : static_cast<local_fft_float_type>(0));
-      const auto xhi   = static_cast<fft_carry_type> (xaj + detail::fft::template_half<local_fft_float_type>()) + carry;
-                 carry = static_cast<fft_carry_type> (xhi / local_elem_mask_half);
-      const auto nhi   = static_cast<local_limb_type>(xhi - static_cast<fft_carry_type>(carry * local_elem_mask_half));
+      const auto m = static_cast<std::uint32_t>(k + 1);
 
-      r[j / 2U] = static_cast<local_limb_type>(static_cast<local_limb_type>(nhi * local_elem_mask_half) + nlo);
+      if(static_cast<std::uint32_t>(m / local_points_per_limb) < static_cast<std::uint32_t>(prec_elems_for_multiply))
+      {
+        const auto point = static_cast<local_limb_type>(sum % local_point_mask);
+
+        if((local_points_per_limb == 1U) || ((m % 2U) != 0U))
+        {
+          r[m / local_points_per_limb] = point;
+        }
+        else
+        {
+          r[m / local_points_per_limb] = static_cast<local_limb_type>(r[m / local_points_per_limb] + static_cast<local_limb_type>(point * static_cast<local_limb_type>(local_point_mask)));
+        }
+      }
     }
+
+    r[0U] =
+      static_cast<local_limb_type>
+      (
+        (local_points_per_limb == 1U)
+          ? static_cast<local_limb_type>(carry)
+          : static_cast<local_limb_type>(r[0U] + static_cast<local_limb_type>(static_cast<local_limb_type>(carry) * static_cast<local_limb_type>(local_point_mask)))
+      );
   }
 
   #if(__cplusplus >= 201703L)
@@ -13,10 +13,14 @@
 #endif
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
+#include <iomanip>
+#include <limits>
 #include <random>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <math/wide_decimal/decwide_t.h>
 #include <test/test_decwide_t_algebra.h>
@@ -1655,6 +1659,952 @@ auto test_odds_and_ends() -> bool
   return result_is_ok;
 }
 
+template<const std::int32_t NinesDigits10,
+         typename LimbType,
+         typename FftFloatType = double>
+auto test_mul_nines() -> bool
+{
+  // Square 0.999...9. Depending on the number of digits and on the types,
+  // this exercises the schoolbook, Karatsuba, Toom-Cook 3-way, FFT or NTT
+  // multiplication, both with their squaring paths (x * x) and with their
+  // general paths (x * y, where y is a copy of x). The column sums of the
+  // schoolbook multiplication and the convolution terms of the FFT and
+  // the NTT are at their maximum for all-nines limbs.
+
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  using local_nines_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<NinesDigits10, LimbType, std::allocator<void>, double, std::int64_t, FftFloatType>;
+  #else
+  using local_nines_type = ::math::wide_decimal::decwide_t<NinesDigits10, LimbType, std::allocator<void>, double, std::int64_t, FftFloatType>;
+  #endif
+
+  const std::string str_nines = "0." + std::string(static_cast<std::size_t>(NinesDigits10), '9');
+
+  const local_nines_type x(str_nines.c_str());
+  const local_nines_type y(x);
+
+  // (1 - d)^2 = 1 - 2d + d^2, where the term d^2 is below epsilon.
+  const local_nines_type one_minus_two_d = 1 - (2 * (1 - x));
+
+  using std::fabs;
+
+  const auto delta_square = fabs((x * x) - one_minus_two_d);
+  const auto delta_mul    = fabs((x * y) - one_minus_two_d);
+
+  const auto result_is_ok =
+    (   (delta_square < (std::numeric_limits<local_nines_type>::epsilon() * 10U))
+     && (delta_mul    < (std::numeric_limits<local_nines_type>::epsilon() * 10U)));
+
+  return result_is_ok;
+}
+
+template<const std::int32_t PreparedDigits10,
+         typename LimbType>
+auto test_mul_prepared() -> bool
+{
+  // Multiply several operands by a prepared multiplier. Depending on the number
+  // of digits, this uses the cached padded copy (Karatsuba, Toom-Cook 3-way)
+  // or the cached forward FFT of the multiplier. The results must be identical
+  // to those of the regular multiplication, also for reduced precision.
+
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  using local_prepared_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<PreparedDigits10, LimbType, std::allocator<void>>;
+  #else
+  using local_prepared_type = ::math::wide_decimal::decwide_t<PreparedDigits10, LimbType, std::allocator<void>>;
+  #endif
+
+  using std::sqrt;
+
+  const local_prepared_type v = -sqrt(local_prepared_type(3U));
+
+  const typename local_prepared_type::prepared_multiplier pv(v);
+
+  auto result_is_ok = (pv.value() == v);
+
+  for(auto   i = static_cast<unsigned>(UINT8_C(2));
+             i < static_cast<unsigned>(UINT8_C(6));
+           ++i)
+  {
+    local_prepared_type u = sqrt(local_prepared_type(i)) * static_cast<int>(static_cast<int>(i) - 4);
+
+    if(i == static_cast<unsigned>(UINT8_C(5)))
+    {
+      u.precision(PreparedDigits10 / 3);
+    }
+
+    local_prepared_type w = u;
+
+    w *= pv;
+
+    const auto result_mul_prepared_is_ok =
+      (   (w == (u * v))
+       && ((u * pv) == w)
+       && (w.crepresentation() == (u * v).crepresentation()));
+
+    result_is_ok = (result_mul_prepared_is_ok && result_is_ok);
+  }
+
+  {
+    // Multiply a copy of v by the prepared v. This uses the general paths
+    // of the kernels, whereas v * v uses their squaring paths.
+    local_prepared_type x = v;
+
+    x *= pv;
+
+    const local_prepared_type v_squared = v * v;
+
+    result_is_ok = ((x == v_squared) && (x.crepresentation() == v_squared.crepresentation()) && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+template<const std::int32_t Digits10,
+         typename LimbType>
+struct exact_reference
+{
+  // The results of a type having Digits10 digits are checked against
+  // those of a type having more than twice the number of digits. The
+  // results are converted to this type through a string, so that they
+  // are compared with their (rounded) decimal values.
+
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  using local_type       = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<Digits10, LimbType, std::allocator<void>>;
+  using local_exact_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<static_cast<std::int32_t>((Digits10 * 2) + 40), LimbType, std::allocator<void>>;
+  #else
+  using local_type       = ::math::wide_decimal::decwide_t<Digits10, LimbType, std::allocator<void>>;
+  using local_exact_type = ::math::wide_decimal::decwide_t<static_cast<std::int32_t>((Digits10 * 2) + 40), LimbType, std::allocator<void>>;
+  #endif
+
+  static auto seed() -> void
+  {
+    eng_dig.seed(util::util_pseudorandom_time_point_seed::value<typename eng_dig_type::result_type>());
+  }
+
+  static auto to_exact(const local_type& x) -> local_exact_type
+  {
+    std::stringstream strm;
+
+    strm << std::setprecision(static_cast<std::streamsize>(std::numeric_limits<local_type>::digits10)) << x;
+
+    return local_exact_type(strm.str().c_str());
+  }
+
+  static auto tolerance() -> const local_exact_type&
+  {
+    static const local_exact_type my_tol(("1E-" + std::to_string(Digits10 - 1)).c_str());
+
+    return my_tol;
+  }
+};
+
+template<const std::int32_t Digits10,
+         typename LimbType,
+         typename OperationType,
+         typename ReferenceOperationType>
+auto check_against_exact(OperationType op, ReferenceOperationType ref_op) -> bool
+{
+  // The result of op (with Digits10 digits) must agree with that of ref_op
+  // (with the exact type) to within a relative difference of 1E-(Digits10 - 1).
+
+  using local_reference_type = exact_reference<Digits10, LimbType>;
+
+  using std::fabs;
+
+  return (fabs(1 - (local_reference_type::to_exact(op()) / ref_op())) < local_reference_type::tolerance());
+}
+
+template<const std::int32_t Digits10,
+         typename LimbType,
+         typename OperationType,
+         typename ReferenceOperationType>
+auto check_against_exact(OperationType op, ReferenceOperationType ref_op, const typename exact_reference<Digits10, LimbType>::local_exact_type& scale) -> bool
+{
+  // The result of op must agree with that of ref_op to within an absolute
+  // difference of 1E-(Digits10 - 1) * scale (for sums which can cancel).
+
+  using local_reference_type = exact_reference<Digits10, LimbType>;
+
+  using std::fabs;
+
+  return (fabs(local_reference_type::to_exact(op()) - ref_op()) < (local_reference_type::tolerance() * scale));
+}
+
+template<const std::int32_t ShortDigits10,
+         typename LimbType>
+auto test_mul_short() -> bool
+{
+  // Multiply operands having random digits. Depending on the number of digits,
+  // this uses the short (high-half) product of the schoolbook or of the Karatsuba
+  // multiplication. The result is compared with the exact product, which is
+  // computed with a type having more than twice the number of digits.
+  // Products of integer values that fit into the precision must be exact.
+
+  using local_reference_type = exact_reference<ShortDigits10, LimbType>;
+  using local_short_type = typename local_reference_type::local_type;
+  using local_exact_type = typename local_reference_type::local_exact_type;
+
+  local_reference_type::seed();
+
+  auto get_digits =
+    []()
+    {
+      std::string str_digits("0.");
+
+      for(auto   i = static_cast<std::int32_t>(INT8_C(0));
+                 i < ShortDigits10;
+               ++i)
+      {
+        str_digits.push_back(static_cast<char>(dist_dig(eng_dig)));
+      }
+
+      return str_digits;
+    };
+
+  auto result_is_ok = true;
+
+  for(auto   trial = static_cast<unsigned>(UINT8_C(0));
+             trial < static_cast<unsigned>(UINT8_C(8));
+           ++trial)
+  {
+    const std::string str_u = get_digits();
+    const std::string str_v = ((trial == static_cast<unsigned>(UINT8_C(0))) ? str_u : get_digits());
+
+    const local_short_type u_short(str_u.c_str());
+    const local_short_type v_short(str_v.c_str());
+
+    result_is_ok =
+      (   check_against_exact<ShortDigits10, LimbType>([&]() { return ((trial == static_cast<unsigned>(UINT8_C(0))) ? (u_short * u_short) : (u_short * v_short)); },
+                                                       [&]() { return local_exact_type(str_u.c_str()) * local_exact_type(str_v.c_str()); })
+       && result_is_ok);
+  }
+
+  // (10^n - 1)^2 = 10^(2n) - 2 * 10^n + 1 for n = ShortDigits10 / 2.
+  const auto n_half = static_cast<std::size_t>(ShortDigits10 / 2);
+
+  const local_short_type x_nines(std::string(n_half, '9').c_str());
+
+  const std::string str_nines_squared =
+      std::string(n_half - 1U, '9')
+    + "8"
+    + std::string(n_half - 1U, '0')
+    + "1";
+
+  result_is_ok = (((x_nines * x_nines) == local_short_type(str_nines_squared.c_str())) && result_is_ok);
+
+  return result_is_ok;
+}
+
+template<const std::int32_t ShortDigits10,
+         typename LimbType>
+auto test_mul_short_operand() -> bool
+{
+  // Multiply long operands having random digits by short operands,
+  // which have only a few significant limbs. These products use the
+  // linear multiplication by the short operand, which can be either
+  // the left-hand or the right-hand side:
+  //   * The products must not depend on the order of the operands.
+  //   * The products by a single limb must be identical to those of the
+  //     multiplication by an unsigned integer, also if the product
+  //     carries out of the leading limb.
+  //   * The products by several limbs are compared with the exact product.
+  //   * The products of short integral operands must be exact.
+  // The sums of long and short operands and the comparisons
+  // of short operands are checked along with these.
+
+  using local_reference_type = exact_reference<ShortDigits10, LimbType>;
+  using local_short_type = typename local_reference_type::local_type;
+  using local_exact_type = typename local_reference_type::local_exact_type;
+
+  local_reference_type::seed();
+
+  const auto get_digits =
+    [](const std::int32_t digit_count)
+    {
+      std::string str_digits;
+
+      for(auto i = static_cast<std::int32_t>(INT8_C(0)); i < digit_count; ++i)
+      {
+        str_digits.push_back(static_cast<char>(dist_dig(eng_dig)));
+      }
+
+      return str_digits;
+    };
+
+  const auto to_exact =
+    [](const local_short_type& x)
+    {
+      return local_reference_type::to_exact(x);
+    };
+
+  auto result_is_ok = true;
+
+  using std::fabs;
+
+  for(auto   trial = static_cast<unsigned>(UINT8_C(0));
+             trial < static_cast<unsigned>(UINT8_C(8));
+           ++trial)
+  {
+    const local_short_type u(("0." + get_digits(ShortDigits10)).c_str());
+
+    // Multiply by a single limb.
+    const auto n = static_cast<unsigned>(static_cast<unsigned>(static_cast<unsigned>(trial * 13U) % 97U) + 2U);
+
+    const local_short_type u_times_n = u * n;
+
+    result_is_ok = ((( u * local_short_type(n)).crepresentation() == u_times_n.crepresentation()) && result_is_ok);
+    result_is_ok = (((local_short_type(n) * u).crepresentation() == u_times_n.crepresentation()) && result_is_ok);
+
+    // Multiply by a short fraction and by a short integer of 12 digits.
+    const std::string str_s = get_digits(INT32_C(12));
+
+    for(const auto& s : { local_short_type(("0." + str_s).c_str()), local_short_type(str_s.c_str()) })
+    {
+      const local_short_type u_times_s = u * s;
+      const local_short_type s_times_u = s * u;
+
+      result_is_ok = ((u_times_s.crepresentation() == s_times_u.crepresentation()) && result_is_ok);
+
+      const local_exact_type u_exact = to_exact(u);
+      const local_exact_type s_exact = to_exact(s);
+
+      result_is_ok = (check_against_exact<ShortDigits10, LimbType>([&]() { return u_times_s; }, [&]() { return u_exact * s_exact; }) && result_is_ok);
+
+      // Add and subtract the short operand.
+      const local_exact_type scale = (std::max)(fabs(u_exact), fabs(s_exact));
+
+      result_is_ok = (check_against_exact<ShortDigits10, LimbType>([&]() { return u + s; }, [&]() { return u_exact + s_exact; }, scale) && result_is_ok);
+      result_is_ok = (check_against_exact<ShortDigits10, LimbType>([&]() { return u - s; }, [&]() { return u_exact - s_exact; }, scale) && result_is_ok);
+      result_is_ok = (check_against_exact<ShortDigits10, LimbType>([&]() { return s - u; }, [&]() { return s_exact - u_exact; }, scale) && result_is_ok);
+    }
+  }
+
+  {
+    // The product 0.999...9 * 9 carries out of the leading limb.
+    const local_short_type x_nines(("0." + std::string(static_cast<std::size_t>(ShortDigits10), '9')).c_str());
+
+    const local_short_type x_nines_times_9 = x_nines * 9U;
+
+    result_is_ok = (((x_nines * local_short_type(9U)).crepresentation() == x_nines_times_9.crepresentation()) && result_is_ok);
+    result_is_ok = (((local_short_type(9U) * x_nines).crepresentation() == x_nines_times_9.crepresentation()) && result_is_ok);
+    result_is_ok = ((x_nines_times_9 > 8) && (x_nines_times_9 < 9) && result_is_ok);
+  }
+
+  {
+    // Multiply short integers. The products are exact.
+    const local_short_type a(get_digits(INT32_C(12)).c_str());
+    const local_short_type b(get_digits(INT32_C( 9)).c_str());
+
+    const local_short_type a_times_b = a * b;
+
+    std::stringstream strm;
+
+    strm << std::fixed << std::setprecision(0) << (to_exact(a) * to_exact(b));
+
+    result_is_ok = ((a_times_b == local_short_type(strm.str().c_str())) && result_is_ok);
+    result_is_ok = (((b * a).crepresentation() == a_times_b.crepresentation()) && result_is_ok);
+
+    // Compare short operands with each other and with long operands.
+    const local_short_type a_plus_tiny = a + (local_short_type(1U) / 3U);
+
+    result_is_ok = ((a < (a + 1)) && ((a + 1) > a) && (a == local_short_type(a)) && result_is_ok);
+    result_is_ok = ((a < a_plus_tiny) && (a_plus_tiny > a) && (a != a_plus_tiny) && result_is_ok);
+    result_is_ok = ((-a_plus_tiny < -a) && (a_times_b > a) && (a_times_b > b) && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+template<const std::int32_t TrackDigits10,
+         typename LimbType>
+auto test_used_elems_tracking() -> bool
+{
+  // Each value tracks the count of its used limbs. Cancel long operands
+  // to short values, round, take integer parts and modify the limbs
+  // through the representation, and then verify the comparisons, isone,
+  // isint and the products of the resulting values.
+
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  using local_track_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<TrackDigits10, LimbType, std::allocator<void>>;
+  #else
+  using local_track_type = ::math::wide_decimal::decwide_t<TrackDigits10, LimbType, std::allocator<void>>;
+  #endif
+
+  eng_dig.seed(util::util_pseudorandom_time_point_seed::value<typename eng_dig_type::result_type>());
+
+  std::string str_frac;
+
+  for(auto i = static_cast<std::int32_t>(INT8_C(0)); i < static_cast<std::int32_t>(TrackDigits10 - 2); ++i)
+  {
+    str_frac.push_back(static_cast<char>(dist_dig(eng_dig)));
+  }
+
+  auto result_is_ok = true;
+
+  // The value a lies in [1, 2) and has random digits. The sum a + 3 is exact.
+  const local_track_type a(("1." + str_frac).c_str());
+  const local_track_type b = a + 3U;
+
+  // Cancel the long operands to the short value 3.
+  const local_track_type d = b - a;
+
+  result_is_ok = ((d == local_track_type(3U)) && (d.crepresentation() == local_track_type(3U).crepresentation()) && result_is_ok);
+  result_is_ok = ((d.isint() && (!a.isint()) && (d < a + 2U) && (d > a + 1U)) && result_is_ok);
+  result_is_ok = (((d - 2U).isone() && (!(d - 1U).isone()) && (!(a - 1U).isone())) && result_is_ok);
+  result_is_ok = (((d * a).crepresentation() == (a * 3U).crepresentation()) && result_is_ok);
+  result_is_ok = (((a * d).crepresentation() == (a * 3U).crepresentation()) && result_is_ok);
+  result_is_ok = (((d - 3U).iszero() && (d - b < 0) && (-(d - b) == a)) && result_is_ok);
+
+  // Multiplying by one keeps all of the limbs.
+  result_is_ok = (((a * local_track_type(1U)).crepresentation() == a.crepresentation()) && result_is_ok);
+
+  // The integer part of a long value is short.
+  {
+    const local_track_type x = a * 1000U;
+
+    const local_track_type x_int = x.extract_integer_part();
+
+    result_is_ok = ((x_int.isint() && (x_int <= x) && (x < x_int + 1U) && (x_int * 2U == x_int + x_int)) && result_is_ok);
+  }
+
+  // The value (1/3) * 3 has nines in all of its limbs. It is one,
+  // but not after subtracting a tiny value from it.
+  {
+    const local_track_type x_nines = (local_track_type(1U) / 3U) * 3U;
+
+    const local_track_type tiny = std::numeric_limits<local_track_type>::epsilon() * 1000U;
+
+    result_is_ok = ((x_nines.isone() && (!(x_nines - tiny).isone()) && (x_nines > 1 - tiny)) && result_is_ok);
+  }
+
+  // Set the leading limb of zero to one through the representation.
+  {
+    local_track_type x_one(0U);
+
+    x_one.representation()[static_cast<std::size_t>(UINT8_C(0))] = static_cast<LimbType>(UINT8_C(1));
+
+    result_is_ok = (x_one.isone() && (x_one == 1) && ((x_one * a).crepresentation() == a.crepresentation()) && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+template<const std::int32_t ReleaseDigits10,
+         typename LimbType>
+auto test_mul_release_caches() -> bool
+{
+  // Multiply in the FFT or NTT range, release the cached FFT plan and NTT
+  // twiddle tables of this thread and multiply again. The tables are then
+  // regenerated, and the results must be identical.
+
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  using local_release_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<ReleaseDigits10, LimbType, std::allocator<void>>;
+  #else
+  using local_release_type = ::math::wide_decimal::decwide_t<ReleaseDigits10, LimbType, std::allocator<void>>;
+  #endif
+
+  const local_release_type u = local_release_type(2U) / 3U;
+  const local_release_type v = local_release_type(1U) / 7U;
+
+  const local_release_type w_cached = u * v;
+
+  local_release_type::release_multiplication_caches();
+
+  const local_release_type w_released = u * v;
+
+  const local_release_type w_cached_again = u * v;
+
+  const auto result_is_ok =
+    (   (w_released     == w_cached)
+     && (w_cached_again == w_cached)
+     && (w_released.crepresentation() == w_cached.crepresentation()));
+
+  return result_is_ok;
+}
+
+template<const std::int32_t DivDigits10,
+         typename LimbType>
+auto test_div_karp_markstein() -> bool
+{
+  // Divide operands having random digits and random signs. From about
+  // 200 digits (above the range of the long division), this uses
+  // Karp-Markstein division. The result is compared
+  // with the quotient computed with a type having more than twice the number
+  // of digits. Quotients with exponents near the limits of the range
+  // are computed with the reciprocal and are checked as well.
+
+  using local_reference_type = exact_reference<DivDigits10, LimbType>;
+  using local_div_type   = typename local_reference_type::local_type;
+  using local_exact_type = typename local_reference_type::local_exact_type;
+
+  local_reference_type::seed();
+
+  auto get_digits =
+    [](const bool is_neg, const int exp10)
+    {
+      std::string str_digits(is_neg ? "-0." : "0.");
+
+      str_digits.push_back('1');
+
+      for(auto   i = static_cast<std::int32_t>(INT8_C(1));
+                 i < DivDigits10;
+               ++i)
+      {
+        str_digits.push_back(static_cast<char>(dist_dig(eng_dig)));
+      }
+
+      return str_digits + "E" + std::to_string(exp10);
+    };
+
+  auto result_is_ok = true;
+
+  for(auto   trial = static_cast<unsigned>(UINT8_C(0));
+             trial < static_cast<unsigned>(UINT8_C(8));
+           ++trial)
+  {
+    const auto exp_u = static_cast<int>(static_cast<int>(trial * 7U) - 20);
+    const auto exp_v = static_cast<int>(13 - static_cast<int>(trial * 5U));
+
+    const std::string str_u = get_digits(((trial % 2U) != 0U), exp_u);
+    const std::string str_v = get_digits(((trial % 3U) == 0U), exp_v);
+
+    const local_div_type u_div(str_u.c_str());
+    const local_div_type v_div(str_v.c_str());
+
+    result_is_ok =
+      (   check_against_exact<DivDigits10, LimbType>([&]() { return u_div / v_div; },
+                                                     [&]() { return local_exact_type(str_u.c_str()) / local_exact_type(str_v.c_str()); })
+       && result_is_ok);
+
+    using std::fabs;
+
+    // An operand divided by an equal value in another object is one
+    // (up to the truncation of the quotient).
+    const local_div_type u_copy(str_u.c_str());
+
+    result_is_ok = ((fabs(1 - (u_div / u_copy)) < std::numeric_limits<local_div_type>::epsilon() * 10U) && result_is_ok);
+  }
+
+  // Quotients near the limits of the exponent range.
+  const local_div_type x_huge = (std::numeric_limits<local_div_type>::max)() / local_div_type("1E20");
+  const local_div_type x_tiny = (std::numeric_limits<local_div_type>::min)() * local_div_type("1E20");
+
+  result_is_ok = ((x_huge / x_tiny) == (std::numeric_limits<local_div_type>::max)()) && result_is_ok;
+  result_is_ok = ((fabs(1 - ((x_huge / local_div_type(3U)) * 3U / x_huge)) < std::numeric_limits<local_div_type>::epsilon() * 10U) && result_is_ok);
+
+  result_is_ok = (((local_div_type(0U) / local_div_type(3U)) == 0) && result_is_ok);
+  result_is_ok = (((local_div_type(-7) / local_div_type(2U)) == local_div_type("-3.5")) && result_is_ok);
+
+  return result_is_ok;
+}
+
+template<const std::int32_t DivDigits10,
+         typename LimbType>
+auto test_div_long() -> bool
+{
+  // Divide operands having random digits and operands having runs of
+  // nines or zeros (which challenge the quotient estimates and the
+  // rounding carry). Below the Karatsuba threshold, this uses long
+  // division. The result is compared with the quotient computed with
+  // a type having more than twice the number of digits.
+
+  using local_reference_type = exact_reference<DivDigits10, LimbType>;
+  using local_div_type   = typename local_reference_type::local_type;
+  using local_exact_type = typename local_reference_type::local_exact_type;
+
+  local_reference_type::seed();
+
+  auto get_digits =
+    [](const bool is_neg, const char lead, const char fill, const int exp10)
+    {
+      std::string str_digits(is_neg ? "-0." : "0.");
+
+      str_digits.push_back((lead == '\0') ? static_cast<char>(dist_dig(eng_dig)) : lead);
+
+      for(auto   i = static_cast<std::int32_t>(INT8_C(1));
+                 i < DivDigits10;
+               ++i)
+      {
+        str_digits.push_back((fill == '\0') ? static_cast<char>(dist_dig(eng_dig)) : fill);
+      }
+
+      return str_digits + "E" + std::to_string(exp10);
+    };
+
+  auto result_is_ok = true;
+
+  const std::array<char, static_cast<std::size_t>(UINT8_C(4))> leads { '\0', '9', '1', '5' };
+  const std::array<char, static_cast<std::size_t>(UINT8_C(4))> fills { '\0', '9', '0', '\0' };
+
+  for(auto   trial = static_cast<unsigned>(UINT8_C(0));
+             trial < static_cast<unsigned>(UINT8_C(32));
+           ++trial)
+  {
+    const auto exp_u = static_cast<int>(static_cast<int>(trial * 3U) - 40);
+    const auto exp_v = static_cast<int>(23 - static_cast<int>(trial * 2U));
+
+    const std::string str_u = get_digits(((trial % 2U) != 0U), leads[trial % 4U],        fills[trial % 4U],        exp_u);
+    const std::string str_v = get_digits(((trial % 3U) == 0U), leads[(trial / 4U) % 4U], fills[(trial / 4U) % 4U], exp_v);
+
+    result_is_ok =
+      (   check_against_exact<DivDigits10, LimbType>([&]() { return local_div_type(str_u.c_str()) / local_div_type(str_v.c_str()); },
+                                                     [&]() { return local_exact_type(str_u.c_str()) / local_exact_type(str_v.c_str()); })
+       && result_is_ok);
+  }
+
+  // Small exact quotients and quotients near the limits of the exponent range.
+  result_is_ok = (((local_div_type(-7) / local_div_type(2U)) == local_div_type("-3.5")) && result_is_ok);
+  result_is_ok = (((local_div_type(1U) / local_div_type(8U)) == local_div_type("0.125")) && result_is_ok);
+  result_is_ok = (((local_div_type(UINT32_C(99980001)) / local_div_type(9999U)) == local_div_type(9999U)) && result_is_ok);
+
+  const local_div_type x_huge = (std::numeric_limits<local_div_type>::max)() / local_div_type("1E20");
+  const local_div_type x_tiny = (std::numeric_limits<local_div_type>::min)() * local_div_type("1E20");
+
+  result_is_ok = ((x_huge / x_tiny) == (std::numeric_limits<local_div_type>::max)()) && result_is_ok;
+  result_is_ok = ((x_tiny / x_huge) == (std::numeric_limits<local_div_type>::min)()) && result_is_ok;
+
+  return result_is_ok;
+}
+
+template<const std::int32_t DivDigits10,
+         typename LimbType>
+auto test_div_by_wide_integer() -> bool
+{
+  // Divide operands having random digits by integers spanning
+  // several limbs, including divisors near the limit of the
+  // fast path and above it. The result is compared with the
+  // quotient computed with a type having more than twice
+  // the number of digits.
+
+  using local_reference_type = exact_reference<DivDigits10, LimbType>;
+  using local_div_type   = typename local_reference_type::local_type;
+  using local_exact_type = typename local_reference_type::local_exact_type;
+
+  local_reference_type::seed();
+
+  std::mt19937_64 eng_den(util::util_pseudorandom_time_point_seed::value<std::mt19937_64::result_type>()); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+  auto result_is_ok = true;
+
+  for(auto   trial = static_cast<unsigned>(UINT8_C(0));
+             trial < static_cast<unsigned>(UINT8_C(64));
+           ++trial)
+  {
+    std::string str_u(((trial % 2U) != 0U) ? "-0." : "0.");
+
+    for(auto   i = static_cast<std::int32_t>(INT8_C(0));
+               i < DivDigits10;
+             ++i)
+    {
+      str_u.push_back(((trial % 4U) == 3U) ? '9' : static_cast<char>(dist_dig(eng_dig)));
+    }
+
+    str_u += "E" + std::to_string(static_cast<int>(trial) - 32);
+
+    auto n = static_cast<unsigned long long>(eng_den() >> static_cast<unsigned>(trial % 48U)); // NOLINT(google-runtime-int)
+
+    if((trial % 8U) == 5U) { n = static_cast<unsigned long long>(UINT64_C(0x3FFFFFFFFFFFFFFF)); } // NOLINT(google-runtime-int)
+    if((trial % 8U) == 6U) { n = static_cast<unsigned long long>(UINT64_C(0x4000000000000000)); } // NOLINT(google-runtime-int)
+    if((trial % 8U) == 7U) { n = static_cast<unsigned long long>(UINT64_C(10000000000000000)); } // NOLINT(google-runtime-int)
+
+    n = (std::max)(n, static_cast<unsigned long long>(UINT8_C(2))); // NOLINT(google-runtime-int)
+
+    result_is_ok =
+      (   check_against_exact<DivDigits10, LimbType>([&]() { return local_div_type(str_u.c_str()) / n; },
+                                                     [&]() { return local_exact_type(str_u.c_str()) / local_exact_type(n); })
+       && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+template<const std::int32_t SqrtDigits10,
+         typename LimbType>
+auto test_sqrt_and_rsqrt() -> bool
+{
+  // Compute square roots and inverse square roots of operands
+  // having random digits and exponents. The results are compared
+  // with the square roots computed with a type having more than
+  // twice the number of digits. Square roots of perfect squares
+  // must be exact to within one unit in the last place.
+
+  using local_reference_type = exact_reference<SqrtDigits10, LimbType>;
+  using local_sqrt_type  = typename local_reference_type::local_type;
+  using local_exact_type = typename local_reference_type::local_exact_type;
+
+  local_reference_type::seed();
+
+  auto result_is_ok = true;
+
+  using std::fabs;
+  using std::sqrt;
+
+  for(auto   trial = static_cast<unsigned>(UINT8_C(0));
+             trial < static_cast<unsigned>(UINT8_C(32));
+           ++trial)
+  {
+    std::string str_x("0.");
+
+    for(auto   i = static_cast<std::int32_t>(INT8_C(0));
+               i < SqrtDigits10;
+             ++i)
+    {
+      str_x.push_back(((trial % 4U) == 3U) ? '9' : static_cast<char>(dist_dig(eng_dig)));
+    }
+
+    str_x += "E" + std::to_string((static_cast<int>(trial) * 37) - 555);
+
+    const local_sqrt_type x(str_x.c_str());
+
+    const local_sqrt_type r = rsqrt(x);
+
+    const local_exact_type s_exact = sqrt(local_reference_type::to_exact(x));
+
+    result_is_ok = (check_against_exact<SqrtDigits10, LimbType>([&]() { return sqrt(x); }, [&]() { return s_exact; })                          && result_is_ok);
+    result_is_ok = (check_against_exact<SqrtDigits10, LimbType>([&]() { return r; },       [&]() { return local_exact_type(1U) / s_exact; }) && result_is_ok);
+
+    result_is_ok = ((rootn_inv(x, 2) == r) && result_is_ok);
+  }
+
+  for(auto   k = static_cast<unsigned>(UINT8_C(2));
+             k < static_cast<unsigned>(UINT8_C(64));
+           ++k)
+  {
+    const local_sqrt_type delta = fabs(sqrt(local_sqrt_type(k * k)) - k);
+
+    result_is_ok = ((delta <= (std::numeric_limits<local_sqrt_type>::epsilon() * k)) && result_is_ok);
+  }
+
+  result_is_ok = ((rsqrt(local_sqrt_type(0U)) == 0)  && result_is_ok);
+  result_is_ok = ((rsqrt(local_sqrt_type(1U)) == 1)  && result_is_ok);
+  result_is_ok = ((rsqrt(local_sqrt_type(-4)) == 0)  && result_is_ok);
+  result_is_ok = ((sqrt (local_sqrt_type(-4)) == 0)  && result_is_ok);
+
+  return result_is_ok;
+}
+
+template<const std::int32_t AddDigits10,
+         typename LimbType>
+auto test_add_sub_offsets() -> bool
+{
+  // Add and subtract operands having random digits, signs and
+  // exponent offsets. The results are compared with those of a
+  // type having more than twice the number of digits. Carries out
+  // of the most significant limb and borrows through the leading
+  // limbs must be exact, also at reduced precision.
+
+  using local_reference_type = exact_reference<AddDigits10, LimbType>;
+  using local_add_type   = typename local_reference_type::local_type;
+  using local_exact_type = typename local_reference_type::local_exact_type;
+
+  local_reference_type::seed();
+
+  auto result_is_ok = true;
+
+  using std::fabs;
+
+  const auto make_string =
+    [](const unsigned trial, const int exp10)
+    {
+      std::string str("0.");
+
+      for(auto   i = static_cast<std::int32_t>(INT8_C(0));
+                 i < AddDigits10;
+               ++i)
+      {
+        str.push_back(((trial % 5U) == 4U) ? '9' : static_cast<char>(dist_dig(eng_dig)));
+      }
+
+      return (((trial % 2U) == 0U) ? "" : "-") + str + "E" + std::to_string(exp10);
+    };
+
+  for(auto   trial = static_cast<unsigned>(UINT8_C(0));
+             trial < static_cast<unsigned>(UINT8_C(64));
+           ++trial)
+  {
+    const int offset = (static_cast<int>(trial * 7U) % (AddDigits10 + 20)) - ((AddDigits10 + 20) / 2);
+
+    const local_add_type u(make_string(trial,      3).c_str());
+    const local_add_type v(make_string(trial / 2U, 3 + offset).c_str());
+
+    const local_exact_type u_exact = local_reference_type::to_exact(u);
+    const local_exact_type v_exact = local_reference_type::to_exact(v);
+
+    const local_exact_type scale = (std::max)(fabs(u_exact), fabs(v_exact));
+
+    result_is_ok = (check_against_exact<AddDigits10, LimbType>([&]() { local_add_type s(u); s += v; return s; }, [&]() { return u_exact + v_exact; }, scale) && result_is_ok);
+    result_is_ok = (check_against_exact<AddDigits10, LimbType>([&]() { local_add_type d(u); d -= v; return d; }, [&]() { return u_exact - v_exact; }, scale) && result_is_ok);
+
+    result_is_ok = (((u - u) == 0) && (!signbit(u - u)) && result_is_ok);
+    result_is_ok = (((v + (-v)) == 0) && (!signbit(v + (-v))) && result_is_ok);
+  }
+
+  // The carry of (1 - tiny) + tiny runs out of the most significant limb
+  // and the borrow of 1 - tiny runs through all leading limbs. The tiny
+  // term lies within the (possibly reduced) precision of the operands.
+  const auto test_carry_and_borrow =
+    [&result_is_ok](const std::int32_t prec_digits10)
+    {
+      local_add_type tiny(("1E-" + std::to_string(prec_digits10 - 20)).c_str());
+      local_add_type one (1U);
+
+      tiny.precision(prec_digits10);
+      one.precision (prec_digits10);
+
+      local_add_type near_one(one);
+
+      near_one -= tiny;
+
+      result_is_ok = ((near_one < 1) && result_is_ok);
+      result_is_ok = ((near_one == (local_add_type(1U) - local_add_type(("1E-" + std::to_string(prec_digits10 - 20)).c_str()))) && result_is_ok);
+
+      local_add_type sum(near_one);
+
+      sum += tiny;
+
+      result_is_ok = ((sum == 1) && result_is_ok);
+
+      local_add_type neg(tiny);
+
+      neg -= one;
+
+      result_is_ok = ((neg == -near_one) && result_is_ok);
+
+      neg += near_one;
+
+      result_is_ok = ((neg == 0) && (!signbit(neg)) && result_is_ok);
+    };
+
+  test_carry_and_borrow(AddDigits10);
+  test_carry_and_borrow(AddDigits10 / 2);
+
+  return result_is_ok;
+}
+
+template<const std::int32_t FusedDigits10,
+         typename LimbType>
+auto test_fma_and_dot() -> bool
+{
+  // Compare the fused sums of products with the sums of the
+  // individually computed products. Integral sums are exact.
+  // The sums of many terms close to one carry beyond the most
+  // significant limb of the accumulator.
+
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  using local_fused_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<FusedDigits10, LimbType, std::allocator<void>>;
+  #else
+  using local_fused_type = ::math::wide_decimal::decwide_t<FusedDigits10, LimbType, std::allocator<void>>;
+  #endif
+
+  const local_fused_type tol = std::numeric_limits<local_fused_type>::epsilon() * 1000U;
+
+  const auto is_close =
+    [&tol](const local_fused_type& a, const local_fused_type& b)
+    {
+      return (fabs(a - b) <= (tol * fabs(b)));
+    };
+
+  std::vector<local_fused_type> x;
+  std::vector<local_fused_type> y;
+  std::vector<local_fused_type> ni;
+  std::vector<local_fused_type> nj;
+
+  local_fused_type sum_xy  (0U);
+  local_fused_type sum_xx  (0U);
+  local_fused_type sum_nint(0U);
+
+  for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT16_C(300)); ++i)
+  {
+    x.push_back(((i % 3U) == 1U) ? -(local_fused_type(i + 1U) / 7U) : (local_fused_type(i + 1U) / 7U));
+    y.push_back(((i % 5U) == 2U) ? -(local_fused_type((2U * i) + 1U) / 13U) : (local_fused_type((2U * i) + 1U) / 13U));
+
+    ni.emplace_back(i + 1U);
+    nj.emplace_back(((i % 2U) == 0U) ? static_cast<int>(i + 3U) : -static_cast<int>(i + 3U));
+
+    sum_xy   += x.back()  * y.back();
+    sum_xx   += x.back()  * x.back();
+    sum_nint += ni.back() * nj.back();
+  }
+
+  auto result_is_ok = true;
+
+  result_is_ok = (is_close(dot(x.cbegin(), x.cend(), y.cbegin()), sum_xy)  && result_is_ok);
+  result_is_ok = (is_close(dot(x.cbegin(), x.cend(), x.cbegin()), sum_xx)  && result_is_ok);
+  result_is_ok = ((dot(ni.cbegin(), ni.cend(), nj.cbegin()) == sum_nint)   && result_is_ok);
+  result_is_ok = ((dot(x.cbegin(), x.cbegin(), y.cbegin()) == 0)           && result_is_ok);
+
+  const std::vector<local_fused_type> near_one  (2000U, local_fused_type(1U) - std::numeric_limits<local_fused_type>::epsilon());
+  const std::vector<local_fused_type> minus_near(2000U, -near_one.front());
+
+  const local_fused_type sum_near_one = dot(near_one.cbegin(), near_one.cend(), near_one.cbegin());
+
+  result_is_ok = (is_close(sum_near_one, local_fused_type(2000U))                                  && result_is_ok);
+  result_is_ok = ((dot(near_one.cbegin(), near_one.cend(), minus_near.cbegin()) == -sum_near_one) && result_is_ok);
+
+  result_is_ok = ((fma(local_fused_type(2U), local_fused_type(3U), local_fused_type(-10)) == -4)              && result_is_ok);
+  result_is_ok = ((fma(local_fused_type(2U), local_fused_type(3U), local_fused_type(-6)) == 0)                && result_is_ok);
+  result_is_ok = ((!signbit(fma(local_fused_type(2U), local_fused_type(3U), local_fused_type(-6))))          && result_is_ok);
+  result_is_ok = ((fma(x[5U], y[7U], local_fused_type(0U)) == (x[5U] * y[7U]))                               && result_is_ok);
+  result_is_ok = ((fma(local_fused_type(0U), y[7U], x[3U]) == x[3U])                                         && result_is_ok);
+  result_is_ok = ((fma(x[4U], y[4U], -(x[4U] * y[4U])) == 0)                                                 && result_is_ok);
+  result_is_ok = (is_close(fma(x[8U], y[9U], x[10U]), (x[8U] * y[9U]) + x[10U])                              && result_is_ok);
+
+  const local_fused_type third_large = local_fused_type(1U) / 3U * local_fused_type("1E30");
+  const local_fused_type third_small = local_fused_type(1U) / 3U / local_fused_type("1E30");
+
+  result_is_ok = ((fabs(fma(third_large, third_small, local_fused_type(-1) / 9U)) <= tol) && result_is_ok);
+
+  return result_is_ok;
+}
+
+template<const std::int32_t LimbDigits10>
+auto test_limb64_vs_limb32() -> bool
+{
+  // Compute the same values with 64-bit limbs and with 32-bit limbs.
+  // The results must agree to within a few units in the last place.
+  // For low precision, this checks the tabulated constants of the
+  // 64-bit limb type.
+
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  using local_limb64_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<LimbDigits10, std::uint64_t, std::allocator<void>>;
+  using local_limb32_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<LimbDigits10, std::uint32_t, std::allocator<void>>;
+  #else
+  using local_limb64_type = ::math::wide_decimal::decwide_t<LimbDigits10, std::uint64_t, std::allocator<void>>;
+  using local_limb32_type = ::math::wide_decimal::decwide_t<LimbDigits10, std::uint32_t, std::allocator<void>>;
+  #endif
+
+  const auto digits_to_compare = static_cast<std::streamsize>(LimbDigits10 - 8);
+
+  auto is_close =
+    [&digits_to_compare](const local_limb64_type& a, const local_limb32_type& b)
+    {
+      std::stringstream strm_a;
+      std::stringstream strm_b;
+
+      strm_a << std::setprecision(digits_to_compare) << a;
+      strm_b << std::setprecision(digits_to_compare) << b;
+
+      return (strm_a.str() == strm_b.str());
+    };
+
+  using std::log;
+  using std::sqrt;
+
+  const local_limb64_type x64 = sqrt(local_limb64_type(2U)) / 3;
+  const local_limb32_type x32 = sqrt(local_limb32_type(2U)) / 3;
+
+  auto result_is_ok = true;
+
+  result_is_ok = (is_close(x64 * x64, x32 * x32)                                             && result_is_ok);
+  result_is_ok = (is_close(x64 / (x64 + 7U), x32 / (x32 + 7U))                               && result_is_ok);
+  result_is_ok = (is_close(x64 * 987654321U, x32 * 987654321U)                               && result_is_ok);
+  result_is_ok = (is_close(x64 / 987654321U, x32 / 987654321U)                               && result_is_ok);
+  result_is_ok = (is_close(log(x64), log(x32))                                               && result_is_ok);
+  result_is_ok = (is_close(local_limb64_type::my_value_pi(), local_limb32_type::my_value_pi()) && result_is_ok);
+  result_is_ok = (is_close(local_limb64_type::my_value_ln_two(), local_limb32_type::my_value_ln_two()) && result_is_ok);
+
+  return result_is_ok;
+}
+
 } // namespace test_decwide_t_algebra_edge
 
 #if defined(WIDE_DECIMAL_NAMESPACE)
@@ -1685,6 +2635,78 @@ auto test_decwide_t_algebra_edge____() -> bool // NOLINT(readability-identifier-
   result_is_ok = (test_decwide_t_algebra_edge::test_various_int_operations<std::uint32_t>() && result_is_ok);
   result_is_ok = (test_decwide_t_algebra_edge::test_various_int_operations<std::uint64_t>() && result_is_ok);
   result_is_ok = (test_decwide_t_algebra_edge::test_odds_and_ends                        () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_nines<INT32_C(  160), std::uint16_t>       () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_nines<INT32_C(  400), std::uint16_t>       () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_nines<INT32_C( 2000), std::uint16_t>       () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_nines<INT32_C( 6000), std::uint16_t>       () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_nines<INT32_C(  400), std::uint32_t>       () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_nines<INT32_C( 8000), std::uint32_t>       () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_nines<INT32_C(20000), std::uint32_t>       () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_nines<INT32_C(  800), std::uint8_t>        () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_nines<INT32_C( 2000), std::uint8_t>        () && result_is_ok);
+  // With float as FFT float type, the NTT replaces the FFT (for 32-bit limbs).
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_nines<INT32_C(20000), std::uint32_t, float>() && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_nines<INT32_C(20000), std::uint16_t, float>() && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_prepared<INT32_C(  400), std::uint32_t>    () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_prepared<INT32_C( 2000), std::uint32_t>    () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_prepared<INT32_C( 8000), std::uint32_t>    () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_prepared<INT32_C(20000), std::uint32_t>    () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_short<INT32_C(   60), std::uint8_t>        () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_short<INT32_C(  600), std::uint8_t>        () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_short<INT32_C(  120), std::uint16_t>       () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_short<INT32_C( 1200), std::uint16_t>       () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_short<INT32_C(  300), std::uint32_t>       () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_short<INT32_C( 3000), std::uint32_t>       () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_short<INT32_C(  600), std::uint64_t>       () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_short<INT32_C( 9000), std::uint64_t>       () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_short_operand<INT32_C( 101), std::uint8_t>  () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_short_operand<INT32_C( 201), std::uint16_t> () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_short_operand<INT32_C( 401), std::uint32_t> () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_short_operand<INT32_C(5001), std::uint32_t> () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_short_operand<INT32_C( 401), std::uint64_t> () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_used_elems_tracking<INT32_C( 101), std::uint8_t>  () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_used_elems_tracking<INT32_C( 201), std::uint16_t> () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_used_elems_tracking<INT32_C( 401), std::uint32_t> () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_used_elems_tracking<INT32_C( 401), std::uint64_t> () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_nines<INT32_C(  400), std::uint64_t>       () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_nines<INT32_C(20000), std::uint64_t>       () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_nines<INT32_C(140000), std::uint64_t>      () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_prepared<INT32_C(20000), std::uint64_t>    () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_release_caches<INT32_C( 20000), std::uint32_t>() && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_mul_release_caches<INT32_C(140000), std::uint32_t>() && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_div_karp_markstein<INT32_C(  101), std::uint32_t> () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_div_karp_markstein<INT32_C(  301), std::uint8_t>  () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_div_karp_markstein<INT32_C( 1001), std::uint32_t> () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_div_karp_markstein<INT32_C( 2001), std::uint64_t> () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_div_karp_markstein<INT32_C(20001), std::uint32_t> () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_div_long<INT32_C(   21), std::uint8_t>           () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_div_long<INT32_C(   61), std::uint16_t>          () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_div_long<INT32_C(   51), std::uint32_t>          () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_div_long<INT32_C(  801), std::uint32_t>          () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_div_long<INT32_C(   17), std::uint64_t>          () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_div_long<INT32_C(  201), std::uint64_t>          () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_div_by_wide_integer<INT32_C(  11), std::uint8_t> () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_div_by_wide_integer<INT32_C(  41), std::uint16_t>() && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_div_by_wide_integer<INT32_C( 101), std::uint32_t>() && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_div_by_wide_integer<INT32_C(1001), std::uint32_t>() && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_div_by_wide_integer<INT32_C( 201), std::uint64_t>() && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_sqrt_and_rsqrt<INT32_C(  31), std::uint8_t>     () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_sqrt_and_rsqrt<INT32_C(  61), std::uint16_t>    () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_sqrt_and_rsqrt<INT32_C( 101), std::uint32_t>    () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_sqrt_and_rsqrt<INT32_C(5001), std::uint32_t>    () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_sqrt_and_rsqrt<INT32_C(2001), std::uint64_t>    () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_add_sub_offsets<INT32_C(  31), std::uint8_t>    () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_add_sub_offsets<INT32_C(  61), std::uint16_t>   () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_add_sub_offsets<INT32_C( 101), std::uint32_t>   () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_add_sub_offsets<INT32_C(1001), std::uint32_t>   () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_add_sub_offsets<INT32_C( 201), std::uint64_t>   () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_fma_and_dot<INT32_C(   51), std::uint8_t>     () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_fma_and_dot<INT32_C(  101), std::uint16_t>    () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_fma_and_dot<INT32_C(  501), std::uint32_t>    () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_fma_and_dot<INT32_C( 1001), std::uint64_t>    () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_limb64_vs_limb32<INT32_C(   51)>              () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_limb64_vs_limb32<INT32_C( 1001)>              () && result_is_ok);
+  result_is_ok = (test_decwide_t_algebra_edge::test_limb64_vs_limb32<INT32_C(12001)>              () && result_is_ok);
 
   return result_is_ok;
 }
@@ -0,0 +1,157 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright The wide-decimal contributors 2025.                //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+// This test checks the (optional) reciprocal cache used in division.
+// It is built with WIDE_DECIMAL_DIV_RECIPROCAL_CACHE_SIZE=4
+// (see test/CMakeLists.txt). The cache is only consulted where
+// the quotient is obtained from the reciprocal of the divisor,
+// which is the case for the precisions here with 8-bit limbs:
+//   * Quotients computed with cached reciprocals must agree
+//     with those of a type having more than twice the digits.
+//   * These must be bit-identical to the quotients obtained
+//     from the reciprocal without the cache.
+//   * Repeated divisors must be hits, new divisors must be misses
+//     and replace the oldest entries when the cache is full.
+//   * Divisors differing only in sign or in the last limb
+//     must not be confused.
+//   * Releasing the cache resets its entries and counters.
+
+// g++ -O2 -Werror -Wall -Wextra -Wpedantic -Wconversion -Wsign-conversion -std=c++14 -DWIDE_DECIMAL_DIV_RECIPROCAL_CACHE_SIZE=4 -I. test/test_decwide_t_div_cache.cpp -o test_decwide_t_div_cache.exe
+
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+
+#include <math/wide_decimal/decwide_t.h>
+
+namespace test_decwide_t_div_cache
+{
+  template<const std::int32_t DivDigits10,
+           typename LimbType>
+  auto test_div_cache() -> bool
+  {
+    #if defined(WIDE_DECIMAL_NAMESPACE)
+    using local_div_type   = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<DivDigits10, LimbType, std::allocator<void>>;
+    using local_exact_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<static_cast<std::int32_t>((DivDigits10 * 2) + 40), LimbType, std::allocator<void>>;
+    #else
+    using local_div_type   = ::math::wide_decimal::decwide_t<DivDigits10, LimbType, std::allocator<void>>;
+    using local_exact_type = ::math::wide_decimal::decwide_t<static_cast<std::int32_t>((DivDigits10 * 2) + 40), LimbType, std::allocator<void>>;
+    #endif
+
+    const local_exact_type tol_div(("1E-" + std::to_string(DivDigits10 - 2)).c_str());
+
+    auto result_is_ok = true;
+
+    auto check_quotient =
+      [&result_is_ok, &tol_div](const local_div_type& u, const local_div_type& v)
+      {
+        const local_div_type q = u / v;
+
+        // The uncached quotient is the product with the reciprocal.
+        const local_div_type q_uncached = u * local_div_type(v).calculate_inv();
+
+        result_is_ok = ((q == q_uncached) && result_is_ok);
+
+        result_is_ok = (std::equal(q.crepresentation().cbegin(),
+                                   q.crepresentation().cend(),
+                                   q_uncached.crepresentation().cbegin()) && result_is_ok);
+
+        std::stringstream strm_u;
+        std::stringstream strm_v;
+        std::stringstream strm_q;
+
+        strm_u << std::setprecision(static_cast<std::streamsize>(std::numeric_limits<local_div_type>::digits10)) << u;
+        strm_v << std::setprecision(static_cast<std::streamsize>(std::numeric_limits<local_div_type>::digits10)) << v;
+        strm_q << std::setprecision(static_cast<std::streamsize>(std::numeric_limits<local_div_type>::digits10)) << q;
+
+        const local_exact_type q_exact = local_exact_type(strm_u.str().c_str()) / local_exact_type(strm_v.str().c_str());
+
+        using std::fabs;
+
+        result_is_ok = ((fabs(1 - (local_exact_type(strm_q.str().c_str()) / q_exact)) < tol_div) && result_is_ok);
+      };
+
+    using std::sqrt;
+
+    // The five divisors exceed the four entries of the cache.
+    const local_div_type v0 = sqrt(local_div_type(3U));
+    const local_div_type v1 = -v0;
+    const local_div_type v2 = v0 + std::numeric_limits<local_div_type>::epsilon();
+    const local_div_type v3 = local_div_type(1U) / 7U;
+    const local_div_type v4 = sqrt(local_div_type(5U)) / local_div_type("1E1234");
+
+    const local_div_type u = sqrt(local_div_type(2U)) * 12345U;
+
+    local_div_type::release_reciprocal_cache();
+
+    // Four misses fill the cache, and repetitions are hits.
+    for(auto   round = static_cast<unsigned>(UINT8_C(0));
+               round < static_cast<unsigned>(UINT8_C(3));
+             ++round)
+    {
+      check_quotient(u, v0);
+      check_quotient(u, v1);
+      check_quotient(u, v2);
+      check_quotient(u, v3);
+    }
+
+    result_is_ok = ((local_div_type::reciprocal_cache_misses() == 4U) && result_is_ok);
+    result_is_ok = ((local_div_type::reciprocal_cache_hits()   == 8U) && result_is_ok);
+
+    // The fifth divisor replaces the oldest entry (v0),
+    // which is then a miss again and replaces v1.
+    check_quotient(u, v4);
+    check_quotient(u, v0);
+    check_quotient(u, v2);
+
+    result_is_ok = ((local_div_type::reciprocal_cache_misses() == 6U) && result_is_ok);
+    result_is_ok = ((local_div_type::reciprocal_cache_hits()   == 9U) && result_is_ok);
+
+    // Trivial divisors bypass the cache.
+    result_is_ok = (((u / local_div_type(1U)) == u) && result_is_ok);
+    result_is_ok = (((u / u) == 1) && result_is_ok);
+    result_is_ok = (((local_div_type(0U) / v3) == 0) && result_is_ok);
+
+    result_is_ok = ((local_div_type::reciprocal_cache_misses() == 6U) && result_is_ok);
+
+    local_div_type::release_reciprocal_cache();
+
+    result_is_ok = ((local_div_type::reciprocal_cache_misses() == 0U) && result_is_ok);
+    result_is_ok = ((local_div_type::reciprocal_cache_hits()   == 0U) && result_is_ok);
+
+    check_quotient(u, v2);
+
+    result_is_ok = ((local_div_type::reciprocal_cache_misses() == 1U) && result_is_ok);
+
+    std::cout << "test_div_cache: digits: "
+              << DivDigits10
+              << ", limb bits: "
+              << (sizeof(LimbType) * 8U)
+              << ", result_is_ok: "
+              << std::boolalpha
+              << result_is_ok
+              << std::endl;
+
+    return result_is_ok;
+  }
+} // namespace test_decwide_t_div_cache
+
+auto main() -> int
+{
+  const auto result_is_ok =
+    (   test_decwide_t_div_cache::test_div_cache<INT32_C(101), std::uint8_t>()
+     && test_decwide_t_div_cache::test_div_cache<INT32_C(151), std::uint8_t>()
+     && test_decwide_t_div_cache::test_div_cache<INT32_C(191), std::uint8_t>());
+
+  std::cout << "result_is_ok: " << std::boolalpha << result_is_ok << std::endl;
+
+  return (result_is_ok ? 0 : -1);
+}
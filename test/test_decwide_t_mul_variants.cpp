@@ -0,0 +1,890 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright The wide-decimal contributors 2025.                //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+// This test compares the multiplication kernels of one build
+// configuration with reference results. It is built several times
+// (see test/CMakeLists.txt): by default, with WIDE_DECIMAL_FFT_THREADS,
+// with WIDE_DECIMAL_DISABLE_FFT_SIMD and with WIDE_DECIMAL_DISABLE_FFT_RADIX4,
+// so that each variant of the kernels is checked against the same
+// references:
+//   * The FFT products must agree limb-for-limb with the exact
+//     products of the three-prime NTT. For this, the lower halves
+//     of the operands are zero, so that the product is contained
+//     in the upper limbs and no carries of the (dropped) lower
+//     limbs are involved.
+//   * The FFT products of full operands must agree limb-for-limb
+//     with those of the single-threaded FFT steps, also when the
+//     (optional) threaded transform is used.
+//   * The FFT squares (one forward transform) must agree limb-for-limb
+//     with the general FFT products of the operand and an equal copy
+//     of it (two forward transforms).
+//   * When multithreaded multiplication is enabled, the parallel
+//     Karatsuba products (full and short) must agree limb-for-limb
+//     with the serial ones and stay within their temporary storage.
+//   * The scratch arena of the multiplication kernels must serve
+//     nested frames, grow to their peak demand and no longer grow
+//     in repeated multiplications.
+//   * The linear multiplication by a short operand (mul_loop_n_by_m)
+//     must agree limb-for-limb with the exact product, which is
+//     summed from the rows of mul_loop_n, for all limb types.
+//   * The column-wise schoolbook kernels must agree with the same
+//     row-wise exact products, limb-for-limb for full products and
+//     squares, and within one unit of the last limb for short products,
+//     for all limb types.
+//   * The decwide_t products (and squares) at the precisions just below
+//     and at the thresholds of the multiplication tiers must agree
+//     limb-for-limb with the exact row-wise products.
+//   * When the multiplication counters are enabled (in the default
+//     build, with WIDE_DECIMAL_MUL_COUNTERS), rsqrt and sqrt must square
+//     in place, so that these use the squaring paths of the kernels.
+
+// g++ -O2 -Werror -Wall -Wextra -Wpedantic -Wconversion -Wsign-conversion -std=c++14 -DWIDE_DECIMAL_FFT_THREADS=4 -I. test/test_decwide_t_mul_variants.cpp -pthread -lpthread -o test_decwide_t_mul_variants.exe
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <math/wide_decimal/decwide_t.h>
+
+namespace test_decwide_t_mul_variants
+{
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  namespace detail = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::detail;
+  #else
+  namespace detail = ::math::wide_decimal::detail;
+  #endif
+
+  using fft_float_type = double;
+
+  using eng_limb_type = std::mt19937;
+
+  eng_limb_type eng_limb; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+
+  template<typename LimbType>
+  auto make_limbs(const std::int32_t prec_elems, const std::int32_t used_elems, const bool is_nines) -> std::vector<LimbType>
+  {
+    // The leading used_elems limbs are either random or all (elem_mask - 1),
+    // the latter being the worst case for the size of the convolution terms.
+    // The remaining limbs are zero. The leading limb is never zero,
+    // as in a normalized decwide_t.
+
+    constexpr auto local_elem_mask = static_cast<std::uint64_t>(detail::decwide_t_helper_base<LimbType>::elem_mask);
+
+    std::uniform_int_distribution<std::uint64_t> dist_limb(static_cast<std::uint64_t>(UINT8_C(1)), static_cast<std::uint64_t>(local_elem_mask - 1U));
+
+    std::vector<LimbType> u(static_cast<std::size_t>(prec_elems));
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < static_cast<std::size_t>(used_elems); ++i)
+    {
+      u[i] = static_cast<LimbType>(is_nines ? static_cast<std::uint64_t>(local_elem_mask - 1U) : dist_limb(eng_limb));
+    }
+
+    return u;
+  }
+
+  template<typename LimbType>
+  auto fft_length(const std::int32_t prec_elems) -> std::uint32_t
+  {
+    // This is the FFT length of decwide_t::eval_mul_fft.
+    return
+      static_cast<std::uint32_t>
+      (
+          detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(prec_elems))
+        * static_cast<std::uint32_t>(static_cast<std::uint32_t>(UINT8_C(2)) * detail::decwide_t_helper_base<LimbType>::fft_points_per_limb)
+      );
+  }
+
+  template<typename LimbType>
+  auto mul_fft(const std::vector<LimbType>& u, const std::vector<LimbType>& v, const std::int32_t prec_elems) -> std::vector<LimbType>
+  {
+    // Multiply with mul_loop_fft, which uses the threaded
+    // transform for large lengths when it is enabled.
+
+    const auto n_fft = fft_length<LimbType>(prec_elems);
+
+    auto& my_fft_plan = detail::fft::fft_plan_cache<fft_float_type>(n_fft);
+
+    std::vector<LimbType> r(static_cast<std::size_t>(prec_elems));
+
+    const LimbType* pu = u.data();
+    const LimbType* pv = ((&u == &v) ? pu : v.data());
+
+    detail::mul_loop_fft(r.data(), pu, pv, my_fft_plan.af(), my_fft_plan.bf(), my_fft_plan.twiddles(), prec_elems, n_fft);
+
+    return r;
+  }
+
+  template<typename LimbType>
+  auto mul_fft_serial(const std::vector<LimbType>& u, const std::vector<LimbType>& v, const std::int32_t prec_elems) -> std::vector<LimbType>
+  {
+    // Multiply with the single-threaded steps of mul_loop_fft.
+
+    const auto n_fft = fft_length<LimbType>(prec_elems);
+
+    auto& my_fft_plan = detail::fft::fft_plan_cache<fft_float_type>(n_fft);
+
+    fft_float_type*       af = my_fft_plan.af();
+    fft_float_type*       bf = my_fft_plan.bf();
+    const fft_float_type* tw = my_fft_plan.twiddles();
+
+    const auto is_square = (&u == &v);
+
+    const auto n_pairs = static_cast<std::uint32_t>(n_fft / 2U);
+
+    detail::mul_loop_fft_load(af, u.data(), prec_elems, static_cast<std::uint32_t>(UINT8_C(0)), n_pairs);
+    detail::fft::rfft_lanczos_rfft<fft_float_type, true>(n_fft, af, tw);
+
+    if(!is_square)
+    {
+      detail::mul_loop_fft_load(bf, v.data(), prec_elems, static_cast<std::uint32_t>(UINT8_C(0)), n_pairs);
+      detail::fft::rfft_lanczos_rfft<fft_float_type, true>(n_fft, bf, tw);
+    }
+
+    af[0U] *= (is_square ? af[0U] : bf[0U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    af[1U] *= (is_square ? af[1U] : bf[1U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    detail::mul_loop_fft_convolve(af, static_cast<const fft_float_type*>(bf), is_square, static_cast<std::uint32_t>(UINT8_C(1)), n_pairs);
+
+    detail::fft::rfft_lanczos_rfft<fft_float_type, false>(n_fft, af, tw);
+
+    std::vector<LimbType> r(static_cast<std::size_t>(prec_elems));
+
+    static_cast<void>(detail::mul_loop_fft_release_carries(r.data(), static_cast<const fft_float_type*>(af), static_cast<std::uint32_t>(UINT8_C(0)), static_cast<std::uint32_t>(prec_elems), n_fft));
+
+    return r;
+  }
+
+  template<typename LimbType>
+  auto mul_ntt(const std::vector<LimbType>& u, const std::vector<LimbType>& v, const std::int32_t prec_elems) -> std::vector<LimbType>
+  {
+    // Multiply exactly with the three-prime NTT.
+
+    const auto n_ntt = detail::ntt::ntt_length_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(prec_elems) * detail::decwide_t_helper_base<LimbType>::ntt_points_per_limb));
+
+    std::vector<std::uint32_t> t(static_cast<std::size_t>(n_ntt * static_cast<std::uint32_t>(UINT8_C(4))));
+
+    std::vector<LimbType> r(static_cast<std::size_t>(prec_elems));
+
+    detail::mul_loop_ntt(r.data(),
+                         u.data(),
+                         v.data(),
+                         t.data(),
+                         detail::ntt::ntt_plan_cache<detail::ntt::ntt_prime_0>(n_ntt).twiddles(),
+                         detail::ntt::ntt_plan_cache<detail::ntt::ntt_prime_1>(n_ntt).twiddles(),
+                         detail::ntt::ntt_plan_cache<detail::ntt::ntt_prime_2>(n_ntt).twiddles(),
+                         prec_elems,
+                         n_ntt);
+
+    return r;
+  }
+
+  template<typename LimbType>
+  auto test_mul_fft(const std::int32_t prec_elems, const bool is_nines) -> bool
+  {
+    const auto half_elems = static_cast<std::int32_t>(prec_elems / 2);
+
+    // Compare with the exact products of the NTT.
+    const auto uh = make_limbs<LimbType>(prec_elems, half_elems, is_nines);
+    const auto vh = make_limbs<LimbType>(prec_elems, half_elems, is_nines);
+
+    const auto r_ntt        = mul_ntt(uh, vh, prec_elems);
+    const auto r_ntt_square = mul_ntt(uh, uh, prec_elems);
+
+    const auto result_exact_is_ok =
+      (   (mul_fft       (uh, vh, prec_elems) == r_ntt)
+       && (mul_fft_serial(uh, vh, prec_elems) == r_ntt)
+       && (mul_fft       (uh, uh, prec_elems) == r_ntt_square)
+       && (mul_fft_serial(uh, uh, prec_elems) == r_ntt_square));
+
+    // Compare with the single-threaded FFT steps.
+    const auto u = make_limbs<LimbType>(prec_elems, prec_elems, is_nines);
+    const auto v = make_limbs<LimbType>(prec_elems, prec_elems, is_nines);
+
+    const auto result_serial_is_ok =
+      (   (mul_fft(u, v, prec_elems) == mul_fft_serial(u, v, prec_elems))
+       && (mul_fft(u, u, prec_elems) == mul_fft_serial(u, u, prec_elems)));
+
+    // Compare the square path, which transforms only one operand,
+    // with the general multiplication by an equal copy of the operand.
+    const auto u_copy = u;
+
+    const auto result_square_is_ok =
+      (   (mul_fft       (u, u, prec_elems) == mul_fft       (u, u_copy, prec_elems))
+       && (mul_fft_serial(u, u, prec_elems) == mul_fft_serial(u, u_copy, prec_elems)));
+
+    const auto result_is_ok = (result_exact_is_ok && result_serial_is_ok && result_square_is_ok);
+
+    std::cout << "test_mul_fft: limb bits: "
+              << (sizeof(LimbType) * 8U)
+              << ", prec_elems: "
+              << prec_elems
+              << ", n_fft: "
+              << fft_length<LimbType>(prec_elems)
+              << (is_nines ? ", nines" : ", random")
+              << ", result_is_ok: "
+              << std::boolalpha
+              << result_is_ok
+              << std::endl;
+
+    return result_is_ok;
+  }
+
+  auto test_fft_variants() -> bool
+  {
+    // The larger sizes reach (and exceed) fft_parallel_min_points,
+    // where the threaded transform is used when it is enabled.
+
+    auto result_is_ok = true;
+
+    for(const auto is_nines : { false, true })
+    {
+      result_is_ok = (test_mul_fft<std::uint16_t>(INT32_C(  512), is_nines) && result_is_ok);
+      result_is_ok = (test_mul_fft<std::uint16_t>(INT32_C(16384), is_nines) && result_is_ok);
+      result_is_ok = (test_mul_fft<std::uint16_t>(INT32_C(32768), is_nines) && result_is_ok);
+      result_is_ok = (test_mul_fft<std::uint32_t>(INT32_C( 1000), is_nines) && result_is_ok);
+      result_is_ok = (test_mul_fft<std::uint32_t>(INT32_C(16384), is_nines) && result_is_ok);
+      result_is_ok = (test_mul_fft<std::uint32_t>(INT32_C(12000), is_nines) && result_is_ok);
+      result_is_ok = (test_mul_fft<std::uint64_t>(INT32_C(  256), is_nines) && result_is_ok);
+      result_is_ok = (test_mul_fft<std::uint64_t>(INT32_C( 8192), is_nines) && result_is_ok);
+    }
+
+    return result_is_ok;
+  }
+
+  template<typename LimbType>
+  auto mul_rows(const std::vector<LimbType>& u, const std::vector<LimbType>& v) -> std::vector<LimbType>
+  {
+    // Multiply exactly with the rows u * v[j] of mul_loop_n. The product
+    // has (u.size() + v.size()) limbs including its leading carry limb.
+
+    const auto u_elems = static_cast<std::int32_t>(u.size());
+
+    std::vector<LimbType> r_exact(u.size() + v.size());
+
+    for(auto j = static_cast<std::size_t>(UINT8_C(0)); j < v.size(); ++j)
+    {
+      std::vector<LimbType> row(u.size() + 1U);
+
+      std::copy(u.cbegin(), u.cend(), row.begin() + 1);
+
+      row.front() = detail::mul_loop_n(row.begin() + 1, v[j], u_elems);
+
+      const auto carry_out = detail::eval_accumulate_n(r_exact.begin(), static_cast<std::int32_t>(j), row.cbegin(), static_cast<std::int32_t>(u_elems + 1), false);
+
+      static_cast<void>(carry_out);
+    }
+
+    return r_exact;
+  }
+
+  template<typename LimbType>
+  auto test_mul_n_by_m(const std::int32_t prec_elems, const std::int32_t short_elems, const bool is_nines) -> bool
+  {
+    // Multiply prec_elems limbs by short_elems limbs in place with
+    // mul_loop_n_by_m. The reference is the exact product of mul_rows.
+    // For all-nines limbs, the carries run through all of the limbs,
+    // including the carry out of the last limb which is returned
+    // by the kernel.
+
+    const auto u = make_limbs<LimbType>(prec_elems, prec_elems, is_nines);
+    const auto v = make_limbs<LimbType>(short_elems, short_elems, is_nines);
+
+    const auto r_exact = mul_rows(u, v);
+
+    auto r = u;
+
+    const auto carry = detail::mul_loop_n_by_m(r.begin(), v.cbegin(), short_elems, prec_elems);
+
+    const auto result_is_ok =
+      (   (carry == r_exact.front())
+       && std::equal(r.cbegin(), r.cend(), r_exact.cbegin() + 1));
+
+    std::cout << "test_mul_n_by_m: limb bits: "
+              << (sizeof(LimbType) * 8U)
+              << ", prec_elems: "
+              << prec_elems
+              << ", short_elems: "
+              << short_elems
+              << (is_nines ? ", nines" : ", random")
+              << ", result_is_ok: "
+              << std::boolalpha
+              << result_is_ok
+              << std::endl;
+
+    return result_is_ok;
+  }
+
+  template<typename LimbType>
+  auto test_mul_n_by_m_variants() -> bool
+  {
+    // Short by long (up to 16 short limbs), short by short
+    // and a single limb by one or more limbs.
+
+    auto result_is_ok = true;
+
+    for(const auto is_nines : { false, true })
+    {
+      result_is_ok = (test_mul_n_by_m<LimbType>(INT32_C(  1), INT32_C( 1), is_nines) && result_is_ok);
+      result_is_ok = (test_mul_n_by_m<LimbType>(INT32_C(  3), INT32_C( 2), is_nines) && result_is_ok);
+      result_is_ok = (test_mul_n_by_m<LimbType>(INT32_C( 16), INT32_C(16), is_nines) && result_is_ok);
+      result_is_ok = (test_mul_n_by_m<LimbType>(INT32_C( 40), INT32_C( 1), is_nines) && result_is_ok);
+      result_is_ok = (test_mul_n_by_m<LimbType>(INT32_C(100), INT32_C( 3), is_nines) && result_is_ok);
+      result_is_ok = (test_mul_n_by_m<LimbType>(INT32_C(257), INT32_C(16), is_nines) && result_is_ok);
+    }
+
+    return result_is_ok;
+  }
+
+  template<typename LimbType>
+  auto test_mul_school(const std::int32_t count, const bool is_nines) -> bool
+  {
+    // Compare the column-wise schoolbook kernels with the exact
+    // products of mul_rows. The full products and squares must agree
+    // limb-for-limb. The short products (and squares) of high_count limbs
+    // must either be the high part of the exact product or one unit
+    // of their last limb lower than this.
+
+    constexpr auto local_elem_mask = static_cast<LimbType>(detail::decwide_t_helper_base<LimbType>::elem_mask);
+
+    const auto u = make_limbs<LimbType>(count, count, is_nines);
+    const auto v = make_limbs<LimbType>(count, count, is_nines);
+
+    const auto r_exact        = mul_rows(u, v);
+    const auto r_exact_square = mul_rows(u, u);
+
+    const auto r_elems = static_cast<std::size_t>(count * 2);
+
+    std::vector<LimbType> r       (r_elems);
+    std::vector<LimbType> r_square(r_elems);
+
+    detail::eval_multiply_n_by_n_to_2n(r.data(), u.data(), v.data(), count);
+    detail::eval_square_n_to_2n       (r_square.data(), u.data(), count);
+
+    auto result_is_ok = ((r == r_exact) && (r_square == r_exact_square));
+
+    const auto is_high_part_of =
+      [&local_elem_mask](const std::vector<LimbType>& r_high, const std::vector<LimbType>& r_full, const std::int32_t high_count)
+      {
+        const auto high_end = r_full.cbegin() + static_cast<std::ptrdiff_t>(high_count);
+
+        if(std::equal(r_full.cbegin(), high_end, r_high.cbegin()))
+        {
+          return true;
+        }
+
+        // Subtract one unit of the last limb of the high part.
+        std::vector<LimbType> r_lower(r_full.cbegin(), high_end);
+
+        for(auto it = r_lower.rbegin(); it != r_lower.rend(); ++it)
+        {
+          if(*it != static_cast<LimbType>(UINT8_C(0)))
+          {
+            --(*it);
+
+            break;
+          }
+
+          *it = static_cast<LimbType>(local_elem_mask - 1U);
+        }
+
+        return std::equal(r_lower.cbegin(), r_lower.cend(), r_high.cbegin());
+      };
+
+    for(const auto high_count : { static_cast<std::int32_t>((count + 1) / 2),
+                                  static_cast<std::int32_t>(count),
+                                  static_cast<std::int32_t>((count * 2) - 1),
+                                  static_cast<std::int32_t>(count * 2) })
+    {
+      std::vector<LimbType> r_high       (r_elems);
+      std::vector<LimbType> r_high_square(r_elems);
+
+      detail::eval_multiply_n_by_n_to_high(r_high.data(), u.data(), v.data(), count, high_count);
+      detail::eval_square_n_to_high       (r_high_square.data(), u.data(), count, high_count);
+
+      result_is_ok = (   is_high_part_of(r_high,        r_exact,        high_count)
+                      && is_high_part_of(r_high_square, r_exact_square, high_count)
+                      && result_is_ok);
+    }
+
+    std::cout << "test_mul_school: limb bits: "
+              << (sizeof(LimbType) * 8U)
+              << ", count: "
+              << count
+              << (is_nines ? ", nines" : ", random")
+              << ", result_is_ok: "
+              << std::boolalpha
+              << result_is_ok
+              << std::endl;
+
+    return result_is_ok;
+  }
+
+  template<typename LimbType>
+  auto test_mul_school_variants(const std::int32_t max_count) -> bool
+  {
+    // The column sums of 16-bit limbs are held in 32 bits, which
+    // limits their schoolbook multiplication to 42 limbs. The other
+    // limb types are also checked with larger counts up to max_count.
+
+    auto result_is_ok = true;
+
+    for(const auto is_nines : { false, true })
+    {
+      for(const auto count : { INT32_C(1), INT32_C(2), INT32_C(3), INT32_C(7), INT32_C(16), INT32_C(41), INT32_C(42), INT32_C(64), INT32_C(99) })
+      {
+        if(count <= max_count)
+        {
+          result_is_ok = (test_mul_school<LimbType>(count, is_nines) && result_is_ok);
+        }
+      }
+    }
+
+    return result_is_ok;
+  }
+
+  template<const std::int32_t TierDigits10,
+           typename LimbType>
+  auto test_mul_tier_boundaries() -> bool
+  {
+    // Multiply decwide_t values at the precisions just below and at
+    // the thresholds of the Karatsuba, Toom-Cook 3-way, FFT and NTT
+    // tiers (as far as these are within the precision of the type).
+    // The lower halves of the operands are zero, so that the products
+    // are exact. These must agree limb-for-limb with those of mul_rows,
+    // for general products and squares.
+
+    #if defined(WIDE_DECIMAL_NAMESPACE)
+    using local_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<TierDigits10, LimbType, std::allocator<void>>;
+    #else
+    using local_wide_decimal_type = ::math::wide_decimal::decwide_t<TierDigits10, LimbType, std::allocator<void>>;
+    #endif
+
+    const auto make_value =
+      [](const std::vector<LimbType>& limbs, const std::int32_t prec_elems)
+      {
+        local_wide_decimal_type x(1U);
+
+        x.precision(static_cast<std::int32_t>(prec_elems * local_wide_decimal_type::decwide_t_elem_digits10));
+
+        auto& rep = x.representation();
+
+        std::fill(rep.begin(), rep.end(), static_cast<LimbType>(UINT8_C(0)));
+        std::copy(limbs.cbegin(), limbs.cend(), rep.begin());
+
+        return x;
+      };
+
+    auto result_is_ok = true;
+
+    for(const auto threshold : { local_wide_decimal_type::decwide_t_elems_for_kara,
+                                 local_wide_decimal_type::decwide_t_elems_for_toom3,
+                                 local_wide_decimal_type::decwide_t_elems_for_fft,
+                                 local_wide_decimal_type::decwide_t_elems_for_ntt })
+    {
+      for(const auto prec_elems : { static_cast<std::int32_t>(threshold - 1), threshold })
+      {
+        if(prec_elems > local_wide_decimal_type::decwide_t_elem_number)
+        {
+          continue;
+        }
+
+        const auto half_elems = static_cast<std::int32_t>(prec_elems / 2);
+
+        for(const auto is_nines : { false, true })
+        {
+          for(const auto is_square : { false, true })
+          {
+            const auto uh = make_limbs<LimbType>(half_elems, half_elems, is_nines);
+            const auto vh = make_limbs<LimbType>(half_elems, half_elems, is_nines);
+
+            auto       u = make_value(uh, prec_elems);
+            const auto v = make_value(vh, prec_elems);
+
+            if(is_square)
+            {
+              u *= u;
+            }
+            else
+            {
+              u *= v;
+            }
+
+            auto r_exact = mul_rows(uh, (is_square ? uh : vh));
+
+            // The product is normalized without its leading zero limb.
+            if(r_exact.front() == static_cast<LimbType>(UINT8_C(0)))
+            {
+              r_exact.erase(r_exact.begin());
+            }
+
+            r_exact.resize(static_cast<std::size_t>(prec_elems));
+
+            const auto result_product_is_ok = std::equal(r_exact.cbegin(), r_exact.cend(), u.crepresentation().cbegin());
+
+            if(!result_product_is_ok)
+            {
+              std::cout << "test_mul_tier_boundaries: limb bits: "
+                        << (sizeof(LimbType) * 8U)
+                        << ", prec_elems: "
+                        << prec_elems
+                        << (is_nines ? ", nines" : ", random")
+                        << (is_square ? ", square" : "")
+                        << ", result_is_ok: false"
+                        << std::endl;
+            }
+
+            result_is_ok = (result_product_is_ok && result_is_ok);
+          }
+        }
+      }
+    }
+
+    std::cout << "test_mul_tier_boundaries: digits: "
+              << TierDigits10
+              << ", limb bits: "
+              << (sizeof(LimbType) * 8U)
+              << ", result_is_ok: "
+              << std::boolalpha
+              << result_is_ok
+              << std::endl;
+
+    return result_is_ok;
+  }
+
+  template<const std::int32_t ArenaDigits10,
+           typename LimbType>
+  auto test_scratch_arena() -> bool
+  {
+    #if defined(WIDE_DECIMAL_NAMESPACE)
+    using local_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<ArenaDigits10, LimbType, std::allocator<void>>;
+    #else
+    using local_wide_decimal_type = ::math::wide_decimal::decwide_t<ArenaDigits10, LimbType, std::allocator<void>>;
+    #endif
+
+    using local_frame_type = detail::scratch_frame<LimbType>;
+
+    auto& my_arena = detail::scratch_arena_instance<LimbType>();
+
+    local_wide_decimal_type::release_multiplication_caches();
+
+    auto result_is_ok = (my_arena.capacity() == static_cast<std::size_t>(UINT8_C(0)));
+
+    const auto is_in_arena =
+      [&my_arena](local_frame_type& frame, const std::size_t count)
+      {
+        const auto arena_begin = reinterpret_cast<std::uintptr_t>(my_arena.take(static_cast<std::size_t>(UINT8_C(0)))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        const auto frame_begin = reinterpret_cast<std::uintptr_t>(frame.data());                                          // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+        // The zero-length request above points just beyond the storage in use.
+        return ((frame_begin + (count * sizeof(LimbType))) == arena_begin);
+      };
+
+    {
+      // The nested frame does not fit and has its own storage.
+      local_frame_type outer(static_cast<std::size_t>(UINT8_C(100)));
+      result_is_ok = (is_in_arena(outer, static_cast<std::size_t>(UINT8_C(100))) && result_is_ok);
+
+      local_frame_type inner(static_cast<std::size_t>(UINT8_C(50)));
+      result_is_ok = ((!is_in_arena(inner, static_cast<std::size_t>(UINT8_C(50)))) && result_is_ok);
+    }
+
+    {
+      // The arena has grown to the peak demand, so both frames fit now.
+      local_frame_type outer(static_cast<std::size_t>(UINT8_C(100)));
+      local_frame_type inner(static_cast<std::size_t>(UINT8_C(50)));
+
+      result_is_ok = ((my_arena.capacity() == static_cast<std::size_t>(UINT8_C(150))) && result_is_ok);
+      result_is_ok = (is_in_arena(inner, static_cast<std::size_t>(UINT8_C(50)))      && result_is_ok);
+    }
+
+    local_wide_decimal_type::release_multiplication_caches();
+
+    result_is_ok = ((my_arena.capacity() == static_cast<std::size_t>(UINT8_C(0))) && result_is_ok);
+
+    // Repeated multiplications draw from the arena without growing it.
+    using std::sqrt;
+
+    const local_wide_decimal_type y = sqrt(local_wide_decimal_type(3U));
+
+    local_wide_decimal_type x = sqrt(local_wide_decimal_type(2U));
+
+    x *= y;
+
+    const auto capacity_after_first = my_arena.capacity();
+
+    result_is_ok = ((capacity_after_first > static_cast<std::size_t>(UINT8_C(0))) && result_is_ok);
+
+    for(auto   i = static_cast<unsigned>(UINT8_C(0));
+               i < static_cast<unsigned>(UINT8_C(8));
+             ++i)
+    {
+      x *= y;
+      x *= x;
+      x  = sqrt(x);
+    }
+
+    result_is_ok = ((my_arena.capacity() == capacity_after_first) && result_is_ok);
+
+    local_wide_decimal_type::release_multiplication_caches();
+
+    result_is_ok = ((my_arena.capacity() == static_cast<std::size_t>(UINT8_C(0))) && result_is_ok);
+
+    std::cout << "test_scratch_arena: digits: "
+              << ArenaDigits10
+              << ", limb bits: "
+              << (sizeof(LimbType) * 8U)
+              << ", result_is_ok: "
+              << std::boolalpha
+              << result_is_ok
+              << std::endl;
+
+    return result_is_ok;
+  }
+
+  #if defined(WIDE_DECIMAL_MUL_COUNTERS)
+  template<const std::int32_t SqrtDigits10,
+           typename LimbType>
+  auto test_sqrt_squares() -> bool
+  {
+    // Each Newton step of rsqrt squares y in place. The square root
+    // additionally squares s0 (with the full precision) after computing
+    // rsqrt with about half of the precision. So sqrt must use the
+    // squaring paths exactly once more than rsqrt with that precision.
+
+    #if defined(WIDE_DECIMAL_NAMESPACE)
+    using local_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<SqrtDigits10, LimbType, std::allocator<void>>;
+    #else
+    using local_wide_decimal_type = ::math::wide_decimal::decwide_t<SqrtDigits10, LimbType, std::allocator<void>>;
+    #endif
+
+    // This is the precision of rsqrt within calculate_sqrt.
+    constexpr auto prec_elems  = local_wide_decimal_type::decwide_t_elem_number;
+    constexpr auto guard_elems = (std::max)(static_cast<std::int32_t>(INT8_C(16) / local_wide_decimal_type::decwide_t_elem_digits10), static_cast<std::int32_t>(INT8_C(2)));
+    constexpr auto half_elems  = (std::min)(static_cast<std::int32_t>((prec_elems / 2) + guard_elems), prec_elems);
+
+    local_wide_decimal_type x(3U);
+
+    local_wide_decimal_type::reset_multiplication_counters();
+
+    const auto s = sqrt(x);
+
+    const auto sqrt_squares = local_wide_decimal_type::multiplication_square_count();
+
+    x.precision(static_cast<std::int32_t>(half_elems * local_wide_decimal_type::decwide_t_elem_digits10));
+
+    local_wide_decimal_type::reset_multiplication_counters();
+
+    const auto y = rsqrt(x);
+
+    const auto rsqrt_squares = local_wide_decimal_type::multiplication_square_count();
+
+    const auto result_is_ok =
+      (   (rsqrt_squares > static_cast<std::uint64_t>(UINT8_C(0)))
+       && (sqrt_squares  == static_cast<std::uint64_t>(rsqrt_squares + 1U))
+       && (!s.iszero())
+       && (!y.iszero()));
+
+    std::cout << "test_sqrt_squares: digits: "
+              << SqrtDigits10
+              << ", limb bits: "
+              << (sizeof(LimbType) * 8U)
+              << ", rsqrt squares: "
+              << rsqrt_squares
+              << ", sqrt squares: "
+              << sqrt_squares
+              << ", result_is_ok: "
+              << std::boolalpha
+              << result_is_ok
+              << std::endl;
+
+    return result_is_ok;
+  }
+  #endif
+
+  #if defined(WIDE_DECIMAL_MUL_PARALLEL)
+  template<typename LimbType>
+  auto test_mul_kara_parallel(const std::uint_fast32_t n, const std::uint_fast32_t high_count, const bool is_square) -> bool
+  {
+    // The parallel product writes into r and t. Both have a tail
+    // of sentinel limbs beyond their documented sizes, which must
+    // remain untouched. A high_count of zero selects the full product.
+
+    constexpr auto sentinel_elems = static_cast<std::size_t>(UINT8_C(16));
+
+    constexpr auto sentinel = static_cast<LimbType>(UINT8_C(0x5A));
+
+    const auto u = make_limbs<LimbType>(static_cast<std::int32_t>(n), static_cast<std::int32_t>(n), false);
+    const auto v = make_limbs<LimbType>(static_cast<std::int32_t>(n), static_cast<std::int32_t>(n), false);
+
+    const LimbType* pu = u.data();
+    const LimbType* pv = (is_square ? pu : v.data());
+
+    const auto is_full = (high_count == static_cast<std::uint_fast32_t>(UINT8_C(0)));
+
+    const auto r_elems = static_cast<std::size_t>(static_cast<std::size_t>(n) * static_cast<std::size_t>(UINT8_C(2)));
+
+    const auto t_elems =
+      (is_full ? detail::eval_multiply_kara_parallel_temp_elems(n)
+               : detail::eval_multiply_kara_high_parallel_temp_elems(n));
+
+    std::vector<LimbType> r_serial(r_elems);
+    std::vector<LimbType> t_serial(static_cast<std::size_t>(static_cast<std::size_t>(n) * static_cast<std::size_t>(UINT8_C(4))));
+
+    std::vector<LimbType> r_parallel(r_elems + sentinel_elems, sentinel);
+    std::vector<LimbType> t_parallel(t_elems + sentinel_elems, sentinel);
+
+    if(is_full)
+    {
+      detail::eval_multiply_kara_n_by_n_to_2n         (r_serial.data(),   pu, pv, n, t_serial.data());
+      detail::eval_multiply_kara_n_by_n_to_2n_parallel(r_parallel.data(), pu, pv, n, t_parallel.data());
+    }
+    else
+    {
+      detail::eval_multiply_kara_n_by_n_to_high         (r_serial.data(),   pu, pv, n, high_count, t_serial.data());
+      detail::eval_multiply_kara_n_by_n_to_high_parallel(r_parallel.data(), pu, pv, n, high_count, t_parallel.data());
+    }
+
+    const auto compare_elems = static_cast<std::ptrdiff_t>(is_full ? r_elems : static_cast<std::size_t>(high_count));
+
+    const auto result_product_is_ok = std::equal(r_serial.cbegin(), r_serial.cbegin() + compare_elems, r_parallel.cbegin());
+
+    const auto is_sentinel = [&sentinel](const LimbType& limb) { return (limb == sentinel); };
+
+    const auto result_sentinel_is_ok =
+      (   std::all_of(r_parallel.cbegin() + static_cast<std::ptrdiff_t>(r_elems), r_parallel.cend(), is_sentinel)
+       && std::all_of(t_parallel.cbegin() + static_cast<std::ptrdiff_t>(t_elems), t_parallel.cend(), is_sentinel));
+
+    const auto result_is_ok = (result_product_is_ok && result_sentinel_is_ok);
+
+    if(!result_is_ok)
+    {
+      std::cout << "test_mul_kara_parallel: limb bits: "
+                << (sizeof(LimbType) * 8U)
+                << ", n: "
+                << n
+                << ", high_count: "
+                << high_count
+                << (is_square ? ", square" : "")
+                << ", result_is_ok: false"
+                << std::endl;
+    }
+
+    return result_is_ok;
+  }
+
+  template<typename LimbType>
+  auto test_kara_parallel_variants() -> bool
+  {
+    // The short products use high_count within the low half (serial
+    // fallback), between n/2 and n, at n, above n and near 2n.
+
+    auto result_is_ok = true;
+
+    for(const auto n : { static_cast<std::uint_fast32_t>(UINT16_C( 256)),
+                         static_cast<std::uint_fast32_t>(UINT16_C( 512)),
+                         static_cast<std::uint_fast32_t>(UINT16_C( 896)),
+                         static_cast<std::uint_fast32_t>(UINT16_C(1024)) })
+    {
+      for(const auto is_square : { false, true })
+      {
+        result_is_ok = (test_mul_kara_parallel<LimbType>(n, static_cast<std::uint_fast32_t>(UINT8_C(0)), is_square) && result_is_ok);
+
+        for(const auto high_count : { static_cast<std::uint_fast32_t>(n / 2U),
+                                      static_cast<std::uint_fast32_t>(static_cast<std::uint_fast32_t>(n / 2U) + 3U),
+                                      static_cast<std::uint_fast32_t>(static_cast<std::uint_fast32_t>(n * 3U) / 4U),
+                                      static_cast<std::uint_fast32_t>(n),
+                                      static_cast<std::uint_fast32_t>(n + 3U),
+                                      static_cast<std::uint_fast32_t>(static_cast<std::uint_fast32_t>(n * 2U) - 1U),
+                                      static_cast<std::uint_fast32_t>(n * 2U) })
+        {
+          result_is_ok = (test_mul_kara_parallel<LimbType>(n, high_count, is_square) && result_is_ok);
+        }
+      }
+    }
+
+    std::cout << "test_kara_parallel_variants: limb bits: "
+              << (sizeof(LimbType) * 8U)
+              << ", result_is_ok: "
+              << std::boolalpha
+              << result_is_ok
+              << std::endl;
+
+    return result_is_ok;
+  }
+  #endif
+} // namespace test_decwide_t_mul_variants
+
+auto main() -> int
+{
+  test_decwide_t_mul_variants::eng_limb.seed(static_cast<typename test_decwide_t_mul_variants::eng_limb_type::result_type>(UINT32_C(0x5EED0001)));
+
+  #if defined(WIDE_DECIMAL_MUL_PARALLEL)
+  std::cout << "multithreaded multiplication: enabled" << std::endl;
+  #else
+  std::cout << "multithreaded multiplication: disabled" << std::endl;
+  #endif
+
+  #if defined(WIDE_DECIMAL_DISABLE_FFT_SIMD)
+  std::cout << "vectorized FFT kernels: disabled" << std::endl;
+  #else
+  std::cout << "vectorized FFT kernels: enabled (if supported)" << std::endl;
+  #endif
+
+  #if defined(WIDE_DECIMAL_DISABLE_FFT_RADIX4)
+  std::cout << "radix-4 FFT: disabled" << std::endl;
+  #else
+  std::cout << "radix-4 FFT: enabled" << std::endl;
+  #endif
+
+  const auto result_fft_is_ok = test_decwide_t_mul_variants::test_fft_variants();
+
+  #if defined(WIDE_DECIMAL_MUL_PARALLEL)
+  const auto result_kara_is_ok =
+    (   test_decwide_t_mul_variants::test_kara_parallel_variants<std::uint8_t>()
+     && test_decwide_t_mul_variants::test_kara_parallel_variants<std::uint32_t>());
+  #else
+  const auto result_kara_is_ok = true;
+  #endif
+
+  const auto result_arena_is_ok =
+    (   test_decwide_t_mul_variants::test_scratch_arena<INT32_C(2001), std::uint8_t>()
+     && test_decwide_t_mul_variants::test_scratch_arena<INT32_C(5001), std::uint32_t>());
+
+  const auto result_n_by_m_is_ok =
+    (   test_decwide_t_mul_variants::test_mul_n_by_m_variants<std::uint8_t>()
+     && test_decwide_t_mul_variants::test_mul_n_by_m_variants<std::uint16_t>()
+     && test_decwide_t_mul_variants::test_mul_n_by_m_variants<std::uint32_t>()
+     && test_decwide_t_mul_variants::test_mul_n_by_m_variants<std::uint64_t>());
+
+  const auto result_school_is_ok =
+    (   test_decwide_t_mul_variants::test_mul_school_variants<std::uint8_t> (INT32_C(99))
+     && test_decwide_t_mul_variants::test_mul_school_variants<std::uint16_t>(INT32_C(42))
+     && test_decwide_t_mul_variants::test_mul_school_variants<std::uint32_t>(INT32_C(99))
+     && test_decwide_t_mul_variants::test_mul_school_variants<std::uint64_t>(INT32_C(99)));
+
+  const auto result_tiers_is_ok =
+    (   test_decwide_t_mul_variants::test_mul_tier_boundaries<INT32_C(  2001), std::uint8_t>()
+     && test_decwide_t_mul_variants::test_mul_tier_boundaries<INT32_C(  5001), std::uint16_t>()
+     && test_decwide_t_mul_variants::test_mul_tier_boundaries<INT32_C(132001), std::uint32_t>()
+     && test_decwide_t_mul_variants::test_mul_tier_boundaries<INT32_C(132001), std::uint64_t>());
+
+  #if defined(WIDE_DECIMAL_MUL_COUNTERS)
+  const auto result_squares_is_ok =
+    (   test_decwide_t_mul_variants::test_sqrt_squares<INT32_C( 1001), std::uint32_t>()
+     && test_decwide_t_mul_variants::test_sqrt_squares<INT32_C(20001), std::uint32_t>());
+  #else
+  const auto result_squares_is_ok = true;
+  #endif
+
+  const auto result_is_ok = (result_fft_is_ok && result_kara_is_ok && result_arena_is_ok && result_n_by_m_is_ok && result_school_is_ok && result_tiers_is_ok && result_squares_is_ok);
+
+  std::cout << "result_is_ok: " << std::boolalpha << result_is_ok << std::endl;
+
+  return (result_is_ok ? 0 : -1);
+}
@@ -0,0 +1,235 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright The wide-decimal contributors 2025.                //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+// This test checks the allocation-free configuration in several threads.
+// It is built with WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION,
+// WIDE_DECIMAL_THREAD_LOCAL_STATIC_POOLS and UTIL_N_SLOT_ARRAY_ALLOCATOR_LOCK_FREE
+// (see test/CMakeLists.txt):
+//   * Slots of the lock-free n_slot_array_allocator, which are
+//     allocated and deallocated concurrently, must not be handed
+//     out twice.
+//   * Results computed concurrently in several threads, with
+//     FFT multiplication drawing from the static pools, must agree
+//     exactly with those computed in the main thread.
+
+// g++ -O2 -Werror -Wall -Wextra -Wpedantic -Wconversion -Wsign-conversion -std=c++14 -DWIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION -DWIDE_DECIMAL_THREAD_LOCAL_STATIC_POOLS -DUTIL_N_SLOT_ARRAY_ALLOCATOR_LOCK_FREE -I. test/test_decwide_t_slot_threads.cpp -pthread -lpthread -o test_decwide_t_slot_threads.exe
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <util/memory/util_n_slot_array_allocator.h>
+
+namespace test_decwide_t_slot_threads
+{
+  constexpr auto thread_count = static_cast<unsigned>(UINT8_C(4));
+
+  auto test_slot_allocator() -> bool
+  {
+    // Each thread holds up to eight slots at a time and marks them
+    // with its own pattern, which must survive until it deallocates
+    // them. The slots of all threads together never exceed the 40 slots
+    // of the allocator (which take two 32-bit words of flags).
+
+    using local_allocator_type = util::n_slot_array_allocator<std::uint32_t, 16U, 40U>;
+
+    std::atomic<bool> result_threads_is_ok { true };
+
+    const auto run =
+      [&result_threads_is_ok](const std::uint32_t pattern)
+      {
+        local_allocator_type my_alloc { };
+
+        std::array<std::uint32_t*, 8U> slots { };
+
+        for(auto   round = static_cast<unsigned>(UINT8_C(0));
+                   round < static_cast<unsigned>(UINT16_C(20000));
+                 ++round)
+        {
+          const auto count = static_cast<std::size_t>((round % 8U) + 1U);
+
+          for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+          {
+            slots[i] = my_alloc.allocate(1U); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+            if(slots[i] == nullptr) // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            {
+              result_threads_is_ok = false;
+
+              return;
+            }
+
+            std::fill(slots[i], slots[i] + 16U, static_cast<std::uint32_t>(pattern + round)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          }
+
+          std::this_thread::yield();
+
+          for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+          {
+            const auto slot_is_ok =
+              std::all_of(slots[i],                                          // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                          slots[i] + 16U,                                    // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                          [&pattern, &round](const std::uint32_t& value)
+                          {
+                            return (value == static_cast<std::uint32_t>(pattern + round));
+                          });
+
+            if(!slot_is_ok)
+            {
+              result_threads_is_ok = false;
+            }
+
+            my_alloc.deallocate(slots[i], 1U); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+          }
+        }
+      };
+
+    std::vector<std::thread> my_threads { };
+
+    for(auto t = static_cast<unsigned>(UINT8_C(0)); t < thread_count; ++t)
+    {
+      my_threads.emplace_back(run, static_cast<std::uint32_t>(static_cast<std::uint32_t>(t + 1U) << 24U));
+    }
+
+    for(auto& my_thread : my_threads)
+    {
+      my_thread.join();
+    }
+
+    auto result_is_ok = result_threads_is_ok.load();
+
+    // All of the slots are free again. So each of the 40 slots
+    // can be allocated once, and a further allocation fails.
+    local_allocator_type my_alloc { };
+
+    std::vector<std::uint32_t*> all_slots { };
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(40)); ++i)
+    {
+      all_slots.push_back(my_alloc.allocate(1U));
+    }
+
+    std::sort(all_slots.begin(), all_slots.end());
+
+    result_is_ok = ((all_slots.front() != nullptr)                                                && result_is_ok);
+    result_is_ok = ((std::adjacent_find(all_slots.cbegin(), all_slots.cend()) == all_slots.cend()) && result_is_ok);
+    result_is_ok = ((my_alloc.allocate(1U) == nullptr)                                             && result_is_ok);
+
+    for(auto* p_slot : all_slots)
+    {
+      my_alloc.deallocate(p_slot, 1U);
+    }
+
+    std::cout << "test_slot_allocator: threads: "
+              << thread_count
+              << ", result_is_ok: "
+              << std::boolalpha
+              << result_is_ok
+              << std::endl;
+
+    return result_is_ok;
+  }
+
+  auto test_decwide_t_threads() -> bool
+  {
+    // The multiplications of 5001 digits with 16-bit limbs use the FFT.
+
+    using local_limb_type = std::uint16_t;
+
+    constexpr std::int32_t wide_decimal_digits10 = INT32_C(5001);
+
+    #if defined(WIDE_DECIMAL_NAMESPACE)
+    constexpr std::int32_t local_elem_number =
+      WIDE_DECIMAL_NAMESPACE::math::wide_decimal::detail::decwide_t_helper<wide_decimal_digits10, local_limb_type>::elem_number;
+    #else
+    constexpr std::int32_t local_elem_number =
+      ::math::wide_decimal::detail::decwide_t_helper<wide_decimal_digits10, local_limb_type>::elem_number;
+    #endif
+
+    using local_allocator_type = util::n_slot_array_allocator<void, local_elem_number, 96U>; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    #if defined(WIDE_DECIMAL_NAMESPACE)
+    using local_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<wide_decimal_digits10, local_limb_type, local_allocator_type>;
+    #else
+    using local_wide_decimal_type = ::math::wide_decimal::decwide_t<wide_decimal_digits10, local_limb_type, local_allocator_type>;
+    #endif
+
+    const auto calculate =
+      [](const unsigned k)
+      {
+        using std::sqrt;
+
+        const local_wide_decimal_type x = sqrt(local_wide_decimal_type(k + 2U));
+
+        return (x * x) / local_wide_decimal_type(k + 3U);
+      };
+
+    std::vector<local_wide_decimal_type> references { };
+
+    for(auto k = static_cast<unsigned>(UINT8_C(0)); k < thread_count; ++k)
+    {
+      references.push_back(calculate(k));
+    }
+
+    std::atomic<bool> result_threads_is_ok { true };
+
+    const auto run =
+      [&result_threads_is_ok, &references, &calculate](const unsigned k)
+      {
+        for(auto   round = static_cast<unsigned>(UINT8_C(0));
+                   round < static_cast<unsigned>(UINT8_C(8));
+                 ++round)
+        {
+          if(calculate(k) != references[k])
+          {
+            result_threads_is_ok = false;
+          }
+        }
+      };
+
+    std::vector<std::thread> my_threads { };
+
+    for(auto k = static_cast<unsigned>(UINT8_C(0)); k < thread_count; ++k)
+    {
+      my_threads.emplace_back(run, k);
+    }
+
+    for(auto& my_thread : my_threads)
+    {
+      my_thread.join();
+    }
+
+    const auto result_is_ok = result_threads_is_ok.load();
+
+    std::cout << "test_decwide_t_threads: digits: "
+              << wide_decimal_digits10
+              << ", threads: "
+              << thread_count
+              << ", result_is_ok: "
+              << std::boolalpha
+              << result_is_ok
+              << std::endl;
+
+    return result_is_ok;
+  }
+} // namespace test_decwide_t_slot_threads
+
+auto main() -> int
+{
+  const auto result_is_ok =
+    (   test_decwide_t_slot_threads::test_slot_allocator()
+     && test_decwide_t_slot_threads::test_decwide_t_threads());
+
+  std::cout << "result_is_ok: " << std::boolalpha << result_is_ok << std::endl;
+
+  return (result_is_ok ? 0 : -1);
+}
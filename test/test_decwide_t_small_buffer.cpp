@@ -0,0 +1,382 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright The wide-decimal contributors 2025.                //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+// This test checks the small-buffer representation of decwide_t,
+// which is selected with util::small_buffer_allocator:
+//   * Small integers and limb lists within the inline limbs,
+//     as well as their copies, do not allocate.
+//   * Additions, subtractions, multiplications and exact
+//     divisions of short values do not allocate.
+//   * Results of computations must agree exactly with those
+//     of the same type having the default allocator.
+//   * Reading values through const iterators does not spill.
+//   * Each allocation is released, also if the slots of an
+//     n_slot_array_allocator are exhausted.
+//   * The n_slot_array_allocator reuses its free slots in LIFO
+//     order and returns nullptr when all of its slots are in use.
+
+// g++ -O2 -Werror -Wall -Wextra -Wpedantic -Wconversion -Wsign-conversion -std=c++14 -I. test/test_decwide_t_small_buffer.cpp -o test_decwide_t_small_buffer.exe
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <util/memory/util_n_slot_array_allocator.h>
+#include <util/memory/util_small_buffer_allocator.h>
+
+namespace test_decwide_t_small_buffer
+{
+  // The counting allocator counts the allocations and deallocations
+  // made with it, which are otherwise done by std::allocator.
+  struct allocation_counts
+  {
+    static auto allocations  () -> std::uint32_t& { static std::uint32_t my_count { }; return my_count; }
+    static auto deallocations() -> std::uint32_t& { static std::uint32_t my_count { }; return my_count; }
+  };
+
+  template<typename T>
+  class counting_allocator : public std::allocator<T>
+  {
+  public:
+    using value_type = T;
+
+    counting_allocator() = default;
+
+    template<typename U>
+    counting_allocator(const counting_allocator<U>&) noexcept { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    template<typename RebindType>
+    struct rebind
+    {
+      using other = counting_allocator<RebindType>;
+    };
+
+    auto allocate(std::size_t count) -> T*
+    {
+      ++allocation_counts::allocations();
+
+      return std::allocator<T>::allocate(count);
+    }
+
+    auto deallocate(T* p, std::size_t count) -> void
+    {
+      ++allocation_counts::deallocations();
+
+      std::allocator<T>::deallocate(p, count);
+    }
+  };
+
+  template<const std::int32_t SmallDigits10,
+           typename LimbType,
+           const std::size_t SmallCount>
+  auto test_small_buffer() -> bool
+  {
+    #if defined(WIDE_DECIMAL_NAMESPACE)
+    using local_small_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<SmallDigits10, LimbType, util::small_buffer_allocator<void, SmallCount, counting_allocator<void>>>;
+    using local_plain_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<SmallDigits10, LimbType, std::allocator<void>>;
+    #else
+    using local_small_type = ::math::wide_decimal::decwide_t<SmallDigits10, LimbType, util::small_buffer_allocator<void, SmallCount, counting_allocator<void>>>;
+    using local_plain_type = ::math::wide_decimal::decwide_t<SmallDigits10, LimbType, std::allocator<void>>;
+    #endif
+
+    using local_limb_type = typename local_small_type::limb_type;
+
+    auto result_is_ok = true;
+
+    allocation_counts::allocations()   = 0U;
+    allocation_counts::deallocations() = 0U;
+
+    {
+      // Values within the inline limbs and their copies do not allocate.
+      const local_small_type a(3U);
+      const local_small_type b(-12345678);
+      const local_small_type c(UINT32_C(12345678));
+      const local_small_type d = local_small_type::from_lst( { static_cast<local_limb_type>(UINT8_C(7)), static_cast<local_limb_type>(UINT8_C(1)) } );
+
+      local_small_type e = local_small_type::from_lst( { static_cast<local_limb_type>(UINT8_C(1)) } );
+      local_small_type f(e);
+      local_small_type g(static_cast<local_small_type&&>(f));
+
+      e = b;
+      g = local_small_type(0U);
+
+      result_is_ok = (a.crepresentation().is_small()       && result_is_ok);
+      result_is_ok = (c.crepresentation().is_small()       && result_is_ok);
+      result_is_ok = (d.crepresentation().is_small()       && result_is_ok);
+      result_is_ok = (e.crepresentation().is_small()       && result_is_ok);
+      result_is_ok = ((!a.iszero()) && g.iszero()          && result_is_ok);
+      result_is_ok = ((allocation_counts::allocations() == 0U) && result_is_ok);
+
+      // Reading through const iterators does not spill. These read
+      // the inline limbs followed by zeros.
+      const auto it_a_begin = a.crepresentation().cbegin();
+
+      result_is_ok = ((*it_a_begin == static_cast<local_limb_type>(UINT8_C(3)))                                  && result_is_ok);
+      result_is_ok = ((std::distance(it_a_begin, a.crepresentation().cend()) == static_cast<std::ptrdiff_t>(a.crepresentation().size())) && result_is_ok);
+      result_is_ok = ((std::count(it_a_begin, a.crepresentation().cend(), static_cast<local_limb_type>(UINT8_C(0))) == static_cast<std::ptrdiff_t>(a.crepresentation().size() - 1U)) && result_is_ok);
+      result_is_ok = (a.crepresentation().is_small()                                                            && result_is_ok);
+      result_is_ok = ((allocation_counts::allocations() == 0U)                                                  && result_is_ok);
+
+      // Writing beyond the inline limbs spills.
+      e.representation()[static_cast<std::size_t>(SmallCount - 1U)] = static_cast<local_limb_type>(UINT8_C(1));
+
+      result_is_ok = (e.crepresentation().is_small() && result_is_ok);
+
+      e.representation()[static_cast<std::size_t>(SmallCount)] = static_cast<local_limb_type>(UINT8_C(1));
+
+      result_is_ok = ((!e.crepresentation().is_small())                    && result_is_ok);
+      result_is_ok = ((allocation_counts::allocations() == 1U)              && result_is_ok);
+      result_is_ok = ((e.crepresentation()[0U] == b.crepresentation()[0U]) && result_is_ok);
+    }
+
+    result_is_ok = ((allocation_counts::allocations() == allocation_counts::deallocations()) && result_is_ok);
+
+    {
+      // Arithmetic with short values works on the inline limbs
+      // and does not allocate. The quotients here are exact.
+      const auto allocations_before = allocation_counts::allocations();
+
+      local_small_type x(0U);
+      local_small_type y(0U);
+
+      const local_small_type three(3U);
+      const local_small_type seven(-7);
+
+      for(auto   i = static_cast<unsigned>(UINT8_C(0));
+                 i < static_cast<unsigned>(UINT8_C(20));
+               ++i)
+      {
+        const local_small_type xi = (local_small_type(i) * three) + local_small_type(1U);
+
+        x  = (xi * seven) - three;
+        x  = (x + three) / seven;
+        x  = (x * 6U) / 3U;
+        x /= 2U;
+
+        y += x;
+        y -= (x - xi);
+      }
+
+      result_is_ok = (x.crepresentation().is_small()                           && result_is_ok);
+      result_is_ok = (y.crepresentation().is_small()                           && result_is_ok);
+      result_is_ok = ((x == local_small_type(58U))                             && result_is_ok);
+      result_is_ok = ((y == local_small_type(590U))                            && result_is_ok);
+      result_is_ok = ((allocation_counts::allocations() == allocations_before) && result_is_ok);
+    }
+
+    {
+      // Results agree exactly with those of the default representation.
+      using std::sqrt;
+
+      const local_small_type x_small = sqrt(local_small_type(2U)) / 7U;
+      const local_plain_type x_plain = sqrt(local_plain_type(2U)) / 7U;
+
+      const local_small_type y_small = (((x_small + local_small_type(3U)) * local_small_type(-5)) - (local_small_type(1U) / x_small)) * x_small;
+      const local_plain_type y_plain = (((x_plain + local_plain_type(3U)) * local_plain_type(-5)) - (local_plain_type(1U) / x_plain)) * x_plain;
+
+      result_is_ok = (std::equal(y_small.crepresentation().cbegin(),
+                                 y_small.crepresentation().cend(),
+                                 y_plain.crepresentation().cbegin()) && result_is_ok);
+
+      result_is_ok = ((y_small.crepresentation()[0U] == y_plain.crepresentation()[0U]) && result_is_ok);
+
+      // A value modified within its inline limbs through the
+      // representation remains small as an operand.
+      local_small_type h(0U);
+
+      h.representation()[0U] = static_cast<local_limb_type>(UINT8_C(2));
+
+      result_is_ok = (((h == 2) && (x_small * h == x_small * 2U) && (x_small / h == x_small / local_small_type(2U))) && result_is_ok);
+      result_is_ok = (h.crepresentation().is_small() && result_is_ok);
+      result_is_ok = ((y_small > local_small_type(-100)) && (y_small < local_small_type(0U)) && result_is_ok);
+    }
+
+    result_is_ok = ((allocation_counts::allocations() == allocation_counts::deallocations()) && result_is_ok);
+
+    std::cout << "test_small_buffer: digits: "
+              << SmallDigits10
+              << ", limb bits: "
+              << (sizeof(LimbType) * 8U)
+              << ", small limbs: "
+              << SmallCount
+              << ", result_is_ok: "
+              << std::boolalpha
+              << result_is_ok
+              << std::endl;
+
+    return result_is_ok;
+  }
+
+  auto test_small_buffer_n_slot() -> bool
+  {
+    // The small-buffer representation spills into the slots
+    // of an n_slot_array_allocator. The multiplications
+    // of 5001 digits with 16-bit limbs use the FFT.
+    // When the slots are exhausted, the storage is
+    // taken from std::allocator.
+
+    using local_limb_type = std::uint16_t;
+
+    constexpr std::int32_t wide_decimal_digits10 = INT32_C(5001);
+
+    #if defined(WIDE_DECIMAL_NAMESPACE)
+    constexpr std::int32_t local_elem_number =
+      WIDE_DECIMAL_NAMESPACE::math::wide_decimal::detail::decwide_t_helper<wide_decimal_digits10, local_limb_type>::elem_number;
+    #else
+    constexpr std::int32_t local_elem_number =
+      ::math::wide_decimal::detail::decwide_t_helper<wide_decimal_digits10, local_limb_type>::elem_number;
+    #endif
+
+    using local_allocator_type = util::small_buffer_allocator<void, 8U, util::n_slot_array_allocator<void, local_elem_number, 32U>>; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    #if defined(WIDE_DECIMAL_NAMESPACE)
+    using local_small_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<wide_decimal_digits10, local_limb_type, local_allocator_type>;
+    using local_plain_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+    #else
+    using local_small_type = ::math::wide_decimal::decwide_t<wide_decimal_digits10, local_limb_type, local_allocator_type>;
+    using local_plain_type = ::math::wide_decimal::decwide_t<wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+    #endif
+
+    auto result_is_ok = true;
+
+    // Repeat the calculation to check that the slots are released.
+    for(auto   round = static_cast<unsigned>(UINT8_C(0));
+               round < static_cast<unsigned>(UINT8_C(40));
+             ++round)
+    {
+      using std::sqrt;
+
+      const local_small_type x_small = sqrt(local_small_type(round + 2U)) * local_small_type(round + 3U);
+      const local_plain_type x_plain = sqrt(local_plain_type(round + 2U)) * local_plain_type(round + 3U);
+
+      result_is_ok = (std::equal(x_small.crepresentation().cbegin(),
+                                 x_small.crepresentation().cend(),
+                                 x_plain.crepresentation().cbegin()) && result_is_ok);
+    }
+
+    // Hold more spilled values than there are slots. The values
+    // beyond these take their storage from std::allocator.
+    // The quotients are inexact, so these fill the precision.
+    for(auto   round = static_cast<unsigned>(UINT8_C(0));
+               round < static_cast<unsigned>(UINT8_C(2));
+             ++round)
+    {
+      std::array<local_small_type, static_cast<std::size_t>(UINT8_C(48))> x_small_array { };
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < x_small_array.size(); ++i)
+      {
+        x_small_array[i] = local_small_type(static_cast<unsigned>((3U * i) + 2U)) / 3U;
+      }
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < x_small_array.size(); ++i)
+      {
+        const local_plain_type x_plain = local_plain_type(static_cast<unsigned>((3U * i) + 2U)) / 3U;
+
+        result_is_ok = ((!x_small_array[i].crepresentation().is_small()) && result_is_ok);
+
+        result_is_ok = (std::equal(x_small_array[i].crepresentation().cbegin(),
+                                   x_small_array[i].crepresentation().cend(),
+                                   x_plain.crepresentation().cbegin()) && result_is_ok);
+      }
+    }
+
+    std::cout << "test_small_buffer_n_slot: digits: "
+              << wide_decimal_digits10
+              << ", result_is_ok: "
+              << std::boolalpha
+              << result_is_ok
+              << std::endl;
+
+    return result_is_ok;
+  }
+
+  auto test_n_slot_free_list() -> bool
+  {
+    // The free slots of the n_slot_array_allocator are reused in the
+    // reverse order of their deallocation (LIFO). When all of its
+    // slots are in use, a further allocation returns nullptr.
+    // Deallocating a slot twice, or a pointer which does not belong
+    // to a slot, is ignored.
+
+    using local_allocator_type = util::n_slot_array_allocator<std::uint32_t, 4U, 6U>;
+
+    local_allocator_type my_alloc { };
+
+    std::array<std::uint32_t*, static_cast<std::size_t>(UINT8_C(6))> slots { };
+
+    for(auto& p_slot : slots)
+    {
+      p_slot = my_alloc.allocate(1U);
+    }
+
+    auto sorted_slots = slots;
+
+    std::sort(sorted_slots.begin(), sorted_slots.end());
+
+    auto result_is_ok =
+      (   (sorted_slots.front() != nullptr)
+       && (std::adjacent_find(sorted_slots.cbegin(), sorted_slots.cend()) == sorted_slots.cend())
+       && (my_alloc.allocate(1U) == nullptr));
+
+    my_alloc.deallocate(slots[1U], 1U);
+    my_alloc.deallocate(slots[4U], 1U);
+    my_alloc.deallocate(slots[4U], 1U);
+
+    std::uint32_t not_a_slot { };
+
+    my_alloc.deallocate(&not_a_slot, 1U);
+
+    result_is_ok = ((my_alloc.allocate(1U) == slots[4U]) && result_is_ok);
+    result_is_ok = ((my_alloc.allocate(1U) == slots[1U]) && result_is_ok);
+    result_is_ok = ((my_alloc.allocate(1U) == nullptr)   && result_is_ok);
+
+    // Release all of the slots. These are then allocated
+    // again in the reverse order of their release.
+    for(auto* p_slot : slots)
+    {
+      my_alloc.deallocate(p_slot, 1U);
+    }
+
+    for(auto it = slots.crbegin(); it != slots.crend(); ++it)
+    {
+      result_is_ok = ((my_alloc.allocate(1U) == *it) && result_is_ok);
+    }
+
+    result_is_ok = ((my_alloc.allocate(1U) == nullptr) && result_is_ok);
+
+    for(auto* p_slot : slots)
+    {
+      my_alloc.deallocate(p_slot, 1U);
+    }
+
+    std::cout << "test_n_slot_free_list: result_is_ok: "
+              << std::boolalpha
+              << result_is_ok
+              << std::endl;
+
+    return result_is_ok;
+  }
+} // namespace test_decwide_t_small_buffer
+
+auto main() -> int
+{
+  const auto result_is_ok =
+    (   test_decwide_t_small_buffer::test_small_buffer<INT32_C(  51), std::uint8_t,  4U>()
+     && test_decwide_t_small_buffer::test_small_buffer<INT32_C( 101), std::uint16_t, 6U>()
+     && test_decwide_t_small_buffer::test_small_buffer<INT32_C(1001), std::uint32_t, 4U>()
+     && test_decwide_t_small_buffer::test_small_buffer<INT32_C(2001), std::uint64_t, 8U>()
+     && test_decwide_t_small_buffer::test_small_buffer_n_slot()
+     && test_decwide_t_small_buffer::test_n_slot_free_list());
+
+  std::cout << "result_is_ok: " << std::boolalpha << result_is_ok << std::endl;
+
+  return (result_is_ok ? 0 : -1);
+}
@@ -0,0 +1,534 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright The wide-decimal contributors 2025.                //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+// This program calibrates the multiplication thresholds of decwide_t
+// on the host. It benchmarks the schoolbook, Karatsuba, Toom-Cook 3-way,
+// FFT and NTT multiplication kernels (using the very same padding rules
+// as decwide_t) for the limb types uint8_t, uint16_t, uint32_t and uint64_t and
+// for the FFT float types float, double and long double. The switch
+// from FFT to NTT is never placed beyond the size up to which the FFT
+// is considered to be safe.
+// The crossover points are written as explicit specializations of
+// math::wide_decimal::detail::decwide_t_mul_thresholds into a header.
+// Build decwide_t code with -DWIDE_DECIMAL_MUL_THRESHOLDS_HEADER=\"<header>\"
+// in order to use the calibrated thresholds.
+
+// Usage: decwide_t_calibrate [output-header]
+// The header is written to stdout if no output file is given.
+
+#include <math/wide_decimal/decwide_t.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace local
+{
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  namespace detail = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::detail;
+  #else
+  namespace detail = ::math::wide_decimal::detail;
+  #endif
+
+  using clock_type = std::chrono::steady_clock;
+
+  using grid_type = std::vector<std::int32_t>;
+
+  struct thresholds_type
+  {
+    std::int32_t elems_for_kara  { };
+    std::int32_t elems_for_toom3 { };
+    std::int32_t elems_for_fft   { };
+    std::int32_t elems_for_ntt   { };
+    bool         fft_is_exact    { true };
+    bool         kara_is_empty   { false };
+    bool         toom3_is_empty  { false };
+    bool         fft_is_empty    { false };
+  };
+
+  auto time_per_call(const std::function<void()>& pfn) -> double
+  {
+    // Obtain the best of several averaged runs, where each
+    // run lasts at least one millisecond. This suppresses
+    // the noise from timer resolution and interrupts.
+    constexpr auto run_count = static_cast<unsigned>(UINT8_C(5));
+
+    constexpr auto min_run_time = std::chrono::microseconds(1000);
+
+    pfn();
+
+    auto best = (std::numeric_limits<double>::max)();
+
+    for(auto run = static_cast<unsigned>(UINT8_C(0)); run < run_count; ++run)
+    {
+      auto call_count = static_cast<std::uint32_t>(UINT8_C(0));
+
+      const auto start = clock_type::now();
+
+      auto stop = start;
+
+      do
+      {
+        pfn();
+
+        ++call_count;
+
+        stop = clock_type::now();
+      }
+      while((stop - start) < min_run_time);
+
+      const auto t = std::chrono::duration<double>(stop - start).count() / static_cast<double>(call_count);
+
+      best = (std::min)(best, t);
+    }
+
+    return best;
+  }
+
+  auto make_grid(const std::int32_t first, const std::int32_t last, const std::int32_t min_step) -> grid_type
+  {
+    // The grid is linear at small sizes and geometric (in steps of 1/16)
+    // at larger sizes.
+    grid_type grid { };
+
+    for(auto p = first; p <= last; p += (std::max)(min_step, static_cast<std::int32_t>(p / 16)))
+    {
+      grid.push_back(p);
+    }
+
+    return grid;
+  }
+
+  auto find_crossover(const grid_type&                               grid,
+                      const std::function<double(const std::int32_t)>& time_lower,
+                      const std::function<double(const std::int32_t)>& time_upper) -> std::int32_t
+  {
+    // Find the smallest grid point from which the upper method
+    // is faster than the lower method at this point and at the
+    // next two grid points. If the upper method never wins,
+    // the threshold lies beyond the end of the grid.
+    constexpr auto confirm_count = static_cast<std::size_t>(UINT8_C(3));
+
+    auto win_count = static_cast<std::size_t>(UINT8_C(0));
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < grid.size(); ++i)
+    {
+      const auto upper_wins = (time_upper(grid[i]) < time_lower(grid[i]));
+
+      win_count = (upper_wins ? static_cast<std::size_t>(win_count + 1U) : static_cast<std::size_t>(UINT8_C(0)));
+
+      if((win_count == confirm_count) || (upper_wins && (i == static_cast<std::size_t>(grid.size() - 1U))))
+      {
+        return grid[static_cast<std::size_t>(static_cast<std::size_t>(i + 1U) - win_count)];
+      }
+    }
+
+    return static_cast<std::int32_t>(grid.back() + 1);
+  }
+
+  auto find_crossover_extended(const std::int32_t                               lower,
+                               const std::int32_t                               first,
+                               const std::int32_t                               last,
+                               const std::int32_t                               min_step,
+                               const std::function<double(const std::int32_t)>& time_lower,
+                               const std::function<double(const std::int32_t)>& time_upper) -> std::int32_t
+  {
+    // Find the crossover on the grid from first to last. If the upper
+    // method wins from the first grid point on, the crossover may lie
+    // below it. The grid is then extended below its start (halving it)
+    // down to lower, as long as the upper method wins from the start.
+    auto grid_first = first;
+
+    auto result = find_crossover(make_grid(grid_first, last, min_step), time_lower, time_upper);
+
+    while((result == grid_first) && (grid_first > lower))
+    {
+      const auto grid_last = static_cast<std::int32_t>(grid_first - 1);
+
+      grid_first = (std::max)(lower, static_cast<std::int32_t>(grid_first / 2));
+
+      const auto grid_below = make_grid(grid_first, grid_last, min_step);
+
+      const auto result_below = find_crossover(grid_below, time_lower, time_upper);
+
+      if(result_below > grid_below.back())
+      {
+        // The upper method does not win below the previous grid.
+        break;
+      }
+
+      result = result_below;
+    }
+
+    return result;
+  }
+
+  template<typename LimbType>
+  class mul_kernels
+  {
+  public:
+    using limb_type = LimbType;
+
+    explicit mul_kernels(const std::int32_t max_elems)
+      : my_u(padded_size(max_elems)),
+        my_v(padded_size(max_elems)),
+        my_r(static_cast<std::size_t>(padded_size(max_elems) * 2U)),
+        my_t(static_cast<std::size_t>(padded_size(max_elems) * 10U))
+    {
+      std::mt19937 gen { static_cast<std::mt19937::result_type>(UINT32_C(0x5A17C0DE)) };
+
+      std::uniform_int_distribution<std::uint64_t>
+        dist
+        {
+          static_cast<std::uint64_t>(UINT8_C(0)),
+          static_cast<std::uint64_t>(detail::decwide_t_helper_base<limb_type>::elem_mask - 1)
+        };
+
+      // Random data fill the operands. The padding is zero.
+      std::generate(my_u.begin(), my_u.end(), [&gen, &dist]() { return static_cast<limb_type>(dist(gen)); });
+      std::generate(my_v.begin(), my_v.end(), [&gen, &dist]() { return static_cast<limb_type>(dist(gen)); });
+    }
+
+    // The schoolbook and Karatsuba kernels compute the
+    // short products that are used by decwide_t.
+
+    auto school(const std::int32_t prec) -> const limb_type*
+    {
+      detail::eval_multiply_n_by_n_to_high(my_r.data(), operand(my_u, prec), operand(my_v, prec), prec, static_cast<std::int32_t>(prec + 1));
+
+      return my_r.data();
+    }
+
+    auto kara(const std::int32_t prec) -> const limb_type*
+    {
+      const auto n = detail::a029750::a029750_as_runtime_value(static_cast<std::uint32_t>(prec));
+
+      const auto high_count =
+        (std::min)
+        (
+          static_cast<std::uint_fast32_t>(static_cast<std::uint_fast32_t>(static_cast<std::uint_fast32_t>(prec) + 1U) + detail::eval_multiply_kara_high_guard_elems<limb_type>(static_cast<std::uint_fast32_t>(n))),
+          static_cast<std::uint_fast32_t>(n * 2U)
+        );
+
+      detail::eval_multiply_kara_n_by_n_to_high(my_r.data(), operand(my_u, prec), operand(my_v, prec), n, high_count, my_t.data());
+
+      return my_r.data();
+    }
+
+    auto toom3(const std::int32_t prec) -> const limb_type*
+    {
+      const auto n = detail::toom3_elems_as_runtime_value(static_cast<std::uint32_t>(prec));
+
+      detail::eval_multiply_toom3_n_by_n_to_2n(my_r.data(), operand(my_u, prec), operand(my_v, prec), n, my_t.data());
+
+      return my_r.data();
+    }
+
+    template<typename FftFloatType>
+    auto fft(const std::int32_t prec) -> const limb_type*
+    {
+      const auto n_fft =
+        static_cast<std::uint32_t>
+        (
+          detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(prec)) * (2U * detail::decwide_t_helper_base<limb_type>::fft_points_per_limb)
+        );
+
+      auto& plan = detail::fft::fft_plan_cache<FftFloatType>(n_fft);
+
+      detail::mul_loop_fft(my_r.data(), operand(my_u, prec), operand(my_v, prec), plan.af(), plan.bf(), plan.twiddles(), prec, n_fft);
+
+      return my_r.data();
+    }
+
+    auto ntt(const std::int32_t prec) -> const limb_type*
+    {
+      const auto n_ntt = detail::ntt::ntt_length_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(prec) * detail::decwide_t_helper_base<limb_type>::ntt_points_per_limb));
+
+      my_t_ntt.resize(static_cast<std::size_t>(n_ntt * 4U));
+
+      detail::mul_loop_ntt(my_r.data(),
+                           operand(my_u, prec),
+                           operand(my_v, prec),
+                           my_t_ntt.data(),
+                           detail::ntt::ntt_plan_cache<detail::ntt::ntt_prime_0>(n_ntt).twiddles(),
+                           detail::ntt::ntt_plan_cache<detail::ntt::ntt_prime_1>(n_ntt).twiddles(),
+                           detail::ntt::ntt_plan_cache<detail::ntt::ntt_prime_2>(n_ntt).twiddles(),
+                           prec,
+                           n_ntt);
+
+      return my_r.data();
+    }
+
+  private:
+    std::vector<limb_type> my_u;
+    std::vector<limb_type> my_v;
+    std::vector<limb_type> my_r;
+    std::vector<limb_type> my_t;
+
+    std::vector<std::uint32_t> my_t_ntt { };
+
+    std::vector<limb_type> my_operand_u { };
+    std::vector<limb_type> my_operand_v { };
+
+    static auto padded_size(const std::int32_t max_elems) -> std::size_t
+    {
+      const auto n_kara  = detail::a029750::a029750_as_runtime_value(static_cast<std::uint32_t>(max_elems));
+      const auto n_toom3 = detail::toom3_elems_as_runtime_value(static_cast<std::uint32_t>(max_elems));
+
+      return static_cast<std::size_t>((std::max)(n_kara, n_toom3));
+    }
+
+    static auto operand(std::vector<limb_type>& x, const std::int32_t prec) -> const limb_type*
+    {
+      // The limbs beyond prec are zeroed, as in the padding of decwide_t.
+      std::fill(x.begin() + prec, x.end(), static_cast<limb_type>(UINT8_C(0)));
+
+      return x.data();
+    }
+  };
+
+  template<typename LimbType, typename FftFloatType>
+  auto fft_is_exact(mul_kernels<LimbType>& kernels, const std::int32_t prec) -> bool
+  {
+    // Compare the FFT result with the exact Toom-Cook 3-way result.
+    // The FFT result is truncated to prec limbs and omits the carry
+    // from the lower half, so the last two limbs are not compared.
+    const LimbType* p_exact = kernels.toom3(prec);
+
+    const std::vector<LimbType> exact(p_exact, p_exact + prec);
+
+    const LimbType* p_fft = kernels.template fft<FftFloatType>(prec);
+
+    return std::equal(exact.cbegin(), exact.cend() - 2, p_fft);
+  }
+
+  template<typename LimbType>
+  auto calibrate_kara_and_toom3(mul_kernels<LimbType>& kernels) -> thresholds_type
+  {
+    thresholds_type result { };
+
+    // For 16-bit limbs, the column-wise schoolbook multiplication
+    // is limited to 42 limbs (see decwide_t_mul_thresholds).
+    const auto school_max =
+      static_cast<std::int32_t>
+      (
+        std::is_same<LimbType, std::uint16_t>::value ? INT32_C(42) : INT32_C(512)
+      );
+
+    result.elems_for_kara =
+      find_crossover_extended(INT32_C(2), INT32_C(8), school_max, INT32_C(2),
+                              [&kernels](const std::int32_t p) { return time_per_call([&kernels, p]() { kernels.school(p); }); },
+                              [&kernels](const std::int32_t p) { return time_per_call([&kernels, p]() { kernels.kara  (p); }); });
+
+    result.elems_for_toom3 =
+      find_crossover_extended(result.elems_for_kara, (std::max)(result.elems_for_kara, INT32_C(256)), INT32_C(8192), INT32_C(32),
+                              [&kernels](const std::int32_t p) { return time_per_call([&kernels, p]() { kernels.kara (p); }); },
+                              [&kernels](const std::int32_t p) { return time_per_call([&kernels, p]() { kernels.toom3(p); }); });
+
+    return result;
+  }
+
+  auto enforce_ordering(thresholds_type& t) -> void
+  {
+    // Maintain the ordering kara <= toom3 <= fft <= ntt. A tier whose
+    // crossover lies at or beyond that of the next tier has never been
+    // fastest. It is left empty, with its threshold equal to that of the
+    // next tier, and a note is printed for it.
+    // The FFT tier is empty if the FFT is not safe up to its crossover,
+    // since the NTT has been measured there instead.
+    if(t.elems_for_ntt <= t.elems_for_fft)
+    {
+      t.elems_for_ntt = t.elems_for_fft;
+      t.fft_is_empty  = true;
+    }
+
+    if(t.elems_for_toom3 >= t.elems_for_fft)
+    {
+      t.elems_for_toom3 = t.elems_for_fft;
+      t.toom3_is_empty  = true;
+    }
+
+    if(t.elems_for_kara >= t.elems_for_toom3)
+    {
+      t.elems_for_kara = t.elems_for_toom3;
+      t.kara_is_empty  = true;
+    }
+  }
+
+  template<typename LimbType, typename FftFloatType>
+  auto calibrate_fft(mul_kernels<LimbType>& kernels, const thresholds_type& kara_and_toom3) -> thresholds_type
+  {
+    thresholds_type result = kara_and_toom3;
+
+    // The FFT tier is compared with the tier that would be used below it.
+    const auto time_below_fft =
+      [&kernels, &result](const std::int32_t p)
+      {
+        return (p < result.elems_for_kara)  ? time_per_call([&kernels, p]() { kernels.school(p); })
+             : (p < result.elems_for_toom3) ? time_per_call([&kernels, p]() { kernels.kara  (p); })
+                                            : time_per_call([&kernels, p]() { kernels.toom3 (p); });
+      };
+
+    // The FFT is not used beyond the size up to which it is considered
+    // to be safe. The NTT takes over from there on.
+    constexpr auto elems_for_fft_safe =
+      static_cast<std::int32_t>(detail::fft_safe_elems_as_constexpr<LimbType, FftFloatType>() + 1);
+
+    const auto time_fft =
+      [&kernels, &result](const std::int32_t p)
+      {
+        // An inexact FFT never counts as being faster.
+        if(!fft_is_exact<LimbType, FftFloatType>(kernels, p))
+        {
+          result.fft_is_exact = false;
+
+          return (std::numeric_limits<double>::max)();
+        }
+
+        return time_per_call([&kernels, p]() { kernels.template fft<FftFloatType>(p); });
+      };
+
+    const auto time_ntt =
+      [&kernels](const std::int32_t p)
+      {
+        return time_per_call([&kernels, p]() { kernels.ntt(p); });
+      };
+
+    const auto time_fft_tier =
+      [&time_fft, &time_ntt](const std::int32_t p)
+      {
+        return (p < elems_for_fft_safe) ? time_fft(p) : time_ntt(p);
+      };
+
+    result.elems_for_fft = find_crossover_extended(result.elems_for_kara, INT32_C(256), INT32_C(16384), INT32_C(64), time_below_fft, time_fft_tier);
+
+    // Find the switch from FFT to NTT within the FFT tier.
+    const auto ntt_grid = make_grid(result.elems_for_fft, (std::min)(static_cast<std::int32_t>(elems_for_fft_safe - 1), INT32_C(16384)), INT32_C(64));
+
+    result.elems_for_ntt =
+      (ntt_grid.empty() ? elems_for_fft_safe
+                        : (std::min)(find_crossover(ntt_grid, time_fft, time_ntt), elems_for_fft_safe));
+
+    enforce_ordering(result);
+
+    return result;
+  }
+
+  auto print_specialization(std::ostream& os, const char* limb_name, const char* fft_float_name, const thresholds_type& t) -> void
+  {
+    if(!t.fft_is_exact)
+    {
+      os << "  // Note: The " << fft_float_name << " FFT was found to be inexact at some sizes.\n";
+    }
+
+    if(t.kara_is_empty)
+    {
+      os << "  // Note: Karatsuba was never fastest, so its tier is empty.\n";
+    }
+
+    if(t.toom3_is_empty)
+    {
+      os << "  // Note: Toom-Cook 3-way was never fastest below the FFT tier, so its tier is empty.\n";
+    }
+
+    if(t.fft_is_empty)
+    {
+      os << "  // Note: The " << fft_float_name << " FFT was never fastest within its safe size, so its tier is empty.\n";
+    }
+
+    os << "  template<> struct decwide_t_mul_thresholds<" << limb_name << ", " << fft_float_name << ">\n"
+       << "  {\n"
+       << "    static constexpr std::int32_t elems_for_kara  = static_cast<std::int32_t>(INT32_C(" << t.elems_for_kara  << "));\n"
+       << "    static constexpr std::int32_t elems_for_toom3 = static_cast<std::int32_t>(INT32_C(" << t.elems_for_toom3 << "));\n"
+       << "    static constexpr std::int32_t elems_for_fft   = static_cast<std::int32_t>(INT32_C(" << t.elems_for_fft   << "));\n"
+       << "    static constexpr std::int32_t elems_for_ntt   = static_cast<std::int32_t>(INT32_C(" << t.elems_for_ntt   << "));\n"
+       << "  };\n\n";
+  }
+
+  template<typename LimbType>
+  auto calibrate_limb_type(std::ostream& os, const char* limb_name) -> void
+  {
+    mul_kernels<LimbType> kernels(INT32_C(16384) + INT32_C(1024));
+
+    std::cerr << "calibrating " << limb_name << " limbs..." << std::endl;
+
+    const thresholds_type kara_and_toom3 = calibrate_kara_and_toom3(kernels);
+
+    const thresholds_type t_flt = calibrate_fft<LimbType, float>      (kernels, kara_and_toom3);
+    const thresholds_type t_dbl = calibrate_fft<LimbType, double>     (kernels, kara_and_toom3);
+    const thresholds_type t_ldb = calibrate_fft<LimbType, long double>(kernels, kara_and_toom3);
+
+    print_specialization(os, limb_name, "float",       t_flt);
+    print_specialization(os, limb_name, "double",      t_dbl);
+    print_specialization(os, limb_name, "long double", t_ldb);
+  }
+
+  auto calibrate(std::ostream& os) -> void
+  {
+    os << "///////////////////////////////////////////////////////////////////\n"
+       << "//  Generated by decwide_t_calibrate. Do not edit.              //\n"
+       << "///////////////////////////////////////////////////////////////////\n\n"
+       << "#ifndef DECWIDE_T_MUL_THRESHOLDS_HOST_H // NOLINT(llvm-header-guard)\n"
+       << "  #define DECWIDE_T_MUL_THRESHOLDS_HOST_H\n\n"
+       << "  #include <cstdint>\n\n"
+       << "  WIDE_DECIMAL_NAMESPACE_BEGIN\n\n"
+       << "  #if(__cplusplus >= 201703L)\n"
+       << "  namespace math::wide_decimal::detail {\n"
+       << "  #else\n"
+       << "  namespace math { namespace wide_decimal { namespace detail { // NOLINT(modernize-concat-nested-namespaces)\n"
+       << "  #endif\n\n";
+
+    calibrate_limb_type<std::uint8_t> (os, "std::uint8_t");
+    calibrate_limb_type<std::uint16_t>(os, "std::uint16_t");
+    calibrate_limb_type<std::uint32_t>(os, "std::uint32_t");
+    calibrate_limb_type<std::uint64_t>(os, "std::uint64_t");
+
+    os << "  #if(__cplusplus >= 201703L)\n"
+       << "  } // namespace math::wide_decimal::detail\n"
+       << "  #else\n"
+       << "  } // namespace detail\n"
+       << "  } // namespace wide_decimal\n"
+       << "  } // namespace math\n"
+       << "  #endif\n\n"
+       << "  WIDE_DECIMAL_NAMESPACE_END\n\n"
+       << "#endif // DECWIDE_T_MUL_THRESHOLDS_HOST_H\n";
+  }
+} // namespace local
+
+auto main(int argc, char** argv) -> int // NOLINT(bugprone-exception-escape)
+{
+  std::stringstream strm { };
+
+  local::calibrate(strm);
+
+  if(argc > 1)
+  {
+    std::ofstream out(argv[1]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    out << strm.str();
+
+    if(!out)
+    {
+      std::cerr << "error: cannot write " << argv[1] << std::endl; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      return -1;
+    }
+  }
+  else
+  {
+    std::cout << strm.str();
+  }
+
+  return 0;
+}
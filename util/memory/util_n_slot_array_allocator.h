@@ -8,10 +8,16 @@
 #ifndef UTIL_N_SLOT_ARRAY_ALLOCATOR_2020_10_25_H // NOLINT(llvm-header-guard)
   #define UTIL_N_SLOT_ARRAY_ALLOCATOR_2020_10_25_H
 
+  //#define UTIL_N_SLOT_ARRAY_ALLOCATOR_LOCK_FREE
+
   #include <algorithm>
   #include <array>
+  #if defined(UTIL_N_SLOT_ARRAY_ALLOCATOR_LOCK_FREE)
+  #include <atomic>
+  #endif
   #include <cstddef>
   #include <cstdint>
+  #include <limits>
 
   namespace util {
 
@@ -49,8 +55,22 @@
 
     using slot_array_type        = std::array<T, static_cast<std::size_t>(slot_width)>;
     using slot_array_memory_type = std::array<slot_array_type, slot_count>;
+    #if defined(UTIL_N_SLOT_ARRAY_ALLOCATOR_LOCK_FREE)
+    // Each bit of the slot words is set while its slot is in use.
+    using slot_word_type         = std::uint32_t;
+
+    static constexpr std::size_t slot_word_bits  = static_cast<std::size_t>(std::numeric_limits<slot_word_type>::digits);
+    static constexpr std::size_t slot_word_count = static_cast<std::size_t>((slot_count + (slot_word_bits - 1U)) / slot_word_bits);
+
+    using slot_array_words_type  = std::array<std::atomic<slot_word_type>, slot_word_count>;
+    #else
     using slot_array_flags_type  = std::array<std::uint8_t, slot_count>;
 
+    // A link is a slot index plus one, where zero ends the list.
+    using slot_link_type         = std::size_t;
+    using slot_array_links_type  = std::array<slot_link_type, slot_count>;
+    #endif
+
   public:
     using size_type       = std::size_t;
     using value_type      = typename slot_array_type::value_type;
@@ -79,37 +99,68 @@
       static_cast<void>(count);
       static_cast<void>(p_hint);
 
-      pointer p { nullptr };
+      #if defined(UTIL_N_SLOT_ARRAY_ALLOCATOR_LOCK_FREE)
+      // In the lock-free mode, which can be used by several threads
+      // at the same time, the lowest free slot of each word is claimed
+      // by setting its bit with compare-and-swap.
 
-      // TBD: There is most likely significant optimization potential
-      // capable of being unlocked if a storage/lookup mechanism can be
-      // devised that uses a binary search when finding the next free slot.
+      for(auto word_index = static_cast<std::size_t>(UINT8_C(0)); word_index < slot_word_count; ++word_index)
+      {
+        auto& word = slot_words[word_index]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
 
-      // (TBD) In fact, constant-time allocation probably possible, as shown in:
-      // SmallObjectAllocator from Modern C++ Design by Andrei Alexandrescu.
+        const auto word_mask = slot_word_mask(word_index);
 
-      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < slot_count; ++i)
-      {
-        using local_flags_value_type = typename slot_array_flags_type::value_type;
+        auto bits = word.load(std::memory_order_relaxed);
 
-        if(slot_flags[i] == static_cast<local_flags_value_type>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        while(static_cast<slot_word_type>(static_cast<slot_word_type>(~bits) & word_mask) != static_cast<slot_word_type>(UINT8_C(0)))
         {
-          slot_flags[i] = static_cast<local_flags_value_type>(UINT8_C(1)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+          const auto free_bits = static_cast<slot_word_type>(static_cast<slot_word_type>(~bits) & word_mask);
 
-          p = static_cast<pointer>(slot_array_memory[i].data()); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+          const auto bit = static_cast<slot_word_type>(free_bits & static_cast<slot_word_type>(static_cast<slot_word_type>(~free_bits) + 1U));
 
-          if(i > slot_max_index)
+          if(word.compare_exchange_weak(bits, static_cast<slot_word_type>(bits | bit), std::memory_order_acquire, std::memory_order_relaxed))
           {
-            slot_max_index = i;
+            const auto index = static_cast<std::size_t>((word_index * slot_word_bits) + slot_bit_position(bit));
 
-            static_cast<void>(slot_max_index);
+            return static_cast<pointer>(slot_array_memory[index].data()); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
           }
-
-          break;
         }
       }
 
-      return p;
+      return nullptr;
+      #else
+      // The free slots are kept in a singly linked list (LIFO) of slot
+      // indices, as in the SmallObjectAllocator from Modern C++ Design
+      // by Andrei Alexandrescu. Slots which have never been used are
+      // not in the list, but are taken in ascending order starting
+      // at slot_fresh_index. So the zero-initialized static state
+      // is valid and allocation takes constant time.
+
+      std::size_t index { };
+
+      if(slot_free_head != static_cast<slot_link_type>(UINT8_C(0)))
+      {
+        index = static_cast<std::size_t>(slot_free_head - 1U);
+
+        slot_free_head = slot_free_next[index]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+      }
+      else if(slot_fresh_index < slot_count)
+      {
+        index = slot_fresh_index;
+
+        ++slot_fresh_index;
+      }
+      else
+      {
+        return nullptr;
+      }
+
+      using local_flags_value_type = typename slot_array_flags_type::value_type;
+
+      slot_flags[index] = static_cast<local_flags_value_type>(UINT8_C(1)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+      return static_cast<pointer>(slot_array_memory[index].data()); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+      #endif
     }
 
     auto construct(pointer p, const value_type& x) -> void
@@ -127,27 +178,81 @@
     {
       static_cast<void>(sz);
 
-      typename slot_array_memory_type::size_type index { };
+      // Recover the slot index from the address of the slot. Pointers
+      // which do not belong to a slot in use are ignored.
+      const auto offset =
+        static_cast<std::uintptr_t>
+        (
+            reinterpret_cast<std::uintptr_t>(p_slot)                   // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          - reinterpret_cast<std::uintptr_t>(slot_array_memory.data()) // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        );
+
+      const auto index = static_cast<std::size_t>(offset / sizeof(slot_array_type));
 
-      for(auto& slot_array_memory_entry : slot_array_memory)
+      #if defined(UTIL_N_SLOT_ARRAY_ALLOCATOR_LOCK_FREE)
+      if(   (index < slot_count)
+         && ((offset % sizeof(slot_array_type)) == static_cast<std::uintptr_t>(UINT8_C(0))))
       {
-        if(p_slot == static_cast<pointer>(slot_array_memory_entry.data()))
-        {
-          using local_flags_value_type = typename slot_array_flags_type::value_type;
+        const auto bit = static_cast<slot_word_type>(static_cast<slot_word_type>(UINT8_C(1)) << static_cast<unsigned>(index % slot_word_bits));
 
-          slot_flags[index] = static_cast<local_flags_value_type>(UINT8_C(0)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        slot_words[index / slot_word_bits].fetch_and(static_cast<slot_word_type>(~bit), std::memory_order_release); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+      }
+      #else
+      using local_flags_value_type = typename slot_array_flags_type::value_type;
 
-          break;
-        }
+      if(   (index < slot_count)
+         && ((offset % sizeof(slot_array_type)) == static_cast<std::uintptr_t>(UINT8_C(0)))
+         && (slot_flags[index] != static_cast<local_flags_value_type>(UINT8_C(0)))) // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+      {
+        slot_flags[index] = static_cast<local_flags_value_type>(UINT8_C(0)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
 
-        ++index;
+        slot_free_next[index] = slot_free_head; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        slot_free_head        = static_cast<slot_link_type>(index + 1U);
       }
+      #endif
     }
 
   private:
     static slot_array_memory_type slot_array_memory; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    #if defined(UTIL_N_SLOT_ARRAY_ALLOCATOR_LOCK_FREE)
+    static slot_array_words_type  slot_words;        // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    #else
     static slot_array_flags_type  slot_flags;        // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
-    static std::size_t            slot_max_index;    // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static slot_array_links_type  slot_free_next;    // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static slot_link_type         slot_free_head;    // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static std::size_t            slot_fresh_index;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    #endif
+
+    #if defined(UTIL_N_SLOT_ARRAY_ALLOCATOR_LOCK_FREE)
+    static constexpr auto slot_word_mask(const std::size_t word_index) -> slot_word_type
+    {
+      // Mask the bits of the slots which exist in the last word.
+      return
+        static_cast<slot_word_type>
+        (
+          ((word_index + 1U) < slot_word_count) || ((slot_count % slot_word_bits) == static_cast<std::size_t>(UINT8_C(0)))
+            ? (std::numeric_limits<slot_word_type>::max)()
+            : static_cast<slot_word_type>(static_cast<slot_word_type>(static_cast<slot_word_type>(UINT8_C(1)) << static_cast<unsigned>(slot_count % slot_word_bits)) - 1U)
+        );
+    }
+
+    static auto slot_bit_position(const slot_word_type bit) -> std::size_t
+    {
+      // Get the position of the single set bit.
+      #if (defined(__GNUC__) || defined(__clang__))
+      return static_cast<std::size_t>(__builtin_ctzl(static_cast<unsigned long>(bit))); // NOLINT(google-runtime-int)
+      #else
+      auto position = static_cast<std::size_t>(UINT8_C(0));
+
+      for(auto b = bit; b > static_cast<slot_word_type>(UINT8_C(1)); b = static_cast<slot_word_type>(b >> 1U))
+      {
+        ++position;
+      }
+
+      return position;
+      #endif
+    }
+    #endif
   };
 
   template<typename T,
@@ -155,6 +260,12 @@
            const std::size_t SlotCount>
   typename n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_array_memory_type n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_array_memory; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
 
+  #if defined(UTIL_N_SLOT_ARRAY_ALLOCATOR_LOCK_FREE)
+  template<typename T,
+           const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  typename n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_array_words_type n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_words; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+  #else
   template<typename T,
            const std::uint_fast32_t SlotWidth,
            const std::size_t SlotCount>
@@ -163,7 +274,18 @@
   template<typename T,
            const std::uint_fast32_t SlotWidth,
            const std::size_t SlotCount>
-  std::size_t n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_max_index; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+  typename n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_array_links_type n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_free_next; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+
+  template<typename T,
+           const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  typename n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_link_type n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_free_head; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+
+  template<typename T,
+           const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  std::size_t n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_fresh_index; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+  #endif
 
   // Global comparison operators (required by the standard).
   template<typename T,
@@ -0,0 +1,73 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright The wide-decimal contributors 2025.                //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#ifndef UTIL_SMALL_BUFFER_ALLOCATOR_2025_03_02_H // NOLINT(llvm-header-guard)
+  #define UTIL_SMALL_BUFFER_ALLOCATOR_2025_03_02_H
+
+  #include <cstddef>
+  #include <memory>
+
+  namespace util {
+
+  // The small_buffer_allocator allocates with its underlying allocator
+  // (AllocatorType). It marks a container as having inline storage
+  // for its first SmallCount elements. Only containers needing more
+  // elements than these allocate, which is then done with AllocatorType.
+
+  template<typename T,
+           const std::size_t SmallCount,
+           typename AllocatorType = std::allocator<void>>
+  class small_buffer_allocator : public std::allocator_traits<AllocatorType>::template rebind_alloc<T> // NOLINT(cppcoreguidelines-special-member-functions,hicpp-special-member-functions)
+  {
+  private:
+    using base_class_type = typename std::allocator_traits<AllocatorType>::template rebind_alloc<T>;
+
+  public:
+    using value_type           = T;
+    using underlying_allocator = AllocatorType;
+
+    static constexpr auto small_count() noexcept -> std::size_t { return SmallCount; }
+
+    constexpr small_buffer_allocator() = default; // LCOV_EXCL_LINE
+
+    constexpr small_buffer_allocator(const small_buffer_allocator&) = default; // LCOV_EXCL_LINE
+
+    template<typename U>
+    constexpr small_buffer_allocator(const small_buffer_allocator<U, SmallCount, AllocatorType>&) noexcept { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    template<typename RebindType>
+    struct rebind
+    {
+      using other = small_buffer_allocator<RebindType, SmallCount, AllocatorType>;
+    };
+
+    auto operator=(const small_buffer_allocator&) -> small_buffer_allocator& = default;
+  };
+
+  template<typename T,
+           typename U,
+           const std::size_t SmallCount,
+           typename AllocatorType>
+  constexpr auto operator==(const small_buffer_allocator<T, SmallCount, AllocatorType>&,
+                            const small_buffer_allocator<U, SmallCount, AllocatorType>&) noexcept -> bool
+  {
+    return true;
+  }
+
+  template<typename T,
+           typename U,
+           const std::size_t SmallCount,
+           typename AllocatorType>
+  constexpr auto operator!=(const small_buffer_allocator<T, SmallCount, AllocatorType>&,
+                            const small_buffer_allocator<U, SmallCount, AllocatorType>&) noexcept -> bool
+  {
+    return false;
+  }
+
+  } // namespace util
+
+#endif // UTIL_SMALL_BUFFER_ALLOCATOR_2025_03_02_H